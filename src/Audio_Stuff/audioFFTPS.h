@@ -0,0 +1,35 @@
+#ifndef audioFFTPS_h
+#define audioFFTPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for holding the buffers for a fixed point FFT (Fast Fourier Transform) of audio samples,
+used by audioUtilsPS::runFFT() to split audio into its frequencies.
+The FFT works on the last "length" samples read from an audio source (stored in sampleArr),
+which must be a power of 2, ie 64, 128, 256, or 512.
+Larger lengths give finer frequency detail, but use more memory and respond more slowly to changes.
+The FFT's output is stored in reArr and imArr (the real and imaginary parts of each frequency "bin"),
+with bin i covering frequencies around i * (sample rate) / length. Only the first length/2 bins are useful.
+
+The buffers are allocated together as a single block, 6 bytes per FFT sample, so a length of 256 uses 1.5KB.
+You shouldn't need to set any of the struct's variables yourself, use audioUtilsPS::resizeFFT() to create the buffers.
+Like with other structs, it must be initialized with its pointers set to null:
+    audioFFTPS audioFFT = {nullptr}; //Must init structs w/ pointers set to null for safety
+!!The buffers are created dynamically, so make sure you free() the sampleArr when you're done by calling memUtilsPS::freePS(audioFFT.sampleArr). */
+struct audioFFTPS {
+    int16_t *sampleArr;  //the last "length" audio samples, oldest first (also the start of the memory block)
+    int16_t *reArr;      //the real part of the FFT output (shares the sampleArr's memory block)
+    int16_t *imArr;      //the imaginary part of the FFT output (shares the sampleArr's memory block)
+    uint16_t length;     //the number of samples in the FFT (a power of 2)
+    uint16_t maxLength;  //The largest length the memory block can hold, used for memory management (see patternPS for more)
+    uint8_t numBits;     //the number of bits in the length, ie length = 2^numBits
+};
+
+#endif
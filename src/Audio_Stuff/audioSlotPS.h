@@ -0,0 +1,36 @@
+#ifndef audioSlotPS_h
+#define audioSlotPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for an audio "parameter slot", used by AudioAnalyzerPS to publish its results to effects.
+Each slot maps one of the analyzer's outputs (the overall level, a frequency band, or the beat pulse) 
+onto a range of values, from outMin (for silence) to outMax (for a full level).
+Because the slot's value is updated in place, you can bind an effect's pointer settings directly to it,
+without having to copy the value each update:
+    yourEffect.rate = &audioAnalyzer.slotArr[0].value;
+    breath.breathFreq = &audioAnalyzer.slotArr[1].value8;
+For settings that are uint8_t's, use value8, which is the value capped at 255.
+outMin can be larger than outMax, which is useful for rates, where a lower rate is faster. 
+
+Source types:
+    0 -- The overall level of the audio (all bands, smoothed).
+    1 -- The level of a single frequency band (smoothed), sourceIndex is the band number (0 being the lowest frequencies).
+    2 -- The beat pulse, which jumps to 255 on each beat, and then fades out. */
+struct audioSlotPS {
+    uint8_t sourceType;   //which analyzer output the slot follows (see source types above)
+    uint8_t sourceIndex;  //the band number, for source type 1
+    uint16_t outMin;      //the slot's value when the source is 0
+    uint16_t outMax;      //the slot's value when the source is 255
+    uint16_t value;       //the slot's output value (set automatically)
+    uint8_t value8;       //the output value, capped at 255, for binding to uint8_t settings (set automatically)
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef audioSourcePS_h
+#define audioSourcePS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for pointing the AudioAnalyzerPS utility at a source of audio samples.
+Samples are mono, signed 16 bit PCM (-32768 to 32767), which is what most I2S microphones, 
+ADC's (once centered and scaled), and WAV files use. 
+The samples can be read in one of two ways:
+    1: From memory, by setting sampleArr to point to an array of samples.
+       The samples are read in order, looping back to the start once the end is reached.
+       This is mostly useful for testing, or playing a short, fixed clip.
+    2: As a stream, by setting sampleArr to nullptr, and providing a "readFn" function.
+       Use this for live audio, ie I2S or ADC buffers on a microcontroller, or a WAV file or stdin on a computer.
+       The function must fill "buf" with up to "len" samples, and return the number of samples read.
+       It should not wait for samples; if no new samples are ready it should return 0.
+       The readData pointer is passed to the function each time, so you can use it to pass in your I2S port, file, etc.
+In both cases the samples are read in by calling audioUtilsPS::readSamples().
+
+Example sources:
+    //Samples stored in memory, "length" is the number of samples
+    const int16_t mySamples[] = { ... };
+    audioSourcePS audioSource = {mySamples, SIZE(mySamples)};
+
+    //Samples read from an I2S microphone on an ESP32 (using the legacy I2S driver)
+    uint16_t readI2S(void *readData, int16_t *buf, uint16_t len){
+        size_t bytesRead = 0;
+        i2s_read(I2S_NUM_0, buf, len * sizeof(int16_t), &bytesRead, 0);
+        return bytesRead / sizeof(int16_t);
+    }
+    audioSourcePS audioSource = {nullptr, 0, 0, readI2S, nullptr};
+
+    //Samples read from a mono 16 bit WAV file, or piped into stdin, on a computer
+    //(for a WAV file, skip its header first using audioUtilsPS::getWavDataStart())
+    uint16_t readFile(void *readData, int16_t *buf, uint16_t len){
+        return fread(buf, sizeof(int16_t), len, (FILE*)readData);
+    }
+    audioSourcePS audioSource = {nullptr, 0, 0, readFile, stdin};
+*/
+struct audioSourcePS {
+    const int16_t *sampleArr;  //pointer to the samples if they are in memory, otherwise nullptr
+    uint32_t length;           //the number of samples in the sampleArr
+    uint32_t pos;              //the next sample to read from the sampleArr (set automatically)
+    uint16_t (*readFn)(void *readData, int16_t *buf, uint16_t len);  //function for reading samples (if sampleArr is nullptr)
+    void *readData;            //passed to the readFn, ie a pointer to a file object
+};
+
+#endif
@@ -0,0 +1,247 @@
+#include "audioUtilsPS.h"
+
+using namespace audioUtilsPS;
+
+//Sets up the buffers for an FFT of "length" samples (see audioFFTPS.h)
+//The length is rounded down to a power of 2, between 8 and 1024
+//The sample, real, and imaginary arrays are allocated as a single block of memory, 
+//which is only re-sized if it's too small (to help prevent memory fragmentation).
+//The sample buffer is cleared, so the FFT starts with silence.
+void audioUtilsPS::resizeFFT(audioFFTPS &audioFFT, uint16_t length) {
+    //Round the length down to a power of 2, capped between 8 and 1024
+    length = constrain(length, 8, 1024);
+    audioFFT.numBits = 0;
+    while( (1 << (audioFFT.numBits + 1)) <= length ) {
+        audioFFT.numBits++;
+    }
+    length = 1 << audioFFT.numBits;
+
+    if( alwaysResizeObj_PS || (length > audioFFT.maxLength) ) {
+        audioFFT.maxLength = length;
+        memUtilsPS::freePS(audioFFT.sampleArr);
+        audioFFT.sampleArr = (int16_t *)memUtilsPS::allocPS(length * 3 * sizeof(int16_t));
+    }
+    audioFFT.length = length;
+    audioFFT.reArr = audioFFT.sampleArr + length;
+    audioFFT.imArr = audioFFT.reArr + length;
+
+    for( uint16_t i = 0; i < length; i++ ) {
+        audioFFT.sampleArr[i] = 0;
+    }
+}
+
+//Reads up to "len" samples from an audio source into "buf", returning the number of samples read
+//For sources in memory, the samples are read in order, looping back to the start at the end of the samples
+//Otherwise the source's readFn is called (see audioSourcePS.h)
+uint16_t audioUtilsPS::readSamples(audioSourcePS &audioSource, int16_t *buf, uint16_t len) {
+    if( !audioSource.sampleArr ) {
+        if( !audioSource.readFn ) {
+            return 0;
+        }
+        return audioSource.readFn(audioSource.readData, buf, len);
+    }
+
+    if( audioSource.length == 0 ) {
+        return 0;
+    }
+
+    for( uint16_t i = 0; i < len; i++ ) {
+        if( audioSource.pos >= audioSource.length ) {
+            audioSource.pos = 0;
+        }
+        buf[i] = audioSource.sampleArr[audioSource.pos];
+        audioSource.pos++;
+    }
+    return len;
+}
+
+//Reads any new samples from an audio source into the end of an FFT's sample buffer,
+//shifting the older samples towards the start of the buffer. Returns the number of new samples.
+//At most the FFT's length of samples are read at once.
+//The new samples are read into the FFT's imArr first, which is free until the FFT is run.
+uint16_t audioUtilsPS::pushSamples(audioSourcePS &audioSource, audioFFTPS &audioFFT) {
+    uint16_t numRead = readSamples(audioSource, audioFFT.imArr, audioFFT.length);
+    if( numRead == 0 ) {
+        return 0;
+    }
+
+    uint16_t numKept = audioFFT.length - numRead;
+    memmove(audioFFT.sampleArr, audioFFT.sampleArr + numRead, numKept * sizeof(int16_t));
+    memcpy(audioFFT.sampleArr + numKept, audioFFT.imArr, numRead * sizeof(int16_t));
+    return numRead;
+}
+
+//Returns the byte position of the samples in a WAV file, given the start of the file ("header", "len" bytes long),
+//so that you can skip the file's header before reading samples (see audioSourcePS.h)
+//The WAV file must be mono, 16 bit PCM, otherwise (or if the samples aren't found in the header) -1 is returned
+//The header should be at least 64 bytes, to cover any extra chunks at the start of the file
+int32_t audioUtilsPS::getWavDataStart(const uint8_t *header, uint16_t len) {
+    if( len < 12 || memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0 ) {
+        return -1;
+    }
+
+    //Step through the file's chunks, checking the format chunk until we find the "data" chunk
+    //Each chunk has a 4 character id, followed by its length (4 bytes)
+    uint32_t pos = 12, chunkLen;
+    bool formatOk = false;
+    while( pos + 8 <= len ) {
+        chunkLen = header[pos + 4] | ((uint32_t)header[pos + 5] << 8) | 
+                   ((uint32_t)header[pos + 6] << 16) | ((uint32_t)header[pos + 7] << 24);
+
+        if( memcmp(header + pos, "fmt ", 4) == 0 ) {
+            if( pos + 24 > len ) {
+                return -1;
+            }
+            //The format must be 1 (PCM), with 1 channel, and 16 bits per sample
+            formatOk = (header[pos + 8] == 1) && (header[pos + 10] == 1) && (header[pos + 22] == 16);
+        } else if( memcmp(header + pos, "data", 4) == 0 ) {
+            return formatOk ? (int32_t)(pos + 8) : -1;
+        }
+
+        //Chunks are padded to an even number of bytes
+        pos += 8 + chunkLen + (chunkLen & 1);
+    }
+    return -1;
+}
+
+//Runs an FFT on an FFT's sample buffer, storing the output in its reArr and imArr
+//The samples are windowed (using a Hann window) and written into the reArr in "bit reversed" order
+//(ie for a length of 8, sample 1 (001) goes into position 4 (100)), so that the FFT can be done in place.
+//Then the FFT's butterflies are run, starting with pairs of samples, and doubling the span each stage.
+//Each stage halves its outputs to prevent overflows.
+//Angles are in FastLED's sin16() units, where 65536 is a full circle, and sin16() returns -32767 to 32767.
+void audioUtilsPS::runFFT(audioFFTPS &audioFFT) {
+    uint16_t length = audioFFT.length;
+    int16_t *reArr = audioFFT.reArr;
+    int16_t *imArr = audioFFT.imArr;
+    uint16_t angleStep = 65536 / length;
+    uint16_t revIndex;
+    int16_t window;
+
+    //Window the samples and write them out in bit reversed order
+    for( uint16_t i = 0; i < length; i++ ) {
+        revIndex = 0;
+        for( uint8_t j = 0; j < audioFFT.numBits; j++ ) {
+            revIndex |= ((i >> j) & 1) << (audioFFT.numBits - 1 - j);
+        }
+        //The Hann window is (1 - cos(angle)) / 2, (cos is sin shifted by a quarter circle)
+        window = (32767 - sin16(i * angleStep + 16384)) >> 1;
+        reArr[revIndex] = ((int32_t)audioFFT.sampleArr[i] * window) >> 15;
+        imArr[revIndex] = 0;
+    }
+
+    //Run the butterflies
+    //For each stage, the span is the distance between the pairs in each butterfly
+    int16_t wRe, wIm, tRe, tIm;
+    uint16_t pair;
+    for( uint16_t span = 1; span < length; span <<= 1 ) {
+        //The twiddle angle step for the stage (a full circle / (span * 2))
+        angleStep = 32768 / span;
+        for( uint16_t j = 0; j < span; j++ ) {
+            //The twiddle factor is e^(-i * angle) = cos(angle) - i * sin(angle)
+            wRe = sin16(j * angleStep + 16384);
+            wIm = -sin16(j * angleStep);
+            for( uint16_t i = j; i < length; i += span * 2 ) {
+                pair = i + span;
+                tRe = ((int32_t)wRe * reArr[pair] - (int32_t)wIm * imArr[pair]) >> 15;
+                tIm = ((int32_t)wRe * imArr[pair] + (int32_t)wIm * reArr[pair]) >> 15;
+                reArr[pair] = ((int32_t)reArr[i] - tRe) >> 1;
+                imArr[pair] = ((int32_t)imArr[i] - tIm) >> 1;
+                reArr[i] = ((int32_t)reArr[i] + tRe) >> 1;
+                imArr[i] = ((int32_t)imArr[i] + tIm) >> 1;
+            }
+        }
+    }
+}
+
+//Returns the magnitude of an FFT bin, sqrt(re^2 + im^2)
+//To avoid the square root, we use the "alpha max plus beta min" approximation: max + 3/8 * min (within ~7%)
+uint16_t audioUtilsPS::getBinMag(audioFFTPS &audioFFT, uint16_t bin) {
+    uint16_t re = abs(audioFFT.reArr[bin]);
+    uint16_t im = abs(audioFFT.imArr[bin]);
+    if( re > im ) {
+        return re + ((im * 3) >> 3);
+    }
+    return im + ((re * 3) >> 3);
+}
+
+//Returns the total magnitude of the FFT bins from startBin up to (but not including) endBin
+uint32_t audioUtilsPS::getBandMag(audioFFTPS &audioFFT, uint16_t startBin, uint16_t endBin) {
+    uint32_t bandMag = 0;
+    for( uint16_t i = startBin; i < endBin; i++ ) {
+        bandMag += getBinMag(audioFFT, i);
+    }
+    return bandMag;
+}
+
+//Fills in the bin edges for "numBands" frequency bands, spaced logarithmically across an FFT's bins
+//Band i covers the bins from bandArr[i] up to (but not including) bandArr[i + 1], so the bandArr must be numBands + 1 long.
+//The bands run from bin 1 (bin 0 is the average of the samples, not a frequency) to fftLength/2,
+//with each band being at least one bin wide. 
+//!!The number of bands must be less than fftLength/2
+void audioUtilsPS::setupBands(uint16_t *bandArr, uint8_t numBands, uint16_t fftLength) {
+    uint16_t maxBin = fftLength / 2;
+    uint16_t edge;
+    bandArr[0] = 1;
+
+    for( uint8_t i = 1; i <= numBands; i++ ) {
+        //The band's edge is maxBin^(i/numBands), but must be after the last edge,
+        //and leave room for the remaining bands
+        edge = pow(maxBin, (float)i / numBands) + 0.5;
+        edge = constrain(edge, bandArr[i - 1] + 1, maxBin - (numBands - i));
+        bandArr[i] = edge;
+    }
+}
+
+//Returns the log2 of a value, as a fixed point number, with 8 bits after the point
+//(ie log2(8) = 3 is returned as 768, while log2(12) = ~3.5 is 896)
+//The fraction is approximated linearly from the bits after the highest set bit
+//log2(0) is returned as 0
+uint16_t audioUtilsPS::getLog2(uint32_t val) {
+    if( val == 0 ) {
+        return 0;
+    }
+
+    uint8_t highBit = 31;
+    while( !(val >> highBit) ) {
+        highBit--;
+    }
+
+    //Shift the bits after the highest bit into the top of the value, and take the first 8 as the fraction
+    uint8_t frac = (val << (31 - highBit)) >> 23;
+    return ((uint16_t)highBit << 8) | frac;
+}
+
+//Converts a log2 value (see getLog2()) into a level from 0 to 255
+//Values at or below the noiseFloor are 0, while values of noiseFloor + dynRange or more are 255
+//(both are log2 values, so each 256 is a doubling of the magnitude, about 6dB)
+uint8_t audioUtilsPS::getLogLevel(uint16_t logVal, uint16_t noiseFloor, uint16_t dynRange) {
+    if( logVal <= noiseFloor || dynRange == 0 ) {
+        return 0;
+    }
+
+    uint32_t level = ((uint32_t)(logVal - noiseFloor) * 255) / dynRange;
+    return minPS(level, 255);
+}
+
+//Moves an envelope follower towards a target level, returning the envelope's level (0 - 255)
+//The envelope is stored with 8 bits of fraction so that it can move smoothly at low speeds.
+//When the target is above the envelope it moves up using the attack speed, otherwise it falls using the release speed.
+//Both speeds are the fraction of the distance to the target that is moved each time (out of 255),
+//ie an attack of 255 jumps straight to the target, while an attack of 32 moves 1/8 of the way.
+uint8_t audioUtilsPS::followEnv(uint16_t &env, uint8_t target, uint8_t attack, uint8_t release) {
+    int32_t diff = ((int32_t)target << 8) - env;
+    uint8_t speed = (diff > 0) ? attack : release;
+    env += (diff * speed) / 255;
+    return env >> 8;
+}
+
+//Returns the output value for an audio slot, given its source value (0 - 255) (see audioSlotPS.h)
+//The value is mapped from the slot's outMin (source of 0) to outMax (source of 255)
+//The value is also written to the slot, along with its 8 bit version
+uint16_t audioUtilsPS::getSlotVal(audioSlotPS &audioSlot, uint8_t sourceVal) {
+    int32_t range = (int32_t)audioSlot.outMax - audioSlot.outMin;
+    audioSlot.value = audioSlot.outMin + (range * sourceVal) / 255;
+    audioSlot.value8 = minPS(audioSlot.value, 255);
+    return audioSlot.value;
+}
@@ -0,0 +1,56 @@
+#ifndef audioUtilsPS_h
+#define audioUtilsPS_h
+
+#include "FastLED.h"
+#include "audioSourcePS.h"
+#include "audioFFTPS.h"
+#include "audioSlotPS.h"
+#include "MathUtils/mathUtilsPS.h"
+#include "Memory_Stuff/memUtilsPS.h"
+#include "./Include_Lists/GlobalVars/GlobalVars.h"  //need alwaysResizeObj_PS
+
+/*
+Functions for analyzing audio, used by the AudioAnalyzerPS utility.
+Audio samples are read from an audioSourcePS (see audioSourcePS.h) into an audioFFTPS's sample buffer using pushSamples(),
+and are then split into their frequencies using runFFT().
+The FFT is a fixed point, radix-2 FFT, using only integer math, with FastLED's sin16() for the twiddle factors and window,
+so it runs quickly on chips without a floating point unit. 
+Each stage of the FFT halves its values to prevent overflows, so the outputs are scaled down by the FFT length.
+Before the FFT, the samples are multiplied by a Hann window, which reduces the "leakage" of loud frequencies into their neighbors.
+
+The frequencies are grouped into bands using setupBands(), which spaces the bands logarithmically,
+so that the low bands are narrow, and the high bands are wide, matching how we hear pitch.
+Levels are measured in log2 units (see getLog2()), so that quiet and loud sounds both give useful values.
+*/
+namespace audioUtilsPS {
+
+    void  //Functions for reading samples
+        resizeFFT(audioFFTPS &audioFFT, uint16_t length);
+
+    uint16_t
+        readSamples(audioSourcePS &audioSource, int16_t *buf, uint16_t len),
+        pushSamples(audioSourcePS &audioSource, audioFFTPS &audioFFT);
+
+    int32_t
+        getWavDataStart(const uint8_t *header, uint16_t len);
+
+    void  //Functions for the FFT
+        runFFT(audioFFTPS &audioFFT),
+        setupBands(uint16_t *bandArr, uint8_t numBands, uint16_t fftLength);
+
+    uint16_t
+        getBinMag(audioFFTPS &audioFFT, uint16_t bin),
+        getLog2(uint32_t val);
+
+    uint32_t
+        getBandMag(audioFFTPS &audioFFT, uint16_t startBin, uint16_t endBin);
+
+    uint8_t  //Functions for levels
+        getLogLevel(uint16_t logVal, uint16_t noiseFloor, uint16_t dynRange),
+        followEnv(uint16_t &env, uint8_t target, uint8_t attack, uint8_t release);
+
+    uint16_t
+        getSlotVal(audioSlotPS &audioSlot, uint8_t sourceVal);
+};
+
+#endif
@@ -10,6 +10,13 @@ CRGB colorUtilsPS::randColor() {
     //return CRGB( random8(), random8(), random8() );
 }
 
+//Same as randColor() above, but draws the random values from the passed in random stream (see randStreamPS.h)
+CRGB colorUtilsPS::randColor(randStreamPS &randStream) {
+    //(we get the hue first so the random values are always drawn in the same order)
+    randHue = randUtilsPS::rand8(randStream);
+    return CHSV(randHue, randUtilsPS::rand8(randStream, randSatMin, randSatMax), 255);
+}
+
 //Returns a random color from the HSV spectrum
 //The ranges satMin to satMax and valMin to valMax set the random ranges for the HSV saturation and value
 //ie if satMin is 50 and satMax is 255, the random color's saturation will be between 50 and 255.
@@ -5,6 +5,7 @@
 
 #include "FastLED.h"
 #include "MathUtils/mathUtilsPS.h"
+#include "Random_Stuff/randUtilsPS.h"
 
 //Various functions for manipulating colors, see function comments in the .cpp file for info on each function
 //Note that randSatMin and randSatMax control the saturation range for random colors.
@@ -14,6 +15,7 @@ namespace colorUtilsPS {
 
     CRGB
         randColor(),
+        randColor(randStreamPS &randStream),
         randColor(uint8_t satMin, uint8_t satMax, uint8_t valMin, uint8_t valMax),
         getCompColor(uint8_t baseHue, uint8_t numColors, uint8_t num, uint8_t sat, uint8_t val),
         wheel(uint16_t hue, uint16_t hueOffset, uint8_t sat, uint8_t val),
@@ -29,6 +31,7 @@ namespace colorUtilsPS {
     static uint8_t
         randSatMin = 100,
         randSatMax = 255,
+        randHue,
         ratio;
 
 };
@@ -49,8 +49,8 @@ BreathPS::BreathPS(SegmentSetPS &SegSet, CRGB BgColor, uint8_t HueRate, uint8_t
 }
 
 BreathPS::~BreathPS() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //bind core class vars
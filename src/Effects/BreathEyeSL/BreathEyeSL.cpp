@@ -52,8 +52,8 @@ BreathEyeSL::BreathEyeSL(SegmentSetPS &SegSet, CRGB BgColor, uint8_t HueRate, ui
 }
 
 BreathEyeSL::~BreathEyeSL() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //bind core class vars
@@ -32,7 +32,8 @@ ColorMeltSL::ColorMeltSL(SegmentSetPS &SegSet, uint8_t numColors, uint8_t MeltFr
 }
 
 ColorMeltSL::~ColorMeltSL() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(lineColors.colorArr);
 }
 
 void ColorMeltSL::init(SegmentSetPS &SegSet, uint16_t Rate) {
@@ -76,7 +77,6 @@ void ColorMeltSL::update() {
 
         //fetch some core vars
         //we re-fetch these in case the segment set or palette has changed
-        numSegs = segSet->numSegs;
         numLines = segSet->numLines;
 
         hl = numLines / hlDiv;
@@ -93,7 +93,10 @@ void ColorMeltSL::update() {
         //We do this so we only need to do it once per cycle
         blendLength = 255 / palette->length;
 
-        //set a color for each line and then color in all the pixels on the line
+        //Make sure we have space to store a color for each line
+        segDrawUtils::resizeLineColors(lineColors, numLines);
+
+        //set a color for each line
         for( uint16_t i = 0; i < numLines; i++ ) {
 
             c1 = 255 - (abs(int32_t(i) - hl) * 255) / hl;
@@ -118,13 +121,12 @@ void ColorMeltSL::update() {
                 nscale8x3(colorOut.r, colorOut.g, colorOut.b, v);
             }
 
-            for( uint16_t j = 0; j < numSegs; j++ ) {
-                //get the physical pixel location based on the line and seg numbers
-                //and then write out the color
-                pixelNum = segDrawUtils::getPixelNumFromLineNum(*segSet, j, numLines - i - 1);
-                segDrawUtils::setPixelColor(*segSet, pixelNum, colorOut, 0, 0, 0);
-            }
+            lineColors.colorArr[i] = colorOut;
         }
+
+        //Then color in all the pixels on each line in one pass
+        //The lines are reversed so that the effect moves positively along the strip
+        segDrawUtils::drawLineColors(*segSet, lineColors, 0, true);
         showCheckPS();
     }
 }
\ No newline at end of file
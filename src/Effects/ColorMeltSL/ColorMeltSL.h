@@ -135,14 +135,15 @@ class ColorMeltSL : public EffectBasePS {
 
         uint16_t
             hl,
-            pixelNum,
             numLines,
-            numSegs,
             blendLength;
 
         CRGB
             colorOut;
 
+        lineColorsPS
+            lineColors = {nullptr, 0, 0};  //Must init structs w/ pointers set to null for safety
+
         void
             init(SegmentSetPS &SegSet, uint16_t Rate);
 };
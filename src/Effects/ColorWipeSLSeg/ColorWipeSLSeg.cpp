@@ -34,8 +34,8 @@ ColorWipeSLSeg::ColorWipeSLSeg(SegmentSetPS &SegSet, CRGB WipeColor, uint16_t Wi
 
 //destructor
 ColorWipeSLSeg::~ColorWipeSLSeg() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //Sets up the core variables for the effect
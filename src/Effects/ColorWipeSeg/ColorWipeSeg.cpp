@@ -30,8 +30,8 @@ ColorWipeSeg::ColorWipeSeg(SegmentSetPS &SegSet, CRGB WipeColor, uint8_t Style,
 
 //destructor
 ColorWipeSeg::~ColorWipeSeg() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //Setup core variables for the effect
@@ -31,8 +31,8 @@ CrossFadeCyclePS::CrossFadeCyclePS(SegmentSetPS &SegSet, uint8_t Steps, uint16_t
 }
 
 CrossFadeCyclePS::~CrossFadeCyclePS() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //bind core class vars
@@ -35,9 +35,8 @@ DissolveSL::DissolveSL(SegmentSetPS &SegSet, uint8_t RandMode, uint8_t BgMode, u
 
 //destructor
 DissolveSL::~DissolveSL() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
-    free(pixelArray);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //inits core variables for the effect
@@ -100,15 +99,13 @@ void DissolveSL::setBgMode(uint8_t newBgMode) {
     }
 }
 
-//Sets the line mode var, also restarts the dissolve,
-//and sets the setAllThreshold to 1/10 the numLines
+//Sets the line mode var, also restarts the dissolve
 void DissolveSL::setLineMode(bool newLineMode) {
     lineMode = newLineMode;
     resetPixelArray();
-    setAllThreshold = numLines - ceil((float)(numLines) / 10);
 }
 
-//resets the pixel array to false, restarting the dissolve
+//Restarts the dissolve by picking a new random order for the lines (see randPermPS.h)
 //also resets the core effect variables as needed
 //This is called automatically as part of the effect, but if you change the segment set, you should call this
 void DissolveSL::resetPixelArray() {
@@ -121,24 +118,12 @@ void DissolveSL::resetPixelArray() {
         numLines = segSet->numLeds;
     }
 
-    //To record if a line has been switched or not, we need to create an array of bools
-    //We only need to make a new array if the current one isn't large enough
-    //This helps prevent memory fragmentation by limiting the number of heap allocations
-    //but this may use up more memory overall.
-    if( alwaysResizeObj_PS || (numLines > maxNumLines) ) {
-        maxNumLines = numLines;
-        free(pixelArray);
-        pixelArray = (bool *)malloc(numLines * sizeof(bool));
-    }
-
-    //reset the bool array, indicating that all the lines need to be spawned
-    for( uint16_t i = 0; i < numLines; i++ ) {
-        pixelArray[i] = false;
-    }
+    //Pick a new random order for the lines
+    //The n-th line we spawn is the n-th value of the permutation, so we never pick the same line twice
+    randUtilsPS::setupPerm(randStream, dissolvePerm, numLines);
 
     maxNumSpawn = maxNumSpawnBase;
     numSpawned = 0;
-    thresStartPoint = 0;
     randColorPicked = false;
     paused = false;
 }
@@ -204,7 +189,7 @@ CRGB DissolveSL::pickDissolveColor() {
                 if( flipFlop ) {
                     color = *bgColor;
                     if(randMode5AllowRepeats){
-                        currentIndex = random16(pattern->length);
+                        currentIndex = randUtilsPS::rand16(randStream, pattern->length);
                     }
                 } else {
                     currentIndex = patternUtilsPS::getShuffleVal(*pattern, currentIndex, false); //get a shuffled color index, NOT allowing blanks
@@ -232,18 +217,13 @@ CRGB DissolveSL::getPatternColor(uint8_t patIndex) {
 //Updates the effect
 //How it works:
 //Our goal is to switch all of the lines from one color to the next at random
-//To record if any line has been switched we use an array of bools, one for each line (pixelArray)
-//When an line is switched, it's corresponding index in the array is switched to true
-//Each cycle we try to switch up to maxNumSpawn lines, picking them at random
-//If we pick an line that has not been switched, we switch it
-//We also increment numSpawned, which tracks how many lines have been switched so far
+//To do this without repeats, we pick the lines from a random permutation of the line numbers (dissolvePerm)
+//numSpawned tracks how many lines have been switched so far, so the next line to switch
+//is the permutation's value at numSpawned. This way every pick is a new line, and we don't need to record which lines are set.
+//Each cycle we switch up to maxNumSpawn lines
 //maxNumSpawn increases every spawnRateInc ms, to help speed up the spawning over time
-//To avoid getting stuck with just a few lines not switched (and missing them every time due to the randomness)
-//We use setAllThreshold, which is the maximum number of lines we'll try to set randomly
-//(setAllThreshold is set by init() based on the length of the segSet)
-//If numSpawned passes setAllThreshold, we'll set any remaining lines in order (up to maxNumSpawn lines per cycle)
 //Once all the lines have been set (numSpawned >= numLines)
-//We reset the pixel array, maxNumSpawn, thresStartPoint (used when setting the lines once the threshold is met)
+//We reset the permutation (picking a new random order), maxNumSpawn, and numSpawned
 //We also set paused, and increment the numCycles (which tracks how many dissolves we've done, used for setting colors)
 //Hang Time:
 //Hang time holds the current dissolve for a certain period before starting a new one
@@ -266,30 +246,10 @@ void DissolveSL::update() {
 
         prevTime = currentTime;
 
-        //try to spawn up to maxNumSpawn lines
-        //the lines will either be spawned randomly, or in order along the strip
-        //depending on if the threshold for setting all has been reached
-        for( uint16_t i = 0; i < maxNumSpawn; i++ ) {
-            //if we're not passed the threshold for setting all the lines,
-            //choose one randomly and try to set it
-            if( numSpawned < setAllThreshold ) {
-                lineNum = random16(numLines);
-                if( !pixelArray[lineNum] ) {
-                    spawnLed(lineNum);
-                }
-            } else {
-                //if we're setting all the lines we run through them all until we find
-                //one that's not set, we set it, then end the loop
-                //we also record the starting point for the loop next time,
-                //since we already know that all the leds up to that point have been set
-                for( uint16_t j = thresStartPoint; j < numLines; j++ ) {
-                    if( !pixelArray[j] ) {
-                        spawnLed(j);
-                        thresStartPoint = j;
-                        break;
-                    }
-                }
-            }
+        //spawn up to maxNumSpawn lines, taking the next lines from the permutation
+        for( uint16_t i = 0; i < maxNumSpawn && numSpawned < numLines; i++ ) {
+            lineNum = randUtilsPS::getPermVal(dissolvePerm, numSpawned);
+            spawnLed(lineNum);
         }
 
         //check if the dissolve is finished
@@ -324,9 +284,8 @@ void DissolveSL::update() {
 }
 
 //Colors a line at the specified line number
-//records that it's set to the array and also increments the number of lines spawned
+//and also increments the number of lines spawned
 void DissolveSL::spawnLed(uint16_t lineNum) {
-    pixelArray[lineNum] = true;
     color = pickDissolveColor();
 
     if( lineMode ) {
@@ -1,10 +1,6 @@
 #ifndef DissolveSL_h
 #define DissolveSL_h
 
-//TODO
-//  --Change bool array to uint8_t's where the bools are stored as the bits of the uint8_t's
-//    Will have to calculate the length of the array and write function for getting/setting
-
 #include "Effects/EffectBasePS.h"
 #include "GeneralUtils/generalUtilsPS.h"
 
@@ -22,8 +18,8 @@ The effect is adapted to work on segment lines for 2D use. (see Inputs Guide bel
 You can freely use colorModes from segDrawUtils::setPixelColor(), but they don't make much sense
 unless you are running an offset in the SegmentSetPS or using colorModes 5 or 6.
 
-Warning: requires an array of bools of equal size to the number of pixels in the segment set.
-So be careful of your memory usage!
+The lines are dissolved in a random order without repeats, using a random permutation (see randPermPS.h),
+so the effect doesn't need to store which lines have been set, and each line is set exactly once per dissolve.
 
 Inputs Guide:
 
@@ -37,19 +33,11 @@ Inputs Guide:
     Controlling How Pixels Spawn/Dissolve:
         The effect can be accelerated to set more lines/pixels at once by adjusting "spawnRateInc".
         By default we start by spawning one segment line at a time, increasing the number every spawnRateInc ms,
-        so the spawning steadily accelerates. This helps keep the spawning consistent, since we're picking 
-        repeatedly at random.
+        so the spawning steadily accelerates.
         Setting spawnRateInc close-ish (up to double?) to the update rate looks the best.
 
-        Once a certain threshold has been met, "setAllThreshold"  
-        (default of 1/10 of the number of lines in the segment set remaining)
-        All the remaining lines are set. This prevents us from getting stuck looking for the last line.
-        This may sound weird, but in practice it looks quite good.
-
-        Note, I know it would be better to remove the chance of picking a line that's already dissolved,
-        but that would require more memory to track the dissolved lines' locations 
-        (an array of uint16_t's vs an array of bools). 
-        Since the current effect seems to work, albeit with a bit of manual tweaking, I see no reason to change it.
+        The lines are picked from a random permutation of the segment set's lines, so every spawn
+        sets a new line, and the dissolve always finishes after numLines spawns.
 
         You can increase the starting number of lines set at once (maxNumSpawnBase), which will
         accelerate the dissolving, and may be good on longer segment sets.
@@ -157,12 +145,6 @@ Constructor Inputs
 Other Settings:
     *bgColor and bgColorOrig (default 0) -- The color used by "blank" spaces. By default the bgColor is pointed to bgColorOrig.
     colorMode (default 0) -- sets the color mode for the random pixels (see segDrawUtils::setPixelColor)
-    setAllThreshold (defaults to 1/10th of the segment set length) -- The number of segment lines that will be set 
-                                                                      randomly before any remaining lines are force 
-                                                                      set at once. This is a fail safe so that 
-                                                                      you don't get stuck with one line that is 
-                                                                      never randomly picked, preventing the dissolve 
-                                                                      from ending.
     pauseTime (default 0ms) -- The length of time that the effect will wait between dissolves.
                                If the pause time is active, it is indicated with the paused flag
     maxNumSpawnBase (default 1) -- The starting value of the number of segment lines set in one cycle. 
@@ -177,8 +159,8 @@ Functions:
     setBgMode(newBgMode) -- Sets the bgMode to control "blank" pattern spaces.
                             See "Inserting Background Dissolves" in Inputs Guide above.
     resetPixelArray() -- Resets the dissolved state of the segment lines, effectively restarting the current dissolve.
-    setLineMode(newLineMode) -- Sets the line mode (see intro LineMode notes), 
-                                also restarts the dissolve, and sets the setAllThreshold to 1/10 the numLines
+                         Also picks a new random order for the lines to dissolve in.
+    setLineMode(newLineMode) -- Sets the line mode (see intro LineMode notes), also restarts the dissolve.
     update() -- updates the effect
 
 Reference vars:
@@ -215,7 +197,6 @@ class DissolveSL : public EffectBasePS {
             maxNumSpawnBase = 1;
 
         uint16_t
-            setAllThreshold,
             randMode3CycleLen,
             pauseTime = 0,
             spawnRateInc,
@@ -225,8 +206,7 @@ class DissolveSL : public EffectBasePS {
         bool
             lineMode = true,  //for reference, set using setLineMode()
             paused = false,
-            randMode5AllowRepeats = false,
-            *pixelArray = nullptr;
+            randMode5AllowRepeats = false;
         
         CRGB
             bgColorOrig = 0,  //default "blank" color for spaces
@@ -258,10 +238,8 @@ class DissolveSL : public EffectBasePS {
             tempIndex;
 
         uint16_t
-            thresStartPoint = 0,
             numLines,
-            maxNumSpawn,  //How many lines we'll try to spawn each cycle (starts as maxNumSpawnBase and increases with time)
-            maxNumLines = 0,  //used for tracking the memory size of the pixelArray
+            maxNumSpawn,  //How many lines we'll spawn each cycle (starts as maxNumSpawnBase and increases with time)
             maxNumCycles = 0,
             lineNum,
             numSpawned = 0,
@@ -271,6 +249,9 @@ class DissolveSL : public EffectBasePS {
             flipFlop = true,
             randColorPicked = false;
 
+        randPermPS
+            dissolvePerm = {};  //The random order of the lines for the current dissolve
+
         CRGB
             pickDissolveColor(),
             getPatternColor(uint8_t patIndex),
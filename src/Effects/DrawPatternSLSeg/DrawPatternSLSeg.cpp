@@ -41,8 +41,8 @@ DrawPatternSLSeg::DrawPatternSLSeg(SegmentSetPS &SegSet, CRGB Color, uint16_t Co
 
 //destructor
 DrawPatternSLSeg::~DrawPatternSLSeg() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //initialization of core variables and pointers
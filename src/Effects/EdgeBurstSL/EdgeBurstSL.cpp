@@ -41,7 +41,8 @@ EdgeBurstSL::EdgeBurstSL(SegmentSetPS &SegSet, uint8_t numColors, bool Randomize
 }
 
 EdgeBurstSL::~EdgeBurstSL() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(lineColors.colorArr);
 }
 
 //initialize core vars
@@ -82,7 +83,6 @@ void EdgeBurstSL::update() {
 
         //fetch some core vars
         //we re-fetch these in case the segment set or palette has changed
-        numSegs = segSet->numSegs;
         numLines = segSet->numLines;
 
         //Get the blend length for each color in the palette
@@ -105,7 +105,10 @@ void EdgeBurstSL::update() {
             pickStartPoint();
         }
 
-        //set a color for each line and then color in all the pixels on the line
+        //Make sure we have space to store a color for each line
+        segDrawUtils::resizeLineColors(lineColors, numLines);
+
+        //set a color for each line
         for( uint16_t i = 0; i < numLines; i++ ) {
 
             f = (uint32_t)(i * 255) / numLines;
@@ -125,14 +128,12 @@ void EdgeBurstSL::update() {
                 nscale8x3(colorOut.r, colorOut.g, colorOut.b, v);
             }
 
-            for( uint16_t j = 0; j < numSegs; j++ ) {
-                //get the physical pixel location based on the line and seg numbers
-                //and then write out the color
-                //Note that the actual line written to is offset and wraps
-                pixelNum = segDrawUtils::getPixelNumFromLineNum(*segSet, j, addMod16PS(i, offset, numLines));
-                segDrawUtils::setPixelColor(*segSet, pixelNum, colorOut, 0, 0, 0);
-            }
+            lineColors.colorArr[i] = colorOut;
         }
+
+        //Then color in all the pixels on each line in one pass
+        //Note that the actual line written to is offset and wraps
+        segDrawUtils::drawLineColors(*segSet, lineColors, offset, false);
         showCheckPS();
     }
 }
@@ -168,9 +168,7 @@ class EdgeBurstSL : public EffectBasePS {
         uint16_t
             offset = 0,
             blendLength,
-            pixelNum,
-            numLines,
-            numSegs;
+            numLines;
 
         bool
             offsetFlipFlop = true;
@@ -178,6 +176,9 @@ class EdgeBurstSL : public EffectBasePS {
         CRGB
             colorOut;
 
+        lineColorsPS
+            lineColors = {nullptr, 0, 0};  //Must init structs w/ pointers set to null for safety
+
         void
             init(SegmentSetPS &SegSet, uint16_t Rate),
             pickStartPoint();
@@ -1,3 +1,16 @@
 #include "EffectBasePS.h"
 
-EffectBasePS::~EffectBasePS(){};
\ No newline at end of file
+EffectBasePS::~EffectBasePS(){};
+
+//Default quality hook, does nothing, since most effects don't have a way to lower their quality
+void EffectBasePS::setQuality(uint8_t /*newQuality*/){}
+
+//Allocates memory for an effect created using new, placing it in the library arena if it's active
+void *EffectBasePS::operator new(size_t size) noexcept {
+    return memUtilsPS::allocPS(size);
+}
+
+//Frees an effect's memory when it is deleted (does nothing if the effect is in the library arena)
+void EffectBasePS::operator delete(void *ptr) {
+    memUtilsPS::freePS(ptr);
+}
\ No newline at end of file
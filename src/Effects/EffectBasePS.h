@@ -4,6 +4,8 @@
 //TODO: Add virtual reset() function (also add it to EffectSet), not all effects have reset()'s
 
 #include "Include_Lists/SegmentFiles.h"
+#include "Memory_Stuff/memUtilsPS.h"
+#include "Random_Stuff/randUtilsPS.h"
 
 //macros
 
@@ -44,6 +46,10 @@ and use BgColor in your constructors */
 contains:
     update() interface method (all effects must have an update method)
     a SegmentSetPS pointer to access the effect's SegmentSetPS from outside the effect
+    a random number stream for the effect (see randStreamPS.h)
+    new and delete operators that allocate effects using memUtilsPS::allocPS(), so they can be placed in a memory arena.
+        !!Because of this, new returns nullptr if there isn't enough memory, rather than throwing an exception,
+        so check your effect pointers after creating them
     a few macros for common effect code pieces (see above) */
 class EffectBasePS {
     public:
@@ -63,14 +69,34 @@ class EffectBasePS {
         SegmentSetPS
             *segSet = nullptr;
 
+        //The last time (ms) the effect was let through by an EffectSetPS throttling slow utilities (see EffectSetPS.h)
+        unsigned long
+            throttleTime = 0;
+
+        //The effect's own stream of random numbers, used by random effects in place of FastLED's random8() and random16()
+        //It's unseeded by default, but you can seed it to get repeatable output, see randStreamPS.h
+        randStreamPS
+            randStream = {};
+
         //virtual update function to be implemented in each effect
         //making it virtual so that the update functions of effects can be called from the EffectBase class
         //This is used in the EffectGroup class to update multiple effects
         virtual void update() = 0;
 
+        //Quality hook for the EffectSetPS frame governor (see EffectSetPS.h)
+        //255 is full quality, lower values ask the effect to do less work each update (ie spawn fewer twinkles)
+        //Effects that can trade quality for speed override this, by default it does nothing
+        virtual void setQuality(uint8_t newQuality);
+
         //similar to the virtual update function, allows the deletion of any class instance derived from
         //the EffectBase class
         virtual ~EffectBasePS() = 0;
+
+        //Effects created using new are allocated using memUtilsPS::allocPS()
+        //so that they are placed in the library memory arena if it is active (see memArenaPS.h)
+        //If there isn't enough memory, new returns nullptr (rather than throwing), so check the result
+        static void *operator new(size_t size) noexcept;
+        static void operator delete(void *ptr);
 };
 
 #endif
\ No newline at end of file
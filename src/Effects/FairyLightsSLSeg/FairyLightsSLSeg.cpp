@@ -34,9 +34,9 @@ FairyLightsSLSeg::FairyLightsSLSeg(SegmentSetPS &SegSet, uint16_t NumTwinkles, C
 
 //destructor
 FairyLightsSLSeg::~FairyLightsSLSeg() {
-    free(paletteTemp.paletteArr);
-    free(colorSet);
-    free(twinkleSet);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(colorSet);
+    memUtilsPS::freePS(twinkleSet);
 }
 
 void FairyLightsSLSeg::init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate) {
@@ -76,11 +76,11 @@ void FairyLightsSLSeg::setNumTwinkles(uint16_t newNumTwinkles) {
     if( alwaysResizeObj_PS || (numTwinkles > maxNumTwinkles) ) {
         maxNumTwinkles = numTwinkles;
 
-        free(twinkleSet);
-        twinkleSet = (uint16_t *)malloc(numTwinkles * sizeof(uint16_t));
+        memUtilsPS::freePS(twinkleSet);
+        twinkleSet = (uint16_t *)memUtilsPS::allocPS(numTwinkles * sizeof(uint16_t));
 
-        free(colorSet);
-        colorSet = (CRGB *)malloc(numTwinkles * sizeof(CRGB));
+        memUtilsPS::freePS(colorSet);
+        colorSet = (CRGB *)memUtilsPS::allocPS(numTwinkles * sizeof(CRGB));
     }
 
     reset();
@@ -89,7 +89,7 @@ void FairyLightsSLSeg::setNumTwinkles(uint16_t newNumTwinkles) {
 //creates an palette of length 1 containing the passed in color
 //binds it to the temp palette to keep it in scope
 void FairyLightsSLSeg::setSingleColor(CRGB Color) {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
     paletteTemp = paletteUtilsPS::makeSingleColorPalette(Color);
     palette = &paletteTemp;
 }
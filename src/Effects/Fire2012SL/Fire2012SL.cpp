@@ -13,32 +13,23 @@ Fire2012SL::Fire2012SL(SegmentSetPS &SegSet, palettePS &Palette, CRGB BgColor, u
 }
 
 Fire2012SL::~Fire2012SL() {
-    free(heat);
+    memUtilsPS::freePS(heatGrid.cellArr);
+    memUtilsPS::freePS(heatLut.lutArr);
 }
 
-//resets the effect and creates new heat arrays
+//resets the effect and creates a new heat grid
 //call this if you change segment sets or sections
+//The grid's memory is only re-allocated if it needs to be larger (see gridUtilsPS::resizeGrid())
+//All the heats are reset to 0
 void Fire2012SL::reset() {
 
     //fetch some core vars
     numSegs = segSet->numSegs;
     numLines = segSet->numLines;
-    uint16_t numPoints = numLines * numSegs;
-
-    //create the heat array to store temperatures of each line point
-    //We only need to make a new heat array if the current one isn't large enough
-    //This helps prevent memory fragmentation by limiting the number of heap allocations
-    //but this may use up more memory overall.
-    if( alwaysResizeObj_PS || (numPoints > maxNumPoints) ) {
-        maxNumPoints = numPoints;
-        free(heat);
-        heat = (uint8_t *)malloc(numPoints * sizeof(uint8_t));
-    }
 
-    //Reset the heats in the heat array
-    for( uint16_t i = 0; i < numPoints; i++ ) {
-        heat[i] = 0;
-    }
+    //create the heat grid, with a column for each segment line (fire) and a row for each segment
+    gridUtilsPS::resizeGridToSegSet(heatGrid, *segSet);
+    heat = gridUtilsPS::getCurField(heatGrid);
 }
 
 /* Updates the effect
@@ -48,7 +39,9 @@ Overall the effect manages a heat array of uint8_t's, with each pixel in the seg
 heat (temperature) value
 These heat values are heated and cooled with each update cycle, producing the flame effect
 Each segment line has it's own separate fire simulation
-We use a single array heat to manage multiple segments by splitting it into sections of lengths equal to the number of segments
+The heats are stored in a cell grid, with each segment line being a column of the grid, and each segment a row
+So each column of the grid is a fire, running from the first row (segment) to the last
+The whole grid is cooled and drifted in one go, with the drift run as a grid kernel (see gridUtilsPS.h)
 Within a fire, colors taken from a palette and blended together to create a smooth flame (see setPixelHeatColorPalette() for info) */
 void Fire2012SL::update() {
     currentTime = millis();
@@ -66,41 +59,46 @@ void Fire2012SL::update() {
         //we divide by paletteLength + 1 because we need to include a section for the background
         paletteSecLen = 255 / (paletteLength + 1);
 
-        //For each segment line do the following:
-        for( uint16_t i = 0; i < numLines; i++ ) {
+        //Make sure the heat color LUT matches the current palette, bgColor, and blend settings
+        if( useLut ) {
+            fire2012SegUtilsPS::updateHeatLut(heatLut, palette, bgColor, blend);
+        }
 
-            heatSecStart = i * numSegs;  // current segment line's start index in the heat array
+        //The cooling limit is the same for all the segment lines
+        coolMax = ((cooling * 10) / numSegs) + 2;
 
-            //Step 1. Cool down every cell a little
-            for( uint16_t j = 0; j < numSegs; j++ ) {
+        //Step 1. Cool down every cell a little
+        //(subtracts a random cooling factor from each heat, stopping at 0)
+        //The cooling is the same for every fire, so we can cool the whole grid at once
+        fire2012SegUtilsPS::coolHeat(randStream, gridUtilsPS::getCurField(heatGrid), numLines * numSegs, coolMax);
 
-                heatIndex = j + heatSecStart;  // adjusted index for heat array
-                //subtract a random cooling factor from the current heat (qsub8 prevents running past 0)
-                heat[heatIndex] = qsub8(heat[heatIndex], random8(0, ((cooling * 10) / numSegs) + 2));
-            }
+        //Step 2. Heat from each cell drifts 'up' and diffuses a little
+        //(the edge mode doesn't matter, since the kernel only reads cells behind it along each fire)
+        gridUtilsPS::applyKernel(heatGrid, fire2012SegUtilsPS::diffuseHeatKernel, 2);
+        heat = gridUtilsPS::getCurField(heatGrid);
 
-            //Step 2. Heat from each cell drifts 'up' and diffuses a little
-            for( uint16_t j = (numSegs - 1); j >= 2; j-- ) {
-                heatIndex = j + heatSecStart;  // adjusted index for heat array
-                heat[heatIndex] = (heat[heatIndex - 1] + heat[heatIndex - 2] + heat[heatIndex - 2]) / 3;
-            }
-
-            //Step 3. Randomly ignite new 'sparks' near the bottom
-            if( random8(255) < sparking ) {
+        //Step 3. For each segment line, randomly ignite new 'sparks' near the bottom
+        for( uint16_t i = 0; i < numLines; i++ ) {
+            if( randUtilsPS::rand8(randStream, 255) < sparking ) {
                 //pick a random pixel near the start of the strip
                 //default is 7, but we'll lower this for shorter segments
                 sparkPoint = 7;
                 if( numSegs < sparkPoint ) {
                     sparkPoint = 2;
                 }
-                heatIndex = random8(sparkPoint) + heatSecStart;  // adjusted index for heat array
+                heatIndex = randUtilsPS::rand8(randStream, sparkPoint) * numLines + i;  // adjusted index for heat grid
                 //add a random bit of heat (qadd8 keeps within 255)
-                heat[heatIndex] = qadd8(heat[heatIndex], random8(160, 255));
+                heat[heatIndex] = qadd8(heat[heatIndex], randUtilsPS::rand8(randStream, 160, 255));
                 //heat[heatIndex] = heat[heatIndex] + random8(160, 255);
             }
+        }
 
-            //Step 4. For each flame, convert heat to palette colors colors and output
-            //Also adjust for the direction of the flame
+        //Step 4. For each flame, convert heat to palette colors colors and output
+        //Also adjust for the direction of the flame
+        //With the LUT we can draw the grid directly, reversing the rows (segments) if the fires are reversed
+        if( useLut ) {
+            gridUtilsPS::drawGrid(*segSet, heatGrid, heatLut.lutArr, !direct);
+        } else {
             for( uint16_t j = 0; j < numSegs; j++ ) {
 
                 //if the flames are reversed, then we reverse which segment we're writing the temperature out to
@@ -110,13 +108,14 @@ void Fire2012SL::update() {
                     segNum = j;
                 }
 
-                //get the physical pixel location based on the line and seg numbers
-                ledLoc = segDrawUtils::getPixelNumFromLineNum(*segSet, segNum, i);
-                //write out the temperature color
-                colorOut = fire2012SegUtilsPS::getPixelHeatColorPalette(palette, paletteLength, paletteSecLen,
-                                                                        bgColor, heat[j + heatSecStart], blend);
+                for( uint16_t i = 0; i < numLines; i++ ) {
+                    //get the physical pixel location based on the line and seg numbers
+                    ledLoc = segDrawUtils::getPixelNumFromLineNum(*segSet, segNum, i);
+                    colorOut = fire2012SegUtilsPS::getPixelHeatColorPalette(palette, paletteLength, paletteSecLen,
+                                                                            bgColor, heat[j * numLines + i], blend);
 
-                segDrawUtils::setPixelColor(*segSet, ledLoc, colorOut, 0, 0, 0);
+                    segDrawUtils::setPixelColor(*segSet, ledLoc, colorOut, 0, 0, 0);
+                }
             }
         }
         showCheckPS();
@@ -6,6 +6,7 @@
 #include "Effects/EffectBasePS.h"
 #include "GeneralUtils/generalUtilsPS.h"
 #include "Effects/Fire2012Seg/Utils/fire2012UtilsPS.h"
+#include "Grid_Stuff/gridUtilsPS.h"
 
 /* 
 A classic, traditional fire loop, most useful for strips with a diffuser
@@ -44,7 +45,8 @@ Recommended update rate for the effect is 30-80ms
 
 This effect is not compatible with color modes, but the bgColor is a pointer, so you can bind it
 
-Note that the effect stores a uint8_t value for heat for each heat point
+The fire is run on a cell grid (see cellGridPS.h), with a column for each segment line and a row for each segment.
+The grid is double buffered, so the effect stores two uint8_t heat values for each heat point
 The number of heat points is numLines * numberOfSegments (see segment.h for more info)
 so watch your memory usage
 
@@ -71,6 +73,12 @@ Constructor Inputs:
               true starts the fire at the first segment, false, at the last.
     rate -- The update rate (ms) (recommended between 30-80ms)
 
+Other Settings:
+    useLut (default true, false on AVR chips) -- If true, the fire colors will be taken from a look up table (LUT) 
+                                                of the colors for each heat, which is much faster than working out each pixel's color. 
+                                                The LUT is re-built automatically if the palette, bgColor, or blend settings change.
+                                                The LUT takes 768 bytes of memory (plus 3 per palette color), so it's turned off by default on AVR chips.
+
 Functions:
     reset() -- Resets the effect, use this if you change any segment lengths
     update() -- updates the effect 
@@ -83,13 +91,17 @@ class Fire2012SL : public EffectBasePS {
         ~Fire2012SL();
 
         uint8_t
-            *heat = nullptr,
+            *heat = nullptr,  //points to the current heats in the heatGrid, is updated each update
             cooling,
             sparking;
 
+        cellGridPS
+            heatGrid = {};  //the grid of heats, one for each segment line point (see cellGridPS.h)
+
         bool
             direct,
-            blend;
+            blend,
+            useLut = FIRE_USE_LUT_PS;
 
         CRGB
             bgColorOrig,
@@ -108,7 +120,7 @@ class Fire2012SL : public EffectBasePS {
             prevTime = 0;
 
         uint8_t
-            cooldown,
+            coolMax,
             paletteLength,
             paletteSecLen,
             sparkPoint;
@@ -117,13 +129,14 @@ class Fire2012SL : public EffectBasePS {
             numLines,
             numSegs,
             segNum,
-            heatSecStart,
             heatIndex,
-            maxNumPoints = 0,  //used for tracking the memory size of the heat array
             ledLoc;
 
         CRGB
             colorOut;
+
+        fireHeatLutPS
+            heatLut = {};  //Must init structs w/ pointers set to null for safety
 };
 
 #endif
\ No newline at end of file
@@ -13,8 +13,9 @@ Fire2012Seg::Fire2012Seg(SegmentSetPS &SegSet, palettePS &Palette, CRGB BgColor,
 }
 
 Fire2012Seg::~Fire2012Seg() {
-    free(heat);
-    free(heatSegStarts);
+    memUtilsPS::freePS(heat);
+    memUtilsPS::freePS(heatLut.lutArr);
+    memUtilsPS::freePS(heatSegStarts);
 }
 
 //resets the effect and creates new heat arrays
@@ -29,13 +30,13 @@ void Fire2012Seg::reset() {
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || (numLeds > maxNumLeds) ) {
         maxNumLeds = numLeds;
-        free(heat);
-        heat = (uint8_t *)malloc(numLeds * sizeof(uint8_t));
+        memUtilsPS::freePS(heat);
+        heat = (uint8_t *)memUtilsPS::allocPS(numLeds * sizeof(uint8_t));
 
         //For storing the local starting points for each segment's heat
         //(see comments below)
-        free(heatSegStarts);
-        heatSegStarts = (uint16_t *)malloc(numSegs * sizeof(uint16_t));
+        memUtilsPS::freePS(heatSegStarts);
+        heatSegStarts = (uint16_t *)memUtilsPS::allocPS(numSegs * sizeof(uint16_t));
     }
 
     //The heat array works by storing heat values at points on the strip
@@ -81,6 +82,11 @@ void Fire2012Seg::update() {
     if( (currentTime - prevTime) >= *rate ) {
         prevTime = currentTime;
 
+        //Make sure the heat color LUT matches the current palette, bgColor, and blend settings
+        if( useLut ) {
+            fire2012SegUtilsPS::updateHeatLut(heatLut, palette, bgColor, blend);
+        }
+
         //For each segment do the following:
         for( uint16_t i = 0; i < numSegs; i++ ) {
             //get the length of the segment we're working on
@@ -89,47 +95,37 @@ void Fire2012Seg::update() {
             heatSecStart = heatSegStarts[i];  // current segment's start index in the heat array
 
             //Step 1. Cool down every cell a little
-            for( uint16_t j = 0; j < segLength; j++ ) {
-
-                heatIndex = j + heatSecStart;  // adjusted index for heat array
-                //subtract a random cooling factor from the current heat (qsub8 prevents running past 0)
-                heat[heatIndex] = qsub8(heat[heatIndex], random8(0, ((cooling * 10) / segLength) + 2));
-                //cooldown = random(0, ((cooling * 10) / segLength) + 2) ;
-
-                // if cooldown would turn off a pixel, turn if off,
-                // otherwise just cool it down
-                //if (cooldown > heat[heatIndex]) {
-                //heat[heatIndex] = 0;
-                //} else {
-                //heat[heatIndex] = heat[heatIndex] - cooldown;
-                //}
-            }
+            //(subtracts a random cooling factor from each heat, stopping at 0)
+            coolMax = ((cooling * 10) / segLength) + 2;
+            fire2012SegUtilsPS::coolHeat(randStream, heat + heatSecStart, segLength, coolMax);
 
             //Step 2. Heat from each cell drifts 'up' and diffuses a little
-            for( uint16_t k = (segLength - 1); k >= 2; k-- ) {
-                heatIndex = k + heatSecStart;  // adjusted index for heat array
-                heat[heatIndex] = (heat[heatIndex - 1] + heat[heatIndex - 2] + heat[heatIndex - 2]) / 3;
-            }
+            fire2012SegUtilsPS::diffuseHeat(heat + heatSecStart, segLength);
 
             //Step 3. Randomly ignite new 'sparks' near the bottom
-            if( random8(255) < sparking ) {
+            if( randUtilsPS::rand8(randStream, 255) < sparking ) {
                 // pick a random pixel near the start of the strip
                 //default is 7, but we'll lower this for shorter segments
                 sparkPoint = 7;
                 if( segLength < sparkPoint ) {
                     sparkPoint = 2;
                 }
-                heatIndex = random8(sparkPoint) + heatSecStart;  // adjusted index for heat array
+                heatIndex = randUtilsPS::rand8(randStream, sparkPoint) + heatSecStart;  // adjusted index for heat array
                 // add a random bit of heat (qadd8 keeps within 255)
-                heat[heatIndex] = qadd8(heat[heatIndex], random8(160, 255));
+                heat[heatIndex] = qadd8(heat[heatIndex], randUtilsPS::rand8(randStream, 160, 255));
                 //heat[heatIndex] = heat[heatIndex] + random8(160, 255);
             }
 
             //Step 4. For each flame, convert heat to palette colors colors and output
             for( uint16_t k = 0; k < segLength; k++ ) {
                 ledLoc = segDrawUtils::getSegmentPixel(*segSet, i, k);  //the physical location of the led
-                colorOut = fire2012SegUtilsPS::getPixelHeatColorPalette(palette, paletteLength, paletteSecLen,
-                                                                        bgColor, heat[k + heatSecStart], blend);
+                //Get the heat's color, either from the LUT, or by working it out directly
+                if( useLut ) {
+                    colorOut = heatLut.lutArr[heat[k + heatSecStart]];
+                } else {
+                    colorOut = fire2012SegUtilsPS::getPixelHeatColorPalette(palette, paletteLength, paletteSecLen,
+                                                                            bgColor, heat[k + heatSecStart], blend);
+                }
 
                 segDrawUtils::setPixelColor(*segSet, ledLoc, colorOut, 0, 0, 0);
             }
@@ -60,6 +60,12 @@ Constructor Inputs:
             Blended fires are smoother, but need more processing power
     rate -- The update rate (ms) (recommended between 30-80ms)
 
+Other Settings:
+    useLut (default true, false on AVR chips) -- If true, the fire colors will be taken from a look up table (LUT) 
+                                                of the colors for each heat, which is much faster than working out each pixel's color. 
+                                                The LUT is re-built automatically if the palette, bgColor, or blend settings change.
+                                                The LUT takes 768 bytes of memory (plus 3 per palette color), so it's turned off by default on AVR chips.
+
 Functions:
     reset() -- Resets the effect, use this if you change any segment lengths
     update() -- updates the effect 
@@ -80,7 +86,8 @@ class Fire2012Seg : public EffectBasePS {
             *heatSegStarts = nullptr;
 
         bool
-            blend;
+            blend,
+            useLut = FIRE_USE_LUT_PS;
 
         CRGB
             bgColorOrig,
@@ -99,7 +106,7 @@ class Fire2012Seg : public EffectBasePS {
             prevTime = 0;
 
         uint8_t
-            cooldown,
+            coolMax,
             paletteLength,
             paletteSecLen,
             sparkPoint;
@@ -115,6 +122,9 @@ class Fire2012Seg : public EffectBasePS {
 
         CRGB
             colorOut;
+
+        fireHeatLutPS
+            heatLut = {};  //Must init structs w/ pointers set to null for safety
 };
 
 #endif
\ No newline at end of file
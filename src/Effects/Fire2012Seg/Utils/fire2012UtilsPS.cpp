@@ -70,6 +70,117 @@ CRGB fire2012SegUtilsPS::getPixelHeatColorPalette(palettePS *palette, uint8_t pa
 }
 
 
+//Cools each heat in the passed in heat section by a random amount between 0 and coolMax (inclusive of 0, exclusive of coolMax)
+//The heats are cooled with a saturating subtraction, so they stop at 0
+//The random amounts are drawn from the passed in random stream (see randStreamPS.h)
+//Matches cooling each heat using heat = qsub8(heat, rand8(randStream, 0, coolMax)), but works four heats at a time:
+//A single 32 bit random word from the stream gives us four random bytes, which are each scaled to the coolMax at once
+//by splitting the bytes into two pairs of 16 bit lanes, so the multiplications don't overflow into each other.
+//The scaled amounts are then subtracted from the four heats in one go, using bit masks to find
+//any heats that would go below 0 (saturate) and clamping them.
+//The heats are loaded/stored a byte at a time since the sections are not word aligned in the heat array.
+void fire2012SegUtilsPS::coolHeat(randStreamPS &randStream, uint8_t *heatSec, uint16_t secLength, uint8_t coolMax) {
+    uint16_t i = 0;
+    uint32_t randWord, coolWord, heatWord, diffWord, borrowWord;
+
+    for( ; (i + 4) <= secLength; i += 4 ) {
+        randWord = randUtilsPS::rand32(randStream);
+
+        //Scale each random byte to coolMax, ie (byte * coolMax) >> 8
+        //The even bytes and odd bytes are done separately so that each product has 16 bits to itself
+        coolWord = (((randWord & 0x00FF00FF) * coolMax) >> 8) & 0x00FF00FF;
+        coolWord |= (((randWord >> 8) & 0x00FF00FF) * coolMax) & 0xFF00FF00;
+
+        heatWord = (uint32_t)heatSec[i] | ((uint32_t)heatSec[i + 1] << 8) |
+                   ((uint32_t)heatSec[i + 2] << 16) | ((uint32_t)heatSec[i + 3] << 24);
+
+        //Subtract each byte without borrowing across bytes
+        //(we set the top bit of each heat byte so that each byte subtraction can't borrow from the next byte,
+        //and then fix the top bits back up using the xor)
+        diffWord = ((heatWord | 0x80808080) - (coolWord & 0x7F7F7F7F)) ^ ((heatWord ^ ~coolWord) & 0x80808080);
+
+        //Find the bytes that would have borrowed (ie the cooling was larger than the heat)
+        //and turn them into 0xFF byte masks to clear the bytes (so they saturate at 0)
+        borrowWord = ((~heatWord & coolWord) | (~(heatWord ^ coolWord) & diffWord)) & 0x80808080;
+        borrowWord = (borrowWord >> 7) * 0xFF;
+        diffWord &= ~borrowWord;
+
+        heatSec[i] = diffWord;
+        heatSec[i + 1] = diffWord >> 8;
+        heatSec[i + 2] = diffWord >> 16;
+        heatSec[i + 3] = diffWord >> 24;
+    }
+
+    //Cool any leftover heats one at a time
+    for( ; i < secLength; i++ ) {
+        heatSec[i] = qsub8(heatSec[i], randUtilsPS::rand8(randStream, 0, coolMax));
+    }
+}
+
+//Drifts the heats in the passed in heat section "up" (towards the section end), spreading it a little
+//Each heat is set to (heat[i - 1] + heat[i - 2] * 2) / 3, using the heats from before the drift
+//(The first two heats are not changed)
+//We work from the end of the section backwards so that we only ever read heats that haven't been updated yet,
+//keeping the two previous heats in variables so we only need to read one heat from the array each step
+void fire2012SegUtilsPS::diffuseHeat(uint8_t *heatSec, uint16_t secLength) {
+    if( secLength < 3 ) {
+        return;
+    }
+
+    uint8_t prevHeat1 = heatSec[secLength - 2], prevHeat2;
+    for( uint16_t i = secLength - 1; i >= 2; i-- ) {
+        prevHeat2 = heatSec[i - 2];
+        heatSec[i] = ((uint16_t)prevHeat1 + prevHeat2 + prevHeat2) / 3;
+        prevHeat1 = prevHeat2;
+    }
+}
+
+//A grid kernel version of diffuseHeat(), where each grid column is a fire, with row 0 at its start
+//Each cell is set to (cell one row back + cell two rows back * 2) / 3, the cells in the first two rows are not changed
+//The cell two rows back is outside the kernel's 3x3 neighborhood, so we read it from the current field (see cellGridPS.h)
+uint8_t fire2012SegUtilsPS::diffuseHeatKernel(cellNbhdPS &nbhd) {
+    if( nbhd.row < 2 ) {
+        return nbhd.cells[4];
+    }
+    uint8_t prevHeat2 = nbhd.curField[(uint32_t)(nbhd.row - 2) * nbhd.numCols + nbhd.col];
+    return ((uint16_t)nbhd.cells[1] + prevHeat2 + prevHeat2) / 3;
+}
+
+//Makes sure the heat LUT matches the passed in palette, background color, and blend setting
+//re-building the LUT if anything has changed (including the palette's colors)
+//The palette's colors are checked against a copy of them stored with the LUT, so any color change is caught
+//The LUT is always 256 colors long, but its memory block also holds the palette copy,
+//so it's only re-sized if the palette gets longer
+//Returns true if the LUT was re-built
+bool fire2012SegUtilsPS::updateHeatLut(fireHeatLutPS &heatLut, palettePS *palette, CRGB *bgColor, bool blend) {
+    if( heatLut.lutArr && heatLut.palette == palette && heatLut.paletteLength == palette->length &&
+        heatLut.bgColor == *bgColor && heatLut.blend == blend &&
+        paletteUtilsPS::paletteColorsMatch(*palette, heatLut.paletteColors) ) {
+        return false;
+    }
+
+    lutLength = 256 + palette->length;
+    if( alwaysResizeObj_PS || (lutLength > heatLut.maxLength) ) {
+        memUtilsPS::freePS(heatLut.lutArr);
+        heatLut.lutArr = (CRGB *)memUtilsPS::allocPS(lutLength * sizeof(CRGB));
+        heatLut.maxLength = lutLength;
+    }
+    heatLut.paletteColors = heatLut.lutArr + 256;
+
+    heatLut.palette = palette;
+    heatLut.paletteLength = palette->length;
+    paletteUtilsPS::copyPaletteColors(*palette, heatLut.paletteColors);
+    heatLut.bgColor = *bgColor;
+    heatLut.blend = blend;
+
+    //Fill in the color for each heat, using the same palette vars as the fire effects
+    uint8_t paletteSecLen = 255 / (palette->length + 1);
+    for( uint16_t i = 0; i < 256; i++ ) {
+        heatLut.lutArr[i] = getPixelHeatColorPalette(palette, palette->length, paletteSecLen, bgColor, i, blend);
+    }
+    return true;
+}
+
 /* 
 //Original implementation of the setPixelHeatColorPalette()
 //Works exactly the same, but the scaling is done manually
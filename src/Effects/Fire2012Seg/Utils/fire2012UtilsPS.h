@@ -11,17 +11,43 @@
 
 #include "Include_Lists/PaletteFiles.h"
 #include "ColorUtils/colorUtilsPS.h"
-
-//common functions for Fire2012 (and possibly other) effects
+#include "Memory_Stuff/memUtilsPS.h"
+#include "Random_Stuff/randUtilsPS.h"
+#include "Grid_Stuff/cellGridPS.h"
+#include "fireHeatLutPS.h"
+
+/*
+common functions for Fire2012 (and possibly other) effects
+Includes a set of functions for running the fire simulation over whole heat sections in one go:
+    coolHeat() -- Cools a section of heats using a random amount for each, 
+                  processing four heats at a time using 32 bit words ("SIMD within a register").
+    diffuseHeat() -- Drifts the heat up a section, spreading it out as it goes.
+    diffuseHeatKernel() -- The same heat drift as a grid kernel, for fires run on a cell grid (see gridUtilsPS.h).
+                           Each grid column is a fire, with the heat drifting from row 0 upwards.
+    updateHeatLut() -- Keeps a heat to color look up table up to date (see fireHeatLutPS.h).
+The heat sections must be contiguous in the heat array (they are in both Fire2012Seg and Fire2012SL). */
 namespace fire2012SegUtilsPS {
 
     CRGB
         getPixelHeatColorPalette(palettePS *palette, uint8_t paletteLength, uint8_t paletteSecLen, CRGB *bgColor, uint8_t temperature, bool blend);
 
+    void  //Functions for the fire simulation
+        coolHeat(randStreamPS &randStream, uint8_t *heatSec, uint16_t secLength, uint8_t coolMax),
+        diffuseHeat(uint8_t *heatSec, uint16_t secLength);
+
+    uint8_t
+        diffuseHeatKernel(cellNbhdPS &nbhd);
+
+    bool  //Functions for the heat color LUT
+        updateHeatLut(fireHeatLutPS &heatLut, palettePS *palette, CRGB *bgColor, bool blend);
+
     static uint8_t
         secHeatLimit,
         colorIndex;
 
+    static uint16_t
+        lutLength;
+
     static bool
         doBg;
 
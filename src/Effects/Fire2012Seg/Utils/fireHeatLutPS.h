@@ -0,0 +1,48 @@
+#ifndef fireHeatLutPS_h
+#define fireHeatLutPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "FastLED.h"
+#include "Include_Lists/PaletteFiles.h"
+
+//Fire effects use a heat color LUT by default, except on AVR chips, where the LUT's 768 bytes (plus a copy of the palette) are a large chunk of memory
+#ifdef __AVR__
+    #define FIRE_USE_LUT_PS false
+#else
+    #define FIRE_USE_LUT_PS true
+#endif
+
+/*
+A struct for storing a heat to color look up table (LUT) for fire effects.
+Working out a fire pixel's color from its heat (see fire2012SegUtilsPS::getPixelHeatColorPalette()) 
+involves scaling the heat to the palette and blending between palette colors, which is done for every pixel, every update.
+However, there are only 256 possible heats, so we can work out the color for each heat once, 
+store them in the LUT, and then just look up each pixel's color using its heat.
+
+The LUT is re-built automatically whenever its palette, background color, or blend setting changes 
+(including changes to the palette's colors), see fire2012SegUtilsPS::updateHeatLut().
+To catch changes to the palette's colors, the LUT keeps a copy of them (after the LUT colors, in the same memory block),
+which is compared to the palette each update. The comparison is exact, so the LUT is never left with old colors.
+
+You shouldn't need to set any of the struct's variables yourself, they are managed by fire2012SegUtilsPS::updateHeatLut().
+Like with other structs, it must be initialized with its pointers set to null:
+    fireHeatLutPS heatLut = {}; //Must init structs w/ pointers set to null for safety
+!!The LUT is created dynamically, so make sure you free it when you're done by calling memUtilsPS::freePS(heatLut.lutArr). */
+struct fireHeatLutPS {
+    CRGB *lutArr;          //pointer to the LUT array, 256 colors (one for each heat), followed by the paletteColors
+    CRGB *paletteColors;   //a copy of the palette's colors when the LUT was built (stored in the same memory block as the lutArr)
+    palettePS *palette;    //the palette the LUT was built with
+    uint16_t maxLength;    //The total length of the lutArr memory block, used for memory management (see patternPS for more)
+    uint8_t paletteLength; //the length of the palette when the LUT was built
+    CRGB bgColor;          //the background color the LUT was built with
+    bool blend;            //the blend setting the LUT was built with
+};
+
+#endif
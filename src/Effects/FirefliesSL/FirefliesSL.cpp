@@ -33,9 +33,9 @@ FirefliesSL::FirefliesSL(SegmentSetPS &SegSet, CRGB Color, uint16_t MaxNumFirefl
 FirefliesSL::~FirefliesSL() {
     //Free all the dynamic arrays and the firefly particle set
     particleUtilsPS::freeParticleSet(particleSetTemp);
-    free(trailEndColors);
-    free(particlePrevPos);
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(trailEndColors);
+    memUtilsPS::freePS(particlePrevPos);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
 }
 
 //common initialization function for core vars
@@ -74,11 +74,11 @@ void FirefliesSL::setupFireflies(uint16_t newMaxNumFireflies) {
     if( alwaysResizeObj_PS || !particleSet || (maxNumFireflies > particleSet->maxLength) ) {
 
         //delete and re-create all the arrays and the particle set
-        free(trailEndColors);
-        trailEndColors = (CRGB *)malloc(maxNumFireflies * sizeof(CRGB));
+        memUtilsPS::freePS(trailEndColors);
+        trailEndColors = (CRGB *)memUtilsPS::allocPS(maxNumFireflies * sizeof(CRGB));
 
-        free(particlePrevPos);
-        particlePrevPos = (uint16_t *)malloc(maxNumFireflies * sizeof(uint16_t));
+        memUtilsPS::freePS(particlePrevPos);
+        particlePrevPos = (uint16_t *)memUtilsPS::allocPS(maxNumFireflies * sizeof(uint16_t));
 
         //free the existing particles, and the particle array pointer
         particleUtilsPS::freeParticleSet(particleSetTemp);
@@ -33,9 +33,15 @@ FireworksPS::FireworksPS(SegmentSetPS &SegSet, CRGB Color, uint8_t MaxNumFirewor
 FireworksPS::~FireworksPS() {
     //Free all the dynamic arrays and the firework particle set
     particleUtilsPS::freeParticleSet(particleSetTemp);
-    free(fireWorkActive);
-    free(trailEndColors);
-    free(paletteTemp.paletteArr);
+    particleUtilsPS::freeParticlePool(sparkPool);
+    memUtilsPS::freePS(fireWorkActive);
+    memUtilsPS::freePS(fireworkCenters);
+    memUtilsPS::freePS(fireworkSparkCounts);
+    memUtilsPS::freePS(sparkFireworks);
+    memUtilsPS::freePS(trailEndColors);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(bgCache.pixelArr);
+    memUtilsPS::freePS(bgCache.segLayout.segPtrArr);
 }
 
 //common initialization function for core vars
@@ -58,14 +64,17 @@ void FireworksPS::init(uint8_t maxNumFireworks, uint8_t maxNumSparks, SegmentSet
 /* Create the data structures for a set of fireworks
 You should call this if you ever want to change maxNumFireworks or maxNumSparks
 Will reset all fireworks, and clear the segment set of any lingering particles by re-filling the background
-Fireworks need three data structures:
-    A bool array fireworks[maxNumFireworks] that stores if a firework is active or not
+Fireworks need the following data structures:
+    A bool array fireWorkActive[maxNumFireworks] that stores if a firework is active or not
+    Arrays of each firework's center particle index and its number of live sparks
     A particleSet with a particle array of size maxNumFireworks * (maxNumSparks + 1)
+    A particle pool of the same size, for tracking which particles are active (see particlePoolPS.h)
     A CRGB array of trailEndColors[maxNumFireworks * (maxNumSparks + 1)] to store the trail color for each particle
+    A uint8_t array of the same size, to store which firework each particle is part of
     (We have an extra particle for the center "bomb" particle)
 Note that we're using a single 1D array for all the particles from all the fireworks
-This is easier that creating a 2D array with rows for each firework
-To get the particles in a specific firework, we use fireworkNum * maxNumSparks + i where 0 -> i -> maxNumSparks
+When a firework is spawned, it takes its particles from the free particles in the pool
+Since a firework is only re-spawned once all its particles are dead, there's always enough free particles to spawn a firework
 The minimum number of fireworks and sparks is 1 */
 void FireworksPS::setupFireworks(uint8_t newMaxNumFireworks, uint8_t newMaxNumSparks) {
 
@@ -94,11 +103,20 @@ void FireworksPS::setupFireworks(uint8_t newMaxNumFireworks, uint8_t newMaxNumSp
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || !particleSet || (numParticles > particleSet->maxLength) ) {
     
-        free(trailEndColors);
-        trailEndColors = (CRGB *)malloc(numParticles * sizeof(CRGB));
+        memUtilsPS::freePS(trailEndColors);
+        trailEndColors = (CRGB *)memUtilsPS::allocPS(numParticles * sizeof(CRGB));
 
-        free(fireWorkActive);
-        fireWorkActive = (bool *)malloc(maxNumFireworks * sizeof(bool));
+        memUtilsPS::freePS(fireWorkActive);
+        fireWorkActive = (bool *)memUtilsPS::allocPS(maxNumFireworks * sizeof(bool));
+
+        memUtilsPS::freePS(fireworkCenters);
+        fireworkCenters = (uint16_t *)memUtilsPS::allocPS(maxNumFireworks * sizeof(uint16_t));
+
+        memUtilsPS::freePS(fireworkSparkCounts);
+        fireworkSparkCounts = (uint8_t *)memUtilsPS::allocPS(maxNumFireworks * sizeof(uint8_t));
+
+        memUtilsPS::freePS(sparkFireworks);
+        sparkFireworks = (uint8_t *)memUtilsPS::allocPS(numParticles * sizeof(uint8_t));
 
         //Free all particles and the particle array pointer
         particleUtilsPS::freeParticleSet(particleSetTemp);
@@ -112,9 +130,13 @@ void FireworksPS::setupFireworks(uint8_t newMaxNumFireworks, uint8_t newMaxNumSp
     //This "hides" any unused particles from the rest of the effect
     particleSet->length = numParticles;
 
+    //Set all the particles as free in the pool (the pool manages its own memory size)
+    particleUtilsPS::resizeParticlePool(sparkPool, numParticles);
+
     //set all the fireworks to inactive, ready to be spawned
     for( uint8_t i = 0; i < maxNumFireworks; i++ ) {
         fireWorkActive[i] = false;
+        fireworkSparkCounts[i] = 0;
     }
 }
 
@@ -122,26 +144,26 @@ void FireworksPS::setupFireworks(uint8_t newMaxNumFireworks, uint8_t newMaxNumSp
 Note: This effect uses particles: see more info in particlePS.h and particleUtilsPS.h
 Overall we have a series of fireworks that each have their own set of sparks (particles)
 When a firework is spawned fireWorkActive[i] is set true (see setupFireworks() for more on the firework's data structure)
-and the firework's particles are re-spawned with random life, speeds, etc
+and the firework takes particles from the particle pool, which are spawned with random life, speeds, etc
 (see spawnFirework() for more on spawning)
-The update cycle moves particles for active fireworks, draws them, updates their life, and
-confirms if the firework is inactive. If it is, we try to spawn it again.
+The update cycle moves the active particles, draws them, updates their life, and
+returns any dead particles to the pool. Once all of a firework's particles are dead the firework is inactive,
+and we try to spawn it again.
 The update cycle is actually fairly simple despite how much code there is.
 One important note is that we re-draw any active particles even if they haven't moved
 Particles dim whenever they are re-drawn, so even slow particles dim fairly quickly
 This may seem like it's not the right way to do it, but it looks good in practice
 because we tie the speed and life together when spawning particles (see spawnFirework())
 The update operations in order:
-    If it's time to update we get check each firework
-        If a firework is active we check each of the sparks (particles) in the firework
-            If they're active (life > 0) then we:
+    If it's time to update we check each active spark (particle) from the pool
+            For each one we:
                 Check if it's time to move them, and then do so
                 If they moved, fill-in the background in their previous position
                 Then re-draw the particle itself, we always re-draw
                 any active particles incase their colors have changed, even if they didn't move
                 As part of the drawing, particles have their life decreased
                 If it hits 0 (or the particle runs off the edges of the strip)
-                the particle is deactivated
+                the particle is deactivated and returned to the pool
                 if all the particles in a firework are in-active, then the firework is inactive
         Once all the fireworks have been drawn, we try to spawn any that are inactive
         When spawned, all the particles start in one spawn location, and then spread out when updated
@@ -158,107 +180,110 @@ void FireworksPS::update() {
         //if the bg is to be filled before the particles start, fill it in
         //(such as if you have a background that's changing with time (alla bgColorMode 6))
         if( fillBg || blend ) {
-            segDrawUtils::fillSegSetColor(*segSet, *bgColor, bgColorMode);
+            if( cacheBg ) {
+                segDrawUtils::fillSegSetColorCached(*segSet, bgCache, *bgColor, bgColorMode);
+            } else {
+                segDrawUtils::fillSegSetColor(*segSet, *bgColor, bgColorMode);
+            }
         }
 
-        //For each firework, we check if it's active and then update any of its active particles
-        for( uint8_t i = 0; i < maxNumFireworks; i++ ) {
-            if( fireWorkActive[i] ) {
-                //We set the firework as inactive here before we check the sparks (particles)
-                //If any particle is active then the firework is active and fireWorkActive[i] will be set true
-                fireWorkActive[i] = false;
-                //Check each particle, if it's active, move and draw it
-                for( uint8_t j = 0; j < maxNumSparks; j++ ) {
-                    //The first particle in the array is always the unmoving center "bomb" particle
-                    //(see spawnFirework())
-                    //This particle is drawn slightly differently then the others, so we set the flag here
-                    firstPart = false;
-                    if( j == 0 ) { firstPart = true; }
-
-                    //the particle's location in the particleSet array
-                    particleIndex = i * maxNumSparks + j;
-                    //get the pointer to the particle in the particle set
-                    particlePtr = particleSet->particleArr[particleIndex];
-                    partLife = particlePtr->life;
-
-                    //if the particle is alive, we need to update it
-                    if( partLife > 0 ) {
-                        //if we have any active particles in the firework, then the firework is active
-                        fireWorkActive[i] = true;
-                        //record some particle vars locally for ease of access
-                        partPos = particlePtr->position;      //the current position of the particle
-                        partSpeed = particlePtr->speed;       //the speed of the particle
-                        partDirect = particlePtr->direction;  //the direction of motion (true moves towards the last pixel in the segmentSet)
-                        partSize = particlePtr->size;         //the length of the main body of the particle
-                        partMaxLife = particlePtr->maxLife;   //the particle's maximum life
-
-                        //get the particle's color from the palette
-                        colorOut = paletteUtilsPS::getPaletteColor(*palette, particlePtr->colorIndex);
-
-                        //The maxPosition is the maximum position of the particle
-                        //This includes a "phantom zone" off the strip of size partSize
-                        //Where the particle exists, but isn't drawn. This is to accommodate
-                        //particles of size > 1, so that they fully move off the strip
-                        //IGNORE ABOVE, KEPT FOR CONTEXT, particle isn't allowed to run off strip
-                        maxPosition = numLEDs;  // + partSize;
-
-                        //if enough time has passed, we need to move the particle
-                        movePart = ((currentTime - particlePtr->lastUpdateTime) >= partSpeed);
-                        //if the particle needs to move, move it and record the time
-                        if( movePart ) {
-                            particlePtr->lastUpdateTime = currentTime;
-                            moveParticle(particlePtr);
-                        }
-
-                        //get the multiplier for the direction (1 or -1)
-                        directStep = particleUtilsPS::getDirectStep(partDirect);
-
-                        //if we're not filling in the background each cycle
-                        //we need to set the previous particle position to the background
-                        if( !fillBg && !blend ) {
-                            //get the previous particle location (the trail is always 1 behind the particle)
-                            trailLedLocation = getTrailLedLoc(1);
-                            //get the physical pixel location and the color it's meant to be
-                            segDrawUtils::getPixelColor(*segSet, trailLedLocation, &pixelInfo, *bgColor, bgColorMode);
-
-                            //only turn off the pixel if it hasn't been touched by another particle (or something else)
-                            //this prevents background holes from being placed in other particles
-                            if( segSet->leds[pixelInfo.pixelLoc] == trailEndColors[particleIndex] ) {
-                                segSet->leds[pixelInfo.pixelLoc] = pixelInfo.color;
-                                //Need to check to dim the pixel color manually
-                                //b/c we're not calling setPixelColor directly
-                                segDrawUtils::handleBri(*segSet, pixelInfo.pixelLoc);
-                            }
-                        }
-
-                        //reduce the particle's life by the amount of time passed in ms
-                        //once the particle's life hits 0 it is deactivated
-                        //(We re-fetch partLife incase it's been set to zero because the particle has moved off the strip)
-                        partLife = particlePtr->life;
-                        if( ((int32_t(partLife) - deltaTime) <= 0) || partLife == 0 ) {
-                            partLife = 0;
-                        } else {
-                            partLife -= deltaTime;
-                        }
-                        particlePtr->life = partLife;
-
-                        //draw the main particle
-                        //we always start at the particle's head and move opposite the direction of motion
-                        for( uint16_t k = 0; k < partSize; k++ ) {
-
-                            //the body postion, for size 1 particles, this is just it position
-                            trailLedLocation = addMod16PS(partPos, maxPosition - (k * directStep), maxPosition);
-
-                            //Draw the body pixel
-                            drawParticlePixel(particlePtr, trailLedLocation);
-                            //segDrawUtils::setPixelColor(segSet, 0, 0, bgColorMode);
-                            //The pixel that needs to be set to background
-                            //is the last pixel in the particle body, so we record it's color
-                            if( k == (partSize - 1) ) {
-                                trailEndColors[particleIndex] = segSet->leds[pixelInfo.pixelLoc];
-                            }
-                        }
-                    }
+        //For each active particle, move and draw it
+        //We go backwards through the active particles so that we can de-spawn particles as we go (see particlePoolPS.h)
+        for( uint16_t i = sparkPool.numActive; i > 0; i-- ) {
+            //the particle's location in the particleSet array
+            particleIndex = sparkPool.activeList[i - 1];
+            //the firework the particle is part of
+            fireworkNum = sparkFireworks[particleIndex];
+
+            //Each firework has an unmoving center "bomb" particle (see spawnFirework())
+            //This particle is drawn slightly differently then the others, so we set the flag here
+            firstPart = (particleIndex == fireworkCenters[fireworkNum]);
+
+            //get the pointer to the particle in the particle set
+            particlePtr = particleSet->particleArr[particleIndex];
+            partLife = particlePtr->life;
+
+            //record some particle vars locally for ease of access
+            partPos = particlePtr->position;      //the current position of the particle
+            partSpeed = particlePtr->speed;       //the speed of the particle
+            partDirect = particlePtr->direction;  //the direction of motion (true moves towards the last pixel in the segmentSet)
+            partSize = particlePtr->size;         //the length of the main body of the particle
+            partMaxLife = particlePtr->maxLife;   //the particle's maximum life
+
+            //get the particle's color from the palette
+            colorOut = paletteUtilsPS::getPaletteColor(*palette, particlePtr->colorIndex);
+
+            //The maxPosition is the maximum position of the particle
+            //This includes a "phantom zone" off the strip of size partSize
+            //Where the particle exists, but isn't drawn. This is to accommodate
+            //particles of size > 1, so that they fully move off the strip
+            //IGNORE ABOVE, KEPT FOR CONTEXT, particle isn't allowed to run off strip
+            maxPosition = numLEDs;  // + partSize;
+
+            //if enough time has passed, we need to move the particle
+            movePart = ((currentTime - particlePtr->lastUpdateTime) >= partSpeed);
+            //if the particle needs to move, move it and record the time
+            if( movePart ) {
+                particlePtr->lastUpdateTime = currentTime;
+                moveParticle(particlePtr);
+            }
+
+            //get the multiplier for the direction (1 or -1)
+            directStep = particleUtilsPS::getDirectStep(partDirect);
+
+            //if we're not filling in the background each cycle
+            //we need to set the previous particle position to the background
+            if( !fillBg && !blend ) {
+                //get the previous particle location (the trail is always 1 behind the particle)
+                trailLedLocation = getTrailLedLoc(1);
+                //get the physical pixel location and the color it's meant to be
+                segDrawUtils::getPixelColor(*segSet, trailLedLocation, &pixelInfo, *bgColor, bgColorMode);
+
+                //only turn off the pixel if it hasn't been touched by another particle (or something else)
+                //this prevents background holes from being placed in other particles
+                if( segSet->leds[pixelInfo.pixelLoc] == trailEndColors[particleIndex] ) {
+                    segSet->leds[pixelInfo.pixelLoc] = pixelInfo.color;
+                    //Need to check to dim the pixel color manually
+                    //b/c we're not calling setPixelColor directly
+                    segDrawUtils::handleBri(*segSet, pixelInfo.pixelLoc);
+                }
+            }
+
+            //reduce the particle's life by the amount of time passed in ms
+            //once the particle's life hits 0 it is deactivated
+            //(We re-fetch partLife incase it's been set to zero because the particle has moved off the strip)
+            partLife = particlePtr->life;
+            if( ((int32_t(partLife) - deltaTime) <= 0) || partLife == 0 ) {
+                partLife = 0;
+            } else {
+                partLife -= deltaTime;
+            }
+            particlePtr->life = partLife;
+
+            //draw the main particle
+            //we always start at the particle's head and move opposite the direction of motion
+            for( uint16_t k = 0; k < partSize; k++ ) {
+
+                //the body postion, for size 1 particles, this is just it position
+                trailLedLocation = addMod16PS(partPos, maxPosition - (k * directStep), maxPosition);
+
+                //Draw the body pixel
+                drawParticlePixel(particlePtr, trailLedLocation);
+                //segDrawUtils::setPixelColor(segSet, 0, 0, bgColorMode);
+                //The pixel that needs to be set to background
+                //is the last pixel in the particle body, so we record it's color
+                if( k == (partSize - 1) ) {
+                    trailEndColors[particleIndex] = segSet->leds[pixelInfo.pixelLoc];
+                }
+            }
+
+            //If the particle's life has run out, it is inactive, so we return it to the pool
+            //if all the particles in a firework are in-active, then the firework is inactive
+            if( partLife == 0 ) {
+                particleUtilsPS::despawnPoolParticle(sparkPool, particleIndex);
+                fireworkSparkCounts[fireworkNum]--;
+                if( fireworkSparkCounts[fireworkNum] == 0 ) {
+                    fireWorkActive[fireworkNum] = false;
                 }
             }
         }
@@ -378,6 +403,7 @@ This particle doesn't move and has its life set to centerLife */
 void FireworksPS::spawnFirework(uint8_t fireworkNum) {
     //set the particle to active
     fireWorkActive[fireworkNum] = true;
+    fireworkSparkCounts[fireworkNum] = maxNumSparks;
     //get a spawn position, not too close to the edge of the strip
     uint16_t spawnPos = random16(numLEDs / spawnRangeDiv, numLEDs - numLEDs / spawnRangeDiv);
     //pick a starting direction at random
@@ -393,10 +419,11 @@ void FireworksPS::spawnFirework(uint8_t fireworkNum) {
 
     //For each particle in the firework, randomize its properties
     //and then set this spawn position and life
-    //Note that we skip the first index, that is for the center "bomb" particle set separately below
+    //Note that we skip the first spark, that is for the center "bomb" particle set separately below
     for( uint8_t i = 1; i < maxNumSparks; i++ ) {
-        //the index of the particle we're setting
-        particleIndex = fireworkNum * maxNumSparks + i;
+        //take a free particle from the pool for the spark
+        particleIndex = particleUtilsPS::spawnPoolParticle(sparkPool);
+        sparkFireworks[particleIndex] = fireworkNum;
 
         initDirect = !initDirect;  //swap the particle direction
         //if each of the particles is to have a random color, pick it here
@@ -426,16 +453,25 @@ void FireworksPS::spawnFirework(uint8_t fireworkNum) {
         //lifeBase + random16(lifeRange); ->alternate, more even formula
         particlePtr->life = particlePtr->maxLife;
 
+        //Particles with no life are never drawn, so we can return them to the pool right away
+        if( particlePtr->life == 0 ) {
+            particleUtilsPS::despawnPoolParticle(sparkPool, particleIndex);
+            fireworkSparkCounts[fireworkNum]--;
+        }
+
         //we need to store the trailEndColor for size 1 particles
         //otherwise, when they next update, trailEndColors will be empty
         trailEndColors[particleIndex] = *burstColor;
     }
 
     //set up the center "bomb" particle properties
-    //this is the first particle in each firework particle array
+    //It is spawned last from the pool, so that it is drawn before the other sparks
+    //(we draw the active particles in reverse spawn order)
     //Note that we set the particle speed to 65000 (65 sec), and the lastUpdateTime to millis()
     //so that it probably won't move before it decays
-    particleIndex = fireworkNum * maxNumSparks;
+    particleIndex = particleUtilsPS::spawnPoolParticle(sparkPool);
+    sparkFireworks[particleIndex] = fireworkNum;
+    fireworkCenters[fireworkNum] = particleIndex;
     particlePtr = particleSet->particleArr[particleIndex];
     particleUtilsPS::randomizeParticle(*particleSet, particleIndex, 0, true, 65000, 0, centerSize, 0,
                                        0, 0, 0, false, randColorIndex, false);
@@ -170,6 +170,10 @@ Other Settings:
     centerSize (default 3) -- How large the center "bomb" burst is 
     fillBg (default false) -- Sets whether to fill the background in every update cycle,
                               You should set this true if you are using an animated background mode
+    cacheBg (default true, false on AVR chips) -- If true, the background colors are cached when the background is re-drawn each update,
+                                                 so they can be copied straight back to the pixels, rather than being re-calculated.
+                                                 The cache is re-built automatically whenever the background changes (see bgCachePS.h).
+                                                 It uses 5 bytes of memory per pixel, so it's turned off by default on AVR chips.
     blend (default false) -- Causes sparks to add their colors to the strip, rather than set them
                              See explanation of this in more detail above in effect intro
     randSparkColors (default false) -- If true, each spark will have its own color picked from the palette
@@ -231,6 +235,7 @@ class FireworksPS : public EffectBasePS {
 
         bool
             fillBg = false,
+            cacheBg = BG_USE_CACHE_PS,
             blend = false,
             randSparkColors = false,
             *fireWorkActive = nullptr;
@@ -266,7 +271,10 @@ class FireworksPS : public EffectBasePS {
         uint8_t
             sizeAdj,
             dimRatio,
-            randColorIndex;
+            randColorIndex,
+            fireworkNum,
+            *fireworkSparkCounts = nullptr,  //the number of live particles in each firework
+            *sparkFireworks = nullptr;       //the firework that each particle is part of
 
         uint16_t
             particleIndex,
@@ -279,6 +287,7 @@ class FireworksPS : public EffectBasePS {
             trailLedLocation,
             deltaTime,
             numLEDs,
+            *fireworkCenters = nullptr,  //the particle index of each firework's center "bomb" particle
             getTrailLedLoc(uint8_t trailPixelNum);
 
         bool
@@ -289,6 +298,9 @@ class FireworksPS : public EffectBasePS {
         particlePS
             *particlePtr = nullptr;
 
+        particlePoolPS
+            sparkPool = {nullptr};  //tracks which particles are active (Must init structs w/ pointers set to null for safety)
+
         pixelInfoPS
             pixelInfo = {0, 0, 0, 0};
 
@@ -297,6 +309,9 @@ class FireworksPS : public EffectBasePS {
             colorOut,
             colorTemp;
 
+        bgCachePS
+            bgCache = {};  //Must init structs w/ pointers set to null for safety
+
         void
             init(uint8_t maxNumFireworks, uint8_t maxNumSparks, SegmentSetPS &SegSet),
             moveParticle(particlePS *particlePtr),
@@ -0,0 +1,269 @@
+#include "FramePlayerPS.h"
+
+//Constructor using the frame time from the frame file as the rate
+FramePlayerPS::FramePlayerPS(SegmentSetPS &SegSet, frameSourcePS &FrameSource, CRGB BgColor, bool Loop)
+    : loop(Loop)  //
+{
+    init(BgColor, SegSet, 0);
+    setFrameSource(FrameSource);
+}
+
+//Constructor with a set rate
+FramePlayerPS::FramePlayerPS(SegmentSetPS &SegSet, frameSourcePS &FrameSource, CRGB BgColor, bool Loop, uint16_t Rate)
+    : loop(Loop)  //
+{
+    init(BgColor, SegSet, Rate);
+    setFrameSource(FrameSource);
+}
+
+FramePlayerPS::~FramePlayerPS() {
+    memUtilsPS::freePS(frameArr);
+    memUtilsPS::freePS(paletteFile.paletteArr);
+    memUtilsPS::freePS(frameReader.chunkArr);
+}
+
+//Binds all the effect's core vars
+//If the rate is 0, we use the frame time from the frame file
+void FramePlayerPS::init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate) {
+    //bind the rate and segSet pointer vars since they are inherited from BaseEffectPS
+    bindSegSetPtrPS();
+    bindClassRatesPS();
+    //bind background color pointer
+    bindBGColorPS();
+
+    useFileRate = (Rate == 0);
+}
+
+/* Sets the effect's frame file source (see frameSourcePS.h)
+Reads in the frame file's header and palette, and sets up the effect's frame buffer and chunk buffer
+(like other library objects, these are only re-allocated if they need to grow, unless alwaysResizeObj_PS is true).
+The effect's palette is set to the file's palette, and if useFileRate is true, the effect's rate is set to the file's frame time.
+Returns true if the file is valid, otherwise the effect is stopped (valid is set false) */
+bool FramePlayerPS::setFrameSource(frameSourcePS &newFrameSource) {
+    frameSource = &newFrameSource;
+    valid = false;
+
+    frameUtilsPS::setupReader(frameReader, *frameSource, chunkSize);
+
+    //The header is 14 bytes long, starting with "PSF" and the version number (1)
+    if( frameUtilsPS::getBytesLeft(frameReader) < 14 ) {
+        return false;
+    }
+
+    frameUtilsPS::readBytes(frameReader, headerArr, 4);
+    if( headerArr[0] != 'P' || headerArr[1] != 'S' || headerArr[2] != 'F' || headerArr[3] != 1 ) {
+        return false;
+    }
+
+    pixelFormat = frameUtilsPS::readUint8(frameReader);
+    paletteFile.length = frameUtilsPS::readUint8(frameReader);
+    frameWidth = frameUtilsPS::readUint16(frameReader);
+    frameHeight = frameUtilsPS::readUint16(frameReader);
+    numFrames = frameUtilsPS::readUint16(frameReader);
+    frameTime = frameUtilsPS::readUint16(frameReader);
+
+    if( pixelFormat > 1 || numFrames == 0 || frameWidth == 0 || frameHeight == 0 ) {
+        return false;
+    }
+
+    if( useFileRate ) {
+        rateOrig = frameTime;
+    }
+
+    //Read in the file's palette (only used by palette-indexed frames)
+    //We read the colors straight into the palette, since CRGB's are stored as red, green, blue bytes
+    if( pixelFormat == 0 ) {
+        if( paletteFile.length == 0 ) {
+            return false;
+        }
+
+        if( alwaysResizeObj_PS || (paletteFile.length > paletteMaxLength) ) {
+            memUtilsPS::freePS(paletteFile.paletteArr);
+            paletteFile.paletteArr = (CRGB *)memUtilsPS::allocPS(paletteFile.length * sizeof(CRGB));
+            paletteMaxLength = paletteFile.length;
+        }
+
+        if( !readFrameBytes((uint8_t *)paletteFile.paletteArr, paletteFile.length * 3) ) {
+            return false;
+        }
+    }
+    palette = &paletteFile;
+
+    //Set up the frame buffer, which stores the current frame,
+    //its cleared so that any pixels not drawn by the first frame are blank
+    bytesPerPixel = (pixelFormat == 0) ? 1 : 3;
+    numPixels = (uint32_t)frameWidth * frameHeight;
+    frameLength = numPixels * bytesPerPixel;
+
+    if( alwaysResizeObj_PS || (frameLength > frameMaxLength) ) {
+        memUtilsPS::freePS(frameArr);
+        frameArr = (uint8_t *)memUtilsPS::allocPS(frameLength);
+        frameMaxLength = frameLength;
+    }
+    memset(frameArr, 0, frameLength);
+
+    //The frames start right after the header and palette
+    firstFramePos = frameReader.pos;
+    valid = true;
+    reset();
+    return valid;
+}
+
+//Restarts the frames from the first frame
+void FramePlayerPS::reset() {
+    frameNum = 0;
+    done = false;
+    frameUtilsPS::seekReader(frameReader, firstFramePos);
+}
+
+/* Updates the effect
+Each update we read in the next frame from the frame file into the frame buffer (see readFrame()),
+and then draw the frame buffer onto the segment set.
+Once we've played all the frames, we either restart from the first frame (if we're looping), 
+or just keep drawing the last frame. */
+void FramePlayerPS::update() {
+    currentTime = millis();
+
+    if( (currentTime - prevTime) >= *rate ) {
+        prevTime = currentTime;
+
+        //If the frame file is invalid, there's nothing to draw
+        if( !valid ) {
+            return;
+        }
+
+        //Restart the frames once they're done if we're looping
+        if( frameNum >= numFrames ) {
+            if( loop ) {
+                reset();
+            } else {
+                done = true;
+            }
+        }
+
+        if( !done ) {
+            if( !readFrame() ) {
+                valid = false;
+                return;
+            }
+            frameNum++;
+        }
+
+        drawFrame();
+
+        showCheckPS();
+    }
+}
+
+//Reads the next frame in the frame file into the frame buffer (frameArr)
+//Key frames replace the whole frame buffer, while delta frames only replace the "spans" of pixels that have changed
+//Returns false if the frame could not be read (ie the file is corrupt)
+bool FramePlayerPS::readFrame() {
+    if( frameUtilsPS::getBytesLeft(frameReader) < 1 ) {
+        return false;
+    }
+
+    frameType = frameUtilsPS::readUint8(frameReader);
+
+    if( frameType == 0 ) {
+        //Key frame, the whole frame is stored
+        return readFrameBytes(frameArr, frameLength);
+    } else if( frameType == 1 ) {
+        //Delta frame, only the spans of changed pixels are stored
+        //each span is the number of pixels to skip from the end of the last span, the span length, and then the span's pixels
+        if( frameUtilsPS::getBytesLeft(frameReader) < 2 ) {
+            return false;
+        }
+        numSpans = frameUtilsPS::readUint16(frameReader);
+
+        pixelIndex = 0;
+        for( uint16_t i = 0; i < numSpans; i++ ) {
+            if( frameUtilsPS::getBytesLeft(frameReader) < 4 ) {
+                return false;
+            }
+            spanSkip = frameUtilsPS::readUint16(frameReader);
+            spanLength = frameUtilsPS::readUint16(frameReader);
+
+            //Make sure the span doesn't run off the end of the frame
+            pixelIndex += spanSkip;
+            if( pixelIndex + spanLength > numPixels ) {
+                return false;
+            }
+
+            if( !readFrameBytes(frameArr + pixelIndex * bytesPerPixel, (uint32_t)spanLength * bytesPerPixel) ) {
+                return false;
+            }
+            pixelIndex += spanLength;
+        }
+        return true;
+    }
+
+    //Unknown frame type
+    return false;
+}
+
+//Reads "len" bytes from the frame file into "buf"
+//(frameUtilsPS::readBytes() only reads up to 65535 bytes at once, so we read larger lengths in pieces)
+//Returns false if the end of the file was reached before all the bytes were read
+bool FramePlayerPS::readFrameBytes(uint8_t *buf, uint32_t len) {
+    uint16_t readLen;
+    while( len > 0 ) {
+        readLen = (len > 65535) ? 65535 : len;
+        if( frameUtilsPS::readBytes(frameReader, buf, readLen) != readLen ) {
+            return false;
+        }
+        buf += readLen;
+        len -= readLen;
+    }
+    return true;
+}
+
+//Draws the frame buffer onto the segment set
+//Each frame pixel (x, y) is drawn on segment line x of segment y, offset by the lineOffset and segOffset
+//skipping any pixels that are off the segment set
+void FramePlayerPS::drawFrame() {
+    numLines = segSet->numLines;
+    numSegs = segSet->numSegs;
+
+    for( uint16_t i = 0; i < frameHeight; i++ ) {
+        //Skip any frame rows that are off the segment set
+        if( (int32_t)i + segOffset < 0 || (int32_t)i + segOffset >= numSegs ) {
+            continue;
+        }
+        segNum = i + segOffset;
+
+        for( uint16_t j = 0; j < frameWidth; j++ ) {
+            //Skip any frame pixels that are off the segment set
+            if( (int32_t)j + lineOffset < 0 || (int32_t)j + lineOffset >= numLines ) {
+                continue;
+            }
+            lineNum = j + lineOffset;
+
+            pixelIndex = (uint32_t)i * frameWidth + j;
+
+            //Get the frame pixel's color
+            //For palette-indexed frames, an index of 255 is the background
+            if( pixelFormat == 0 ) {
+                colorIndex = frameArr[pixelIndex];
+                if( colorIndex == 255 ) {
+                    if( !drawBg ) {
+                        continue;
+                    }
+                    colorOut = *bgColor;
+                    modeOut = bgColorMode;
+                } else {
+                    colorOut = paletteUtilsPS::getPaletteColor(*palette, colorIndex);
+                    modeOut = 0;
+                }
+            } else {
+                pixelIndex *= 3;
+                colorOut = CRGB(frameArr[pixelIndex], frameArr[pixelIndex + 1], frameArr[pixelIndex + 2]);
+                modeOut = 0;
+            }
+
+            //get the physical pixel location and output the color
+            pixelNum = segDrawUtils::getPixelNumFromLineNum(*segSet, segNum, lineNum);
+            segDrawUtils::setPixelColor(*segSet, pixelNum, colorOut, modeOut, segNum, lineNum);
+        }
+    }
+}
@@ -0,0 +1,195 @@
+#ifndef FramePlayerPS_h
+#define FramePlayerPS_h
+
+#include "Effects/EffectBasePS.h"
+#include "GeneralUtils/generalUtilsPS.h"
+#include "Utils/frameUtilsPS.h"
+
+//The size of the chunks the effect reads frame files in (for files not in memory, see frameSourcePS.h)
+//A smaller size is used on AVR chips to save memory
+#ifdef __AVR__
+    #define FRAME_CHUNK_SIZE_PS 32
+#else
+    #define FRAME_CHUNK_SIZE_PS 512
+#endif
+
+/* 
+Plays a set of pre-rendered frames on a segment set, like a video or an animated sprite.
+The frames are stored in a "frame file", which could be converted from a video, 
+or baked from a more complex generative animation that would be too slow to run live. 
+The frame file can be in memory (or memory-mapped), or can be streamed in chunks from an SD card, external flash, etc.
+See frameSourcePS.h for the frame file format, and how to point the effect at your file.
+
+The frames are drawn in 2D, with each frame pixel being drawn onto a segment line pixel:
+the frame width is the number of segment lines, while the frame height is the number of segments.
+So frame pixel (x, y) is drawn on segment line x of segment y.
+Any parts of the frames that are off the segment set are not drawn.
+You can also move the frames on the segment set by setting the lineOffset and segOffset,
+for example, if you have a small sprite animation that you want to move around.
+
+Frames can either be palette-indexed or full RGB. 
+Palette-indexed frames use the palette stored in the frame file by default (the effect's local "paletteFile"),
+but you can change the effect's palette to re-color the frames, ie frameplayer.palette = &cybPnkPal_PS;
+(note that the palette is reset to the file's palette whenever you set a new frame file).
+Any palette-indexed pixels with an index of 255 will be drawn in the background color (see drawBg below).
+Frame files can also use "delta" frames, which only store the pixels that have changed since the last frame,
+making the file a lot smaller for animations where only part of the image is moving. 
+
+The effect keeps a copy of the current frame, which uses 1 byte per frame pixel for palette-indexed frames,
+or 3 bytes per frame pixel for RGB frames. This, along with the file's palette and the chunk buffer (if not reading from memory),
+is allocated when a frame file is set, so no memory is allocated while the frames are playing.
+
+If the frame file is invalid, or a frame cannot be read, the effect will stop updating (and `valid` will be false).
+
+Example calls: 
+    const uint8_t myFrames[] = { ... }; //your frame file
+    frameSourcePS frameSource = {myFrames, sizeof(myFrames)};
+
+    FramePlayerPS framePlayer(mainSegments, frameSource, 0, true);
+    Will play the frames from myFrames on the mainSegments
+    The background is blank
+    The frames will loop
+    The effect will update at the frame time from the frame file
+
+    FramePlayerPS framePlayer(mainSegments, frameSource, CRGB::Blue, false, 40);
+    Will play the frames from myFrames on the mainSegments
+    The background is blue
+    The frames will play once, with the last frame being held at the end
+    The effect will update at 40ms
+
+Constructor Inputs:
+    frameSource -- The frame file source (see frameSourcePS.h). You can change the source later using setFrameSource().
+    bgColor -- The color used for palette-indexed pixels with an index of 255.
+               It is a pointer, so it can be tied to an external variable. By default it is bound to bgColorOrig.
+    loop -- If true, the frames will restart once they end, 
+            otherwise the last frame will be held at the end (and `done` will be set true)
+    rate (optional, see constructors) -- The update rate (ms). Passing in 0, or leaving it out, 
+                                         will use the frame time from the frame file (see useFileRate below).
+
+Other Settings:
+    bgColorMode (default 0) -- sets the color mode for the background pixels (see segDrawUtils::setPixelColor)
+    drawBg (default true) -- If false, background pixels will not be drawn (they are transparent), 
+                             useful for drawing sprites on top of other effects.
+    lineOffset (default 0) -- Moves the frames along the segment lines (can be negative).
+    segOffset (default 0) -- Moves the frames along the segments (can be negative).
+    useFileRate (default true when the constructor rate is 0) -- If true, the effect's rate will be set 
+                                                                 to the file's frame time when a frame file is set.
+    chunkSize (default 512, 32 on AVR chips) -- The size (bytes) of the chunks the effect reads files in (for files not in memory).
+                                                Only changes when you set a frame file.
+
+Functions:
+    setFrameSource(frameSourcePS &newFrameSource) -- Sets the effect's frame file, reading its header and palette,
+                                                     and setting up the effect's memory. Returns true if the file is valid.
+    reset() -- Restarts the frames from the first frame.
+    update() -- updates the effect 
+
+Reference Vars:
+    frameNum -- The number of frames that have been played since the last restart
+    numFrames -- The number of frames in the frame file
+    frameWidth -- The width of the frames (how many segment lines they span)
+    frameHeight -- The height of the frames (how many segments they span)
+    pixelFormat -- The pixel format of the frames (0 for palette-indexed, 1 for RGB)
+    frameTime -- The time between frames (ms) from the frame file
+    valid -- If false, the frame file is invalid or a frame could not be read, and the effect will not update
+    done -- Set true once all the frames have been played (only if loop is false)
+*/
+class FramePlayerPS : public EffectBasePS {
+    public:
+        //Constructor using the frame time from the frame file as the rate
+        FramePlayerPS(SegmentSetPS &SegSet, frameSourcePS &FrameSource, CRGB BgColor, bool Loop);
+
+        //Constructor with a set rate
+        FramePlayerPS(SegmentSetPS &SegSet, frameSourcePS &FrameSource, CRGB BgColor, bool Loop, uint16_t Rate);
+
+        ~FramePlayerPS();
+
+        uint8_t
+            bgColorMode = 0,
+            pixelFormat = 0;  //for reference only
+
+        int16_t
+            lineOffset = 0,
+            segOffset = 0;
+
+        uint16_t
+            chunkSize = FRAME_CHUNK_SIZE_PS,
+            frameNum = 0,     //for reference only
+            numFrames = 0,    //for reference only
+            frameWidth = 0,   //for reference only
+            frameHeight = 0,  //for reference only
+            frameTime = 0;    //for reference only
+
+        bool
+            loop,
+            drawBg = true,
+            useFileRate,
+            valid = false,  //for reference only
+            done = false;   //for reference only
+
+        CRGB
+            bgColorOrig,
+            *bgColor = nullptr;  //bgColor is a pointer so it can be tied to an external variable if needed (such as a palette color)
+
+        palettePS
+            *palette = nullptr,
+            paletteFile = {nullptr, 0};  //Must init structs w/ pointers set to null for safety
+
+        frameSourcePS
+            *frameSource = nullptr;
+
+        bool
+            setFrameSource(frameSourcePS &newFrameSource);
+
+        void
+            reset(),
+            update(void);
+
+    private:
+        unsigned long
+            currentTime,
+            prevTime = 0;
+
+        uint8_t
+            bytesPerPixel = 1,
+            colorIndex,
+            modeOut,
+            frameType,
+            paletteMaxLength = 0,
+            headerArr[4];
+
+        uint16_t
+            numLines,
+            numSegs,
+            numSpans,
+            spanSkip,
+            spanLength,
+            pixelNum,
+            segNum,
+            lineNum;
+
+        uint32_t
+            numPixels,
+            frameLength,
+            frameMaxLength = 0,
+            firstFramePos,
+            pixelIndex;
+
+        uint8_t
+            *frameArr = nullptr;
+
+        CRGB
+            colorOut;
+
+        frameReaderPS
+            frameReader = {nullptr};  //Must init structs w/ pointers set to null for safety
+
+        bool
+            readFrame(),
+            readFrameBytes(uint8_t *buf, uint32_t len);
+
+        void
+            init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate),
+            drawFrame();
+};
+
+#endif
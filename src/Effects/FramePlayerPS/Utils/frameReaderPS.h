@@ -0,0 +1,33 @@
+#ifndef frameReaderPS_h
+#define frameReaderPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "frameSourcePS.h"
+
+/*
+A struct for reading through a frame file (see frameSourcePS.h) used by the FramePlayerPS effect.
+If the file is not in memory, it is read in chunks into the chunkArr using the source's readFn, 
+so only a small amount of the file is kept in memory at a time. 
+The chunkArr is only allocated once, when the reader is set up, so there is no memory allocation while frames are playing.
+
+You shouldn't need to set any of the struct's variables yourself, they are managed by the frameUtilsPS functions.
+Like with other structs, it must be initialized with its pointers set to null:
+    frameReaderPS frameReader = {nullptr}; //Must init structs w/ pointers set to null for safety
+!!The chunkArr is created dynamically, so make sure you free it when you're done by calling memUtilsPS::freePS(frameReader.chunkArr). */
+struct frameReaderPS {
+    uint8_t *chunkArr;      //the current chunk of the file (not used for files in memory)
+    uint16_t length;        //the number of bytes in the current chunk
+    uint16_t maxLength;     //The total length of the chunkArr, used for memory management (see patternPS for more)
+    frameSourcePS *source;  //the frame file source
+    uint32_t chunkStart;    //the position of the start of the chunk in the file
+    uint32_t pos;           //the current read position in the file
+};
+
+#endif
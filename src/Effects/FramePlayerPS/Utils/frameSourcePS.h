@@ -0,0 +1,69 @@
+#ifndef frameSourcePS_h
+#define frameSourcePS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for pointing the FramePlayerPS effect at a set of pre-rendered frames (a "frame file", see below).
+The frames can be read in one of two ways:
+    1: Directly from memory, by setting dataArr to point to the frame file.
+       Use this if the whole file is in memory, or is memory-mapped,
+       ie mmap()'ed on a computer, or stored in the memory-mapped flash of an ESP32, RP2040, etc.
+       The frames are read straight from the memory, without going through a chunk buffer.
+    2: In chunks, by setting dataArr to nullptr, and providing a "readFn" function.
+       Use this to stream frames from an SD card, external flash, or AVR PROGMEM (which can't be read with a normal pointer).
+       The function must fill "buf" with "len" bytes of the file starting at byte "pos", and return the number of bytes read.
+       The readData pointer is passed to the function each time, so you can use it to pass in your file object, etc.
+In both cases, length is the total length of the file in bytes.
+
+Example sources:
+    //Frames stored in memory
+    const uint8_t myFrames[] = { ... };
+    frameSourcePS frameSource = {myFrames, sizeof(myFrames)};
+
+    //Frames streamed from an SD card
+    File frameFile = SD.open("frames.psf");
+    uint16_t readSdFrames(void *readData, uint32_t pos, uint8_t *buf, uint16_t len){
+        File *file = (File*)readData;
+        file->seek(pos);
+        return file->read(buf, len);
+    }
+    frameSourcePS frameSource = {nullptr, frameFile.size(), readSdFrames, &frameFile};
+
+Frame File Format:
+The frames are stored in a simple binary format. All multi-byte values are little-endian (least significant byte first).
+The file starts with a 14 byte header:
+    Bytes 0 - 2: The characters "PSF" 
+    Byte 3: The format version, currently 1
+    Byte 4: The pixel format:
+            0 -- Palette-indexed, each pixel is a single byte, a palette index. Indexes of 255 are background pixels.
+            1 -- RGB, each pixel is three bytes: red, green, blue.
+    Byte 5: The number of palette colors (0 - 255), only used by the palette-indexed format.
+    Bytes 6 - 7: The frame width, the number of segment lines the frames cover.
+    Bytes 8 - 9: The frame height, the number of segments the frames cover.
+    Bytes 10 - 11: The number of frames.
+    Bytes 12 - 13: The time between frames (ms).
+The header is followed by the palette (if any), stored as red, green, blue bytes for each color.
+Then come the frames, one after another. Each frame starts with a single byte for its type:
+    0 -- A key frame. The frame contains the whole image, width * height pixels,
+         listed segment by segment, ie the first "width" pixels are for segment 0, then segment 1, etc.
+    1 -- A delta frame. The frame only contains the pixels that have changed since the last frame, stored as "spans" of pixels.
+         The frame starts with the number of spans (2 bytes). Then for each span:
+         The number of pixels to skip from the end of the last span (or the start of the image) (2 bytes)
+         The number of pixels in the span (2 bytes), followed by the span's pixels.
+         (pixels are numbered the same as in key frames)
+The first frame must be a key frame (so that the frames can loop). */
+struct frameSourcePS {
+    const uint8_t *dataArr;  //pointer to the frame file if it is in memory (or memory-mapped), otherwise nullptr
+    uint32_t length;         //the length of the frame file (bytes)
+    uint16_t (*readFn)(void *readData, uint32_t pos, uint8_t *buf, uint16_t len);  //function for reading the file in chunks (if dataArr is nullptr)
+    void *readData;          //passed to the readFn, ie a pointer to a file object
+};
+
+#endif
@@ -0,0 +1,99 @@
+#include "frameUtilsPS.h"
+
+//Sets up a frame reader to read the passed in frame file from its start
+//If the file is not in memory, the reader's chunk buffer is sized to "chunkSize" bytes
+//(like other library objects, the buffer is only re-allocated if it needs to grow, unless alwaysResizeObj_PS is true)
+void frameUtilsPS::setupReader(frameReaderPS &frameReader, frameSourcePS &frameSource, uint16_t chunkSize) {
+    frameReader.source = &frameSource;
+
+    if( !frameSource.dataArr ) {
+        if( chunkSize == 0 ) {
+            chunkSize = 1;
+        }
+
+        if( alwaysResizeObj_PS || (chunkSize > frameReader.maxLength) ) {
+            memUtilsPS::freePS(frameReader.chunkArr);
+            frameReader.chunkArr = (uint8_t *)memUtilsPS::allocPS(chunkSize);
+            frameReader.maxLength = chunkSize;
+        }
+    }
+
+    //Clear out any old chunk, since it may be from a different file
+    frameReader.chunkStart = 0;
+    frameReader.length = 0;
+    frameReader.pos = 0;
+}
+
+//Moves the reader to the passed in position (byte) in the file
+//The current chunk is kept if the position is inside it, otherwise a new chunk will be read when needed
+void frameUtilsPS::seekReader(frameReaderPS &frameReader, uint32_t pos) {
+    if( pos < frameReader.chunkStart || pos >= frameReader.chunkStart + frameReader.length ) {
+        frameReader.chunkStart = pos;
+        frameReader.length = 0;
+    }
+    frameReader.pos = pos;
+}
+
+//Returns the number of bytes left to read in the file
+uint32_t frameUtilsPS::getBytesLeft(frameReaderPS &frameReader) {
+    if( frameReader.pos >= frameReader.source->length ) {
+        return 0;
+    }
+    return frameReader.source->length - frameReader.pos;
+}
+
+//Reads "len" bytes from the file into "buf", starting at the reader's current position
+//For files in memory, the bytes are copied straight from the file,
+//otherwise they are copied out of the chunk buffer, reading in new chunks using the source's readFn as needed
+//Returns the number of bytes read, which will be less than "len" if the end of the file is reached
+uint16_t frameUtilsPS::readBytes(frameReaderPS &frameReader, uint8_t *buf, uint16_t len) {
+    if( getBytesLeft(frameReader) < len ) {
+        len = getBytesLeft(frameReader);
+    }
+
+    if( frameReader.source->dataArr ) {
+        memcpy(buf, frameReader.source->dataArr + frameReader.pos, len);
+        frameReader.pos += len;
+        return len;
+    }
+
+    totRead = 0;
+    while( totRead < len ) {
+        //If we've run off the end of the current chunk, read in the next one
+        chunkOffset = frameReader.pos - frameReader.chunkStart;
+        if( frameReader.pos < frameReader.chunkStart || chunkOffset >= frameReader.length ) {
+            frameReader.chunkStart = frameReader.pos;
+            frameReader.length = frameReader.source->readFn(frameReader.source->readData, frameReader.pos,
+                                                            frameReader.chunkArr, frameReader.maxLength);
+            chunkOffset = 0;
+            //Stop if nothing could be read
+            if( frameReader.length == 0 ) {
+                break;
+            }
+        }
+
+        readLen = frameReader.length - chunkOffset;
+        if( readLen > len - totRead ) {
+            readLen = len - totRead;
+        }
+        memcpy(buf + totRead, frameReader.chunkArr + chunkOffset, readLen);
+        totRead += readLen;
+        frameReader.pos += readLen;
+    }
+    return totRead;
+}
+
+//Reads a single byte from the file (returns 0 if at the end of the file)
+uint8_t frameUtilsPS::readUint8(frameReaderPS &frameReader) {
+    byteBuf[0] = 0;
+    readBytes(frameReader, byteBuf, 1);
+    return byteBuf[0];
+}
+
+//Reads a 2 byte value from the file, stored least significant byte first (returns 0 if at the end of the file)
+uint16_t frameUtilsPS::readUint16(frameReaderPS &frameReader) {
+    byteBuf[0] = 0;
+    byteBuf[1] = 0;
+    readBytes(frameReader, byteBuf, 2);
+    return byteBuf[0] | (byteBuf[1] << 8);
+}
@@ -0,0 +1,46 @@
+#ifndef frameUtilsPS_h
+#define frameUtilsPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "Memory_Stuff/memUtilsPS.h"
+#include "./Include_Lists/GlobalVars/GlobalVars.h"  //need alwaysResizeObj_PS
+#include "frameSourcePS.h"
+#include "frameReaderPS.h"
+
+/*
+Functions for reading frame files (see frameSourcePS.h) used by the FramePlayerPS effect.
+Files in memory are read directly, while other files are read in chunks using a frameReaderPS (see frameReaderPS.h). */
+namespace frameUtilsPS {
+
+    void
+        setupReader(frameReaderPS &frameReader, frameSourcePS &frameSource, uint16_t chunkSize),
+        seekReader(frameReaderPS &frameReader, uint32_t pos);
+
+    uint8_t
+        readUint8(frameReaderPS &frameReader);
+
+    uint16_t
+        readUint16(frameReaderPS &frameReader),
+        readBytes(frameReaderPS &frameReader, uint8_t *buf, uint16_t len);
+
+    uint32_t
+        getBytesLeft(frameReaderPS &frameReader);
+
+    //pre-allocated space for function variables
+    static uint16_t
+        readLen,
+        chunkOffset,
+        totRead;
+
+    static uint8_t
+        byteBuf[2];
+};
+
+#endif
@@ -37,9 +37,11 @@ GlimmerSL::GlimmerSL(SegmentSetPS &SegSet, uint16_t NumGlims, CRGB Color, CRGB B
 }
 
 GlimmerSL::~GlimmerSL() {
-    free(fadePixelLocs);
-    free(totFadeSteps);
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(fadePixelLocs);
+    memUtilsPS::freePS(totFadeSteps);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(bgCache.pixelArr);
+    memUtilsPS::freePS(bgCache.segLayout.segPtrArr);
 }
 
 void GlimmerSL::init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate) {
@@ -91,17 +93,17 @@ void GlimmerSL::setupPixelArray() {
         glimArrLenMax = glimArrLen;
 
         //locations of the fading pixels
-        free(fadePixelLocs);
-        fadePixelLocs = (uint16_t *)malloc(glimArrLen * sizeof(uint16_t));
+        memUtilsPS::freePS(fadePixelLocs);
+        fadePixelLocs = (uint16_t *)memUtilsPS::allocPS(glimArrLen * sizeof(uint16_t));
 
         //how many fade steps each pixel will do (how much they will fade by)
-        free(totFadeSteps);
-        totFadeSteps = (uint8_t *)malloc(glimArrLen * sizeof(uint8_t));
+        memUtilsPS::freePS(totFadeSteps);
+        totFadeSteps = (uint8_t *)memUtilsPS::allocPS(glimArrLen * sizeof(uint8_t));
 
         //The palette color index of each pixel
         //Ie what palette color it is
-        free(glimColorArr);
-        glimColorArr = (uint8_t *)malloc(glimArrLen * sizeof(uint8_t));
+        memUtilsPS::freePS(glimColorArr);
+        glimColorArr = (uint8_t *)memUtilsPS::allocPS(glimArrLen * sizeof(uint8_t));
     }
 
     reset();
@@ -203,7 +205,11 @@ void GlimmerSL::update() {
         //but for rainbow or gradient backgrounds that a cycling
         //you want to redraw the whole thing
         if( fillBg ) {
-            segDrawUtils::fillSegSetColor(*segSet, *bgColor, bgColorMode);
+            if( cacheBg ) {
+                segDrawUtils::fillSegSetColorCached(*segSet, bgCache, *bgColor, bgColorMode);
+            } else {
+                segDrawUtils::fillSegSetColor(*segSet, *bgColor, bgColorMode);
+            }
         }
 
         //increment the step, we mod by fadeSteps + 1 because we want to
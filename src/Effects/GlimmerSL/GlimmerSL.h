@@ -85,6 +85,10 @@ Other Settings:
                                if false, glimmers will be drawn on individual pixels (1D), 
                                (see notes in Intro).
     fillBg (default false) -- sets the background to be redrawn every cycle, useful for bgColorModes that are dynamic
+    cacheBg (default true, false on AVR chips) -- If true, the background colors are cached when the background is re-drawn each update,
+                                                 so they can be copied straight back to the pixels, rather than being re-calculated.
+                                                 The cache is re-built automatically whenever the background changes (see bgCachePS.h).
+                                                 It uses 5 bytes of memory per pixel, so it's turned off by default on AVR chips.
 
 Functions:
     setNumGlims(newNumGlims) -- Changes the number of pixels fading,
@@ -140,6 +144,7 @@ class GlimmerSL : public EffectBasePS {
             fadeIn,
             lineMode = true,
             fillBg = false,
+            cacheBg = BG_USE_CACHE_PS,
             twoPixelSets;
 
         CRGB
@@ -188,6 +193,9 @@ class GlimmerSL : public EffectBasePS {
             fadeColor,
             getFadeColor(uint16_t glimNum);
 
+        bgCachePS
+            bgCache = {};  //Must init structs w/ pointers set to null for safety
+
         void
             init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate),
             setupPixelArray(),
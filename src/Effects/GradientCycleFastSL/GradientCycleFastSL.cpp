@@ -28,8 +28,8 @@ GradientCycleFastSL::GradientCycleFastSL(SegmentSetPS &SegSet, uint8_t NumColors
 }
 
 GradientCycleFastSL::~GradientCycleFastSL() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //inits core variables for the effect
@@ -27,8 +27,8 @@ GradientCycleSL::GradientCycleSL(SegmentSetPS &SegSet, uint8_t NumColors, uint8_
 }
 
 GradientCycleSL::~GradientCycleSL() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //inits core variables for the effect
@@ -25,7 +25,7 @@ LarsonScannerSL::~LarsonScannerSL() {
     //Free all particles and the particle array pointer
     particleSet.length = maxNumParticles;  //set the particle set to it's maximum length (see setScanType())
     particleUtilsPS::freeParticleSet(particleSet);
-    free(palette.paletteArr);
+    memUtilsPS::freePS(palette.paletteArr);
 }
 
 //resets all particles to the starting locations
@@ -45,7 +45,7 @@ void LarsonScannerSL::setColorMode(uint8_t colorMode, bool bgColorMode) {
 
 //changes the color of the particles
 void LarsonScannerSL::setColor(CRGB color) {
-    free(palette.paletteArr);
+    memUtilsPS::freePS(palette.paletteArr);
     palette = paletteUtilsPS::makeSingleColorPalette(color);
 }
 
@@ -40,7 +40,9 @@ LavaPS::LavaPS(SegmentSetPS &SegSet, uint8_t numColors, uint16_t BlendSteps, uin
 }
 
 LavaPS::~LavaPS() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(briNoiseKeys.keyArr);
+    memUtilsPS::freePS(colorNoiseKeys.keyArr);
 }
 
 void LavaPS::init(SegmentSetPS &SegSet, uint16_t Rate) {
@@ -73,6 +75,22 @@ void LavaPS::update() {
             prevHueTime = currentTime;
         }
 
+        //If we're using keyframes, the noise is blended between pre-calculated slices (see noiseKeyframesPS.h)
+        //Otherwise, start the brightness and color noise rows
+        //We walk along the noise as we move across the pixels, so that the noise lattice can be re-used (see noiseUtilsPS.h)
+        //If the keyframes have just been turned on, their old slices are out of date, so they need to be re-filled
+        if( !keyframesOn && noiseUtilsPS::keyframesOn(keyFrames, keyTime) ) {
+            noiseUtilsPS::resetKeyframes(briNoiseKeys);
+            noiseUtilsPS::resetKeyframes(colorNoiseKeys);
+        }
+        keyframesOn = noiseUtilsPS::keyframesOn(keyFrames, keyTime);
+        if( keyframesOn ) {
+            updateNoiseKeys();
+        } else {
+            noiseUtilsPS::startNoiseRow8(briNoiseRow, 0, currentTime / 5, brightnessScale, 0);
+            noiseUtilsPS::startNoiseRow8(colorNoiseRow, 0, currentTime / 10, blendScale, 0);
+        }
+
         //run over each of the leds in the segment set and set a noise/color value
         for( uint16_t i = 0; i < numSegs; i++ ) {
             totSegLen = segSet->getTotalSegLength(i);
@@ -82,8 +100,13 @@ void LavaPS::update() {
                 pixelNum = segDrawUtils::getSegmentPixel(*segSet, i, j);
 
                 //do some noise magic to get a brightness val and color index
-                brightness = inoise8(pixelCount * brightnessScale, currentTime / 5);
-                index = inoise8(pixelCount * blendScale, currentTime / 10);
+                if( keyframesOn ) {
+                    brightness = noiseUtilsPS::getKeyframeNoise(briNoiseKeys, pixelCount);
+                    index = noiseUtilsPS::getKeyframeNoise(colorNoiseKeys, pixelCount);
+                } else {
+                    brightness = noiseUtilsPS::nextNoise8(briNoiseRow);
+                    index = noiseUtilsPS::nextNoise8(colorNoiseRow);
+                }
 
                 //scale color index to be somewhere between 0 and totBlendLength to put it somewhere in the blended palette
                 index = scale16by8(totBlendLength, index);  //colorIndex * totBlendLength /255;
@@ -106,4 +129,28 @@ void LavaPS::update() {
         }
         showCheckPS();
     }
-}
\ No newline at end of file
+}
+
+//Steps the brightness and color noise keyframes, filling in new keyframe slices if needed
+//Each slice is the noise for the whole segment set at the keyframe's time
+//(the end slice is one keyframe span ahead of the current time, see noiseKeyframesPS.h)
+void LavaPS::updateNoiseKeys() {
+    uint16_t numLeds = segSet->numLeds;
+    unsigned long keyTimeEnd = currentTime + noiseUtilsPS::getKeySpanTime(keyFrames, keyTime, *rate);
+
+    noiseUtilsPS::resizeNoiseKeyframes(briNoiseKeys, numLeds);
+    noiseUtilsPS::resizeNoiseKeyframes(colorNoiseKeys, numLeds);
+
+    //Both sets of keyframes are always updated together, so they'll both need new slices at the same time
+    noiseUtilsPS::updateKeyframes(colorNoiseKeys, keyFrames, keyTime, currentTime);
+    if( noiseUtilsPS::updateKeyframes(briNoiseKeys, keyFrames, keyTime, currentTime) ) {
+        if( briNoiseKeys.fillStart ) {
+            noiseUtilsPS::fillNoiseRow8(noiseUtilsPS::getKeyStartSlice(briNoiseKeys), numLeds, 0, currentTime / 5, brightnessScale, 0);
+        }
+        if( colorNoiseKeys.fillStart ) {
+            noiseUtilsPS::fillNoiseRow8(noiseUtilsPS::getKeyStartSlice(colorNoiseKeys), numLeds, 0, currentTime / 10, blendScale, 0);
+        }
+        noiseUtilsPS::fillNoiseRow8(noiseUtilsPS::getKeyEndSlice(briNoiseKeys), numLeds, 0, keyTimeEnd / 5, brightnessScale, 0);
+        noiseUtilsPS::fillNoiseRow8(noiseUtilsPS::getKeyEndSlice(colorNoiseKeys), numLeds, 0, keyTimeEnd / 10, blendScale, 0);
+    }
+}
@@ -3,6 +3,7 @@
 
 #include "Effects/EffectBasePS.h"
 #include "GeneralUtils/generalUtilsPS.h"
+#include "Noise_Stuff/noiseUtilsPS.h"
 #include "ColorUtils/colorUtilsPS.h"
 
 /* 
@@ -88,6 +89,12 @@ Other Settings:
     *hueRate (default bound to hueRateOrig) -- The hue shifting time (ms). It's a pointer so you can bind it externally
     paletteTemp -- Storage for any randomly created palettes 
                    (will be bound to the effect palette if the random color constructor was used)
+    keyFrames (default 0) -- If more than 1, the noise will only be fully calculated once every keyFrames updates,
+                             with the noise in between blended from the previous calculation to the next.
+                             This greatly reduces the processing needed, at the cost of some noise detail,
+                             but uses an extra 4 bytes of memory per pixel (see noiseKeyframesPS.h).
+    keyTime (default 0) -- Like keyFrames, but spaces the noise calculations by a time (ms) instead.
+                           Overrides keyFrames if more than 0.
 
 Functions:
     update() -- updates the effect 
@@ -122,7 +129,9 @@ class LavaPS : public EffectBasePS {
             brightnessScale = 150,
             hueRateOrig = 235,        //Default hue shifting time (ms), does a complete hue cycle ~every min (only relevant for rainbow mode)
             *hueRate = &hueRateOrig,  //The hue shifting time (ms), by default it's bound to hueRateOrig, but it's a pointer so you can bind it externally
-            hue = 0;  //offset for center of the noise (see hueCycle notes in intro)
+            hue = 0,  //offset for center of the noise (see hueCycle notes in intro)
+            keyFrames = 0,
+            keyTime = 0;
 
         bool
             hueCycle = false,
@@ -155,8 +164,20 @@ class LavaPS : public EffectBasePS {
         CRGB
             colorOut;
 
+        noiseRowPS
+            briNoiseRow,
+            colorNoiseRow;
+
+        noiseKeyframesPS
+            briNoiseKeys = {nullptr, 0, 0},  //Must init structs w/ pointers set to null for safety
+            colorNoiseKeys = {nullptr, 0, 0};
+
+        bool
+            keyframesOn = false;
+
         void
-            init(SegmentSetPS &SegSet, uint16_t Rate);
+            init(SegmentSetPS &SegSet, uint16_t Rate),
+            updateNoiseKeys();
 };
 
 #endif
\ No newline at end of file
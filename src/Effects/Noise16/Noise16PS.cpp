@@ -21,7 +21,8 @@ Noise16PS::Noise16PS(SegmentSetPS &SegSet, uint8_t numColors, uint8_t BlendSteps
 }
 
 Noise16PS::~Noise16PS() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(noiseKeys.keyArr);
 }
 
 void Noise16PS::init(SegmentSetPS &SegSet, uint16_t Rate) {
@@ -36,25 +37,50 @@ This function will shift the value using one of three methods
     0: Keep the scaling value static
     1: scale the value based on the current time
     2: scale the value by an sin wave at a passed in bpm
-    3: scale the value by multiplying the current time (only use for z part of noise) */
-uint32_t Noise16PS::getShiftVal(uint8_t shiftMode, uint16_t constVal) {
+    3: scale the value by multiplying the current time (only use for z part of noise)
+The value is calculated for the passed in shiftTime (ms), which is normally the current time, 
+but will be in the future for noise keyframes */
+uint32_t Noise16PS::getShiftVal(uint8_t shiftMode, uint16_t constVal, unsigned long shiftTime) {
     switch( shiftMode ) {
         case 0:
         default:
             return constVal;
             break;
         case 1:
-            return currentTime / constVal;
+            return shiftTime / constVal;
             break;
         case 2:
-            return beatsin8(constVal);
+            //beatsin8 uses millis() for its time, so we offset it's timebase to get the value at the shiftTime
+            return beatsin8(constVal, 0, 255, currentTime - shiftTime);
             break;
         case 3:
-            return currentTime * constVal;
+            return shiftTime * constVal;
             break;
     }
 }
 
+//Gets the noise inputs for the passed in time, and starts a noise row at the first pixel,
+//with both x and y stepping by blendScale for each pixel
+//ie for each pixel the noise inputs are x = (pixelCount + shift_x) * blendScale, y = (pixelCount + shift_y) * blendScale
+//We walk along the noise as we move across the pixels, so that the noise lattice can be re-used (see noiseUtilsPS.h)
+void Noise16PS::startNoise(unsigned long noiseTime) {
+    shift_x = getShiftVal(x_mode, x_val, noiseTime);
+    shift_y = getShiftVal(y_mode, y_val, noiseTime);
+    real_z = getShiftVal(z_mode, z_val, noiseTime);
+
+    real_x = shift_x * blendScale;
+    real_y = shift_y * blendScale;
+    noiseUtilsPS::startNoiseRow16(noiseRow, real_x, real_y, real_z, blendScale, blendScale);
+}
+
+//Fills a keyframe slice with the (8 bit) noise for every pixel at the passed in time
+void Noise16PS::fillNoiseSlice(uint8_t *slice, unsigned long sliceTime) {
+    startNoise(sliceTime);
+    for( uint16_t i = 0; i < noiseKeys.length; i++ ) {
+        slice[i] = noiseUtilsPS::nextNoise16(noiseRow) >> 8;
+    }
+}
+
 //updates the effect by re-calculating the noise for each pixel
 void Noise16PS::update() {
     currentTime = millis();
@@ -63,13 +89,30 @@ void Noise16PS::update() {
         prevTime = currentTime;
         pixelCount = 0;
 
-        //get noise inputs for the current cycle
-        shift_x = getShiftVal(x_mode, x_val);
-        shift_y = getShiftVal(y_mode, y_val);
-        real_z = getShiftVal(z_mode, z_val);
-
         numSegs = segSet->numSegs;
         totBlendLength = blendSteps * palette->length;
+
+        //If we're using keyframes, the noise is blended between pre-calculated slices (see noiseKeyframesPS.h)
+        //The end slice is filled with the noise one keyframe span ahead of the current time
+        //Otherwise, we start a noise row using the noise inputs for the current cycle
+        //If the keyframes have just been turned on, their old slices are out of date, so they need to be re-filled
+        if( !keyframesOn && noiseUtilsPS::keyframesOn(keyFrames, keyTime) ) {
+            noiseUtilsPS::resetKeyframes(noiseKeys);
+        }
+        keyframesOn = noiseUtilsPS::keyframesOn(keyFrames, keyTime);
+        if( keyframesOn ) {
+            noiseUtilsPS::resizeNoiseKeyframes(noiseKeys, segSet->numLeds);
+            if( noiseUtilsPS::updateKeyframes(noiseKeys, keyFrames, keyTime, currentTime) ) {
+                if( noiseKeys.fillStart ) {
+                    fillNoiseSlice(noiseUtilsPS::getKeyStartSlice(noiseKeys), currentTime);
+                }
+                fillNoiseSlice(noiseUtilsPS::getKeyEndSlice(noiseKeys),
+                               currentTime + noiseUtilsPS::getKeySpanTime(keyFrames, keyTime, *rate));
+            }
+        } else {
+            startNoise(currentTime);
+        }
+
         //run over each of the leds in the segment set and set a noise/color value
         for( uint16_t i = 0; i < numSegs; i++ ) {
             totSegLen = segSet->getTotalSegLength(i);
@@ -77,12 +120,12 @@ void Noise16PS::update() {
                 //get the current pixel's location in the segment set
                 pixelNum = segDrawUtils::getSegmentPixel(*segSet, i, j);
 
-                //scale x and y noise inputs for the current pixel
-                real_x = (pixelCount + shift_x) * blendScale;
-                real_y = (pixelCount + shift_y) * blendScale;
-
                 //get the noise data and scale it down
-                noise = inoise16(real_x, real_y, real_z) >> 8;
+                if( keyframesOn ) {
+                    noise = noiseUtilsPS::getKeyframeNoise(noiseKeys, pixelCount);
+                } else {
+                    noise = noiseUtilsPS::nextNoise16(noiseRow) >> 8;
+                }
 
                 //map LED gradient color index based on noise data
                 index = scale16by8(totBlendLength, sin8(noise * 3));
@@ -3,6 +3,7 @@
 
 #include "Effects/EffectBasePS.h"
 #include "GeneralUtils/generalUtilsPS.h"
+#include "Noise_Stuff/noiseUtilsPS.h"
 
 /*
 An effect based on the noise_16 effects created by Andrew Tuline here: https://github.com/atuline/FastLED-Demos/blob/master/noise16_3/noise16_3.ino
@@ -94,6 +95,15 @@ Constructor inputs:
     z_val -- The scaling factor for the z noise input (see Inputs Guide above)
     rate -- The update rate (ms) note that this is synced with all the particles.
 
+Other settings:
+    keyFrames (default 0) -- If more than 1, the noise will only be fully calculated once every keyFrames updates,
+                             with the noise in between blended from the previous calculation to the next.
+                             This greatly reduces the processing needed, at the cost of some noise detail,
+                             but uses an extra 2 bytes of memory per pixel (see noiseKeyframesPS.h).
+                             Note that noise using beatsin modes will be smoothed out a bit more.
+    keyTime (default 0) -- Like keyFrames, but spaces the noise calculations by a time (ms) instead.
+                           Overrides keyFrames if more than 0.
+
 Functions:
     update() -- updates the effect  
 */
@@ -119,7 +129,9 @@ class Noise16PS : public EffectBasePS {
             x_val,
             y_val,
             z_val,
-            blendScale;  // the "zoom factor" for the noise
+            blendScale,  // the "zoom factor" for the noise
+            keyFrames = 0,
+            keyTime = 0;
 
         palettePS
             *palette = nullptr,
@@ -151,13 +163,24 @@ class Noise16PS : public EffectBasePS {
             real_x,
             real_y,
             real_z,
-            getShiftVal(uint8_t shiftMode, uint16_t scale);
+            getShiftVal(uint8_t shiftMode, uint16_t scale, unsigned long shiftTime);
+
+        bool
+            keyframesOn = false;
 
         CRGB
             colorOut;
 
+        noiseRow16PS
+            noiseRow;
+
+        noiseKeyframesPS
+            noiseKeys = {nullptr, 0, 0};  //Must init structs w/ pointers set to null for safety
+
         void
-            init(SegmentSetPS &SegSet, uint16_t Rate);
+            init(SegmentSetPS &SegSet, uint16_t Rate),
+            startNoise(unsigned long noiseTime),
+            fillNoiseSlice(uint8_t *slice, unsigned long sliceTime);
 };
 
 #endif
\ No newline at end of file
@@ -22,7 +22,7 @@ NoiseGradSL::NoiseGradSL(SegmentSetPS &SegSet, uint8_t numColors, CRGB BgColor,
 }
 
 NoiseGradSL::~NoiseGradSL() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
 }
 
 //Initializes core common variables
@@ -118,14 +118,18 @@ void NoiseGradSL::update() {
         effect the final result */
         colorOffsetTot = mod16PS(2 * totBlendLength - colorOffset - colorIndex, totBlendLength);
 
+        //Start the brightness noise row, we walk along it as we move across the segment lines
+        //(only used if we're modulating the brightness)
+        noiseUtilsPS::startNoiseRow8(briNoiseRow, 0, currentTime / briFreq, briScale, 0);
+
         //run over each of the leds in the segment set and set a color/brightness value
         for( uint16_t i = 0; i < numLines; i++ ) {
 
             //if we modulating the brightness, calculate a new brightness for each line
             //otherwise leave it alone
             if( doBrightness ) {
-                bri = inoise8(i * briScale, currentTime / briFreq);
-                // The range of the inoise8 function is roughly 16-238.
+                bri = noiseUtilsPS::nextNoise8(briNoiseRow);
+                // The range of the noise is roughly 16-238.
                 // These two operations expand those values out to roughly 0..255
                 // You can comment them out if you want the raw noise data.
                 bri = qsub8(bri, 16);
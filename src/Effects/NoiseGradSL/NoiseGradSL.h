@@ -3,6 +3,7 @@
 
 #include "Effects/EffectBasePS.h"
 #include "GeneralUtils/generalUtilsPS.h"
+#include "Noise_Stuff/noiseUtilsPS.h"
 #include "MathUtils/mathUtilsPS.h"
 
 /*
@@ -188,6 +189,9 @@ class NoiseGradSL : public EffectBasePS {
             colorTarget,
             colorOut;
 
+        noiseRowPS
+            briNoiseRow;
+
         void
             shiftBlendSteps(),
             init(CRGB BgColor, uint16_t BlendRate, SegmentSetPS &SegSet, uint16_t Rate);
@@ -19,8 +19,9 @@ NoiseSL::NoiseSL(SegmentSetPS &SegSet, palettePS &Palette, uint16_t BlendSteps,
 }
 
 NoiseSL::~NoiseSL() {
-    free(noise);
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(noise);
+    memUtilsPS::freePS(noiseKeys.keyArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
 }
 
 //Sets up the initial effect values and other key variables
@@ -64,9 +65,9 @@ void NoiseSL::setupNoiseArray() {
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || numPoints > numPointsMax ) {
         numPointsMax = numPoints;
-        free(noise);
+        memUtilsPS::freePS(noise);
         //create the noise array to store noise value of each line point
-        noise = (uint8_t *)malloc(numPoints * sizeof(uint8_t));
+        noise = (uint8_t *)memUtilsPS::allocPS(numPoints * sizeof(uint8_t));
     }
 }
 
@@ -96,7 +97,26 @@ void NoiseSL::update() {
     }
 }
 
-//Fill the noise array with 8-bit noise values using the inoise8 function.
+//Quality hook for the EffectSetPS frame governor
+//Below full quality, we use noise keyframes to cut down on the noise calculations (see fillNoise8())
+//with more keyframes the lower the quality, from 2 just below full quality, up to 5 at the lowest
+//The keyframe slices are sized here, so that they aren't allocated part way through an update
+//Note that the slices are kept once made (even if the quality goes back up), so the governor doesn't re-allocate them
+//each time it changes the quality, see the setQuality() notes in NoiseSL.h
+//When the quality first drops, the keyframes are reset, so that we don't blend from slices left over from the last time
+void NoiseSL::setQuality(uint8_t newQuality) {
+    bool qualWasFull = (keyFramesQual == 0);
+    keyFramesQual = 0;
+    if( newQuality < 255 ) {
+        keyFramesQual = 2 + (255 - newQuality) / 64;
+        noiseUtilsPS::resizeNoiseKeyframes(noiseKeys, numLines * numSegs);
+        if( qualWasFull ) {
+            noiseUtilsPS::resetKeyframes(noiseKeys);
+        }
+    }
+}
+
+//Fill the noise array with 8-bit noise values using noiseUtilsPS noise rows.
 //In addition, it includes some fast automatic 'data smoothing' at
 //lower noise speeds to help produce smoother animations in those cases.
 void NoiseSL::fillNoise8() {
@@ -108,19 +128,62 @@ void NoiseSL::fillNoise8() {
         dataSmoothing = 200 - (speed * 4);
     }
 
-    //For each segment line do the following:
-    for( uint16_t i = 0; i < numLines; i++ ) {
-        i_offset = scale * i;
-        //current segment line's start index in the noise array
-        noiseStart = i * numSegs;
-        for( uint16_t j = 0; j < numSegs; j++ ) {
-            j_offset = scale * j;
+    //If we're using keyframes, we only calculate the noise every so often, blending between the keyframes otherwise
+    //If a new keyframe has been reached, we fill in the noise for the next keyframe,
+    //which is however many updates ahead as there are between keyframes (see noiseKeyframesPS.h)
+    //(the quality may call for more keyframes than set by the user, see setQuality())
+    keyFramesUse = keyFrames;
+    if( keyFramesQual > keyFramesUse ) {
+        keyFramesUse = keyFramesQual;
+    }
+    //If the keyframes have just been turned on, their old slices are out of date, so they need to be re-filled
+    if( !keyframesOn && noiseUtilsPS::keyframesOn(keyFramesUse, keyTime) ) {
+        noiseUtilsPS::resetKeyframes(noiseKeys);
+    }
+    keyframesOn = noiseUtilsPS::keyframesOn(keyFramesUse, keyTime);
+    if( keyframesOn ) {
+        noiseUtilsPS::resizeNoiseKeyframes(noiseKeys, numLines * numSegs);
+        if( noiseUtilsPS::updateKeyframes(noiseKeys, keyFramesUse, keyTime, currentTime) ) {
+            if( noiseKeys.fillStart ) {
+                fillNoiseSlice(noiseUtilsPS::getKeyStartSlice(noiseKeys), 0);
+            }
+            fillNoiseSlice(noiseUtilsPS::getKeyEndSlice(noiseKeys), noiseUtilsPS::getKeySpanFrames(keyFramesUse, keyTime, *rate));
+        }
+    }
+
+    //If we're sharing a noise field, we take the noise from the field instead of calculating it
+    //The field has a row for each segment, and a column for each segment line, matching the noise rows below
+    //If we're leading the field we fill it (unless another effect already has with the same noise)
+    //otherwise we only use it if it's been filled and matches our dimensions
+    useField = false;
+    if( noiseField && !keyframesOn ) {
+        if( fieldLead ) {
+            noiseUtilsPS::resizeNoiseField(*noiseField, numLines, numSegs);
+            noiseUtilsPS::fillNoiseField8(*noiseField, x, scale, y, scale, z);
+        }
+        useField = noiseField->filled && noiseField->numCols == numLines && noiseField->numRows == numSegs;
+    }
+
+    //For each segment, walk along its lines, getting noise for each line point
+    //The x noise coordinate changes along the segment lines, so we can walk the noise as a row
+    //which lets us re-use the noise lattice between neighboring points (see noiseUtilsPS.h)
+    for( uint16_t j = 0; j < numSegs; j++ ) {
+        if( !keyframesOn && !useField ) {
+            noiseUtilsPS::startNoiseRow8(noiseRow, x, y + scale * j, z, scale, 0);
+        }
+        for( uint16_t i = 0; i < numLines; i++ ) {
             //The location of the noise data in the noise array
-            noiseIndex = noiseStart + j;
+            noiseIndex = i * numSegs + j;
 
-            noiseData = inoise8(x + i_offset, y + j_offset, z);
+            if( keyframesOn ) {
+                noiseData = noiseUtilsPS::getKeyframeNoise(noiseKeys, noiseIndex);
+            } else if( useField ) {
+                noiseData = noiseField->getNoise(i, j);
+            } else {
+                noiseData = noiseUtilsPS::nextNoise8(noiseRow);
+            }
 
-            // The range of the inoise8 function is roughly 16-238.
+            // The range of the noise is roughly 16-238.
             // These two operations expand those values out to roughly 0..255
             // You can comment them out if you want the raw noise data.
             noiseData = qsub8(noiseData, 16);
@@ -142,6 +205,22 @@ void NoiseSL::fillNoise8() {
     y -= ceil(float(speed) / 16);
 }
 
+//Fills a keyframe slice with the raw noise as it will be frameOffset updates from now
+//(the noise coordinates are moved forward by the same amounts as in fillNoise8())
+//The slice is laid out the same way as the noise array
+void NoiseSL::fillNoiseSlice(uint8_t *slice, uint16_t frameOffset) {
+    uint16_t xKey = x + frameOffset * (uint16_t)ceil(float(speed) / 8);
+    uint16_t yKey = y - frameOffset * (uint16_t)ceil(float(speed) / 16);
+    uint16_t zKey = z + frameOffset * speed;
+
+    for( uint16_t j = 0; j < numSegs; j++ ) {
+        noiseUtilsPS::startNoiseRow8(noiseRow, xKey, yKey + scale * j, zKey, scale, 0);
+        for( uint16_t i = 0; i < numLines; i++ ) {
+            slice[i * numSegs + j] = noiseUtilsPS::nextNoise8(noiseRow);
+        }
+    }
+}
+
 //Maps the noise into colors and writes them out to the segment set
 //The noise array is split segment line sections, we write each line out one at a time
 void NoiseSL::mapNoiseSegsWithPalette() {
@@ -7,6 +7,7 @@
 #include "Effects/EffectBasePS.h"
 #include "GeneralUtils/generalUtilsPS.h"
 #include "MathUtils/mathUtilsPS.h"
+#include "Noise_Stuff/noiseUtilsPS.h"
 
 /* 
 An effect that maps 2D Perlin noise to a segment set by drawing the noise onto the segment lines 
@@ -128,10 +129,34 @@ Other settings:
                        Range is (0 - 255) for `cMode`'s 0, 2, 3, and (0 - <<palette length>> * blendSteps) for cMode 1.
     bgColorOrig (default 0) -- The default color of the background (bound to the bgColor pointer by default)
     *bgColor (default bound to bgColorOrig) -- The color of the background, is a pointer so it can be bound to an external variable
+    keyFrames (default 0) -- If more than 1, the noise will only be fully calculated once every keyFrames updates,
+                             with the noise in between blended from the previous calculation to the next. 
+                             This greatly reduces the processing needed, at the cost of some noise detail, 
+                             but uses an extra 2 bytes of memory per pixel (see noiseKeyframesPS.h). Values of 2 - 6 work well.
+    keyTime (default 0) -- Like keyFrames, but spaces the noise calculations by a time (ms) instead.
+                           Overrides keyFrames if more than 0.
+    *noiseField (default nullptr) -- An optional noise field for sharing noise between NoiseSL's (see noiseFieldPS.h).
+                                     If set, the effect takes its noise from the field rather than calculating it itself.
+                                     For example, you could have two NoiseSL's with different palettes on two matching strips, 
+                                     with only one of them calculating the noise. The field is filled by the effect if it's
+                                     the "lead" (see fieldLead below). Other effects only use the field once it's filled
+                                     and has a row for each of their segments and a column for each segment line,
+                                     otherwise they calculate their own noise. 
+                                     The field is not used while keyframes are on (see keyFrames above).
+                                     !!The field is not freed by the effect, you must do so yourself (see noiseFieldPS.h).
+    fieldLead (default true) -- If true, the effect fills the noiseField using its own noise (if the field is set).
+                                Only set one effect as the lead for each field, and make sure it updates before the others.
 
 Functions:
     setupNoiseArray() -- Creates the array for storing the noise data (will be matrix of uint8_t's, numLines x numSegs)
                          Only call this if you change the segment set dimensions.
+    setQuality(newQuality) -- Quality hook for the EffectSetPS frame governor (see EffectSetPS.h).
+                              Below full quality (255), noise keyframes are turned on (2 - 5 keyFrames, lower quality is more), 
+                              unless you're already using more keyFrames or a keyTime. 
+                              Note that keyframes use an extra 2 bytes of memory per pixel (see keyFrames above).
+                              This is allocated the first time the quality is lowered, and is kept until the effect is deleted
+                              (even if the quality goes back up), so that it isn't re-allocated each time the quality changes.
+                              If memory is tight, leave room for it, or don't use the effect with the frame governor.
     update() -- updates the effect
     
 */
@@ -157,10 +182,13 @@ class NoiseSL : public EffectBasePS {
             hue = 0,
             speed,
             scaleBase,
-            scaleRange;
+            scaleRange,
+            keyFrames = 0,
+            keyTime = 0;
 
         bool
-            hueCycle = true;
+            hueCycle = true,
+            fieldLead = true;
 
         CRGB
             bgColorOrig = 0,          //default background color (blank)
@@ -170,8 +198,12 @@ class NoiseSL : public EffectBasePS {
             *palette = nullptr,
             paletteTemp = {nullptr, 0};  //Must init structs w/ pointers set to null for safety
 
+        noiseFieldPS
+            *noiseField = nullptr;
+
         void
             setupNoiseArray(),
+            setQuality(uint8_t newQuality),
             update(void);
 
     private:
@@ -182,6 +214,10 @@ class NoiseSL : public EffectBasePS {
         int8_t
             scaleStep = 0;
 
+        bool
+            keyframesOn = false,
+            useField = false;
+
         uint8_t
             noiseData,
             oldData,
@@ -203,8 +239,14 @@ class NoiseSL : public EffectBasePS {
             z,
             noiseStart,
             noiseIndex,
-            j_offset,
-            i_offset;
+            keyFramesQual = 0,  //the keyFrames set by setQuality()
+            keyFramesUse;
+
+        noiseRowPS
+            noiseRow;
+
+        noiseKeyframesPS
+            noiseKeys = {nullptr, 0, 0};  //Must init structs w/ pointers set to null for safety
 
         CRGB
             colorTarget,
@@ -213,6 +255,7 @@ class NoiseSL : public EffectBasePS {
         void
             init(SegmentSetPS &SegSet, uint16_t Rate),
             fillNoise8(),
+            fillNoiseSlice(uint8_t *slice, uint16_t frameOffset),
             mapNoiseSegsWithPalette(),
             setShiftScale();
 };
@@ -19,7 +19,7 @@ NoiseWavesSL::NoiseWavesSL(SegmentSetPS &SegSet, uint8_t numColors, CRGB BgColor
 }
 
 NoiseWavesSL::~NoiseWavesSL() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
 }
 
 //Initializes core common variables
@@ -72,6 +72,10 @@ void NoiseWavesSL::update() {
         //The hue offset keeps the waves moving across the strip
         noisePhase = inoise8(currentTime / phaseScale) + hue;
 
+        //Start the color noise row, we walk along it as we move across the segment lines
+        //so that the noise lattice can be re-used (see noiseUtilsPS.h)
+        noiseUtilsPS::startNoiseRow8(colorNoiseRow, 0, currentTime / blendSpeed, blendScale, 0);
+
         //run over each segment line and set color and brightness values for the whole line
         for( uint16_t i = 0; i < numLines; i++ ) {
             //Get a changing frequency multiplier, which helps produce the waves
@@ -83,7 +87,7 @@ void NoiseWavesSL::update() {
             //For the color index we add an hue offset the increments each cycle
             //Noise values tend to fall around the center of the 255 range, so by adding
             //a moving hue offset we make sure that we see all the palette colors and keeps the effect varying
-            index = inoise8(i * blendScale, currentTime / blendSpeed) + hue;
+            index = noiseUtilsPS::nextNoise8(colorNoiseRow) + hue;
 
             /* Get a brightness based on a cos wave with noisy inputs
             The brightness is set by a wave who's frequency and phase vary as functions of noise
@@ -3,6 +3,7 @@
 
 #include "Effects/EffectBasePS.h"
 #include "GeneralUtils/generalUtilsPS.h"
+#include "Noise_Stuff/noiseUtilsPS.h"
 #include "MathUtils/mathUtilsPS.h"
 
 /*
@@ -155,6 +156,9 @@ class NoiseWavesSL : public EffectBasePS {
             colorTarget,
             colorOut;
 
+        noiseRowPS
+            colorNoiseRow;
+
         void
             init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate);
 };
@@ -11,6 +11,12 @@ PacificaPS::PacificaPS(SegmentSetPS &SegSet, uint16_t Rate)  //
     totBlendLength = numSteps * pacificaPal1_PS.length;
 }
 
+PacificaPS::~PacificaPS() {
+    for( uint8_t i = 0; i < 3; i++ ) {
+        memUtilsPS::freePS(paletteLuts[i].lutArr);
+    }
+}
+
 void PacificaPS::update() {
     currentTime = millis();
 
@@ -33,88 +39,80 @@ void PacificaPS::update() {
         sCIStart3 -= (deltaTime1 * beatsin88(501, 5, 7));
         sCIStart4 -= (deltaTime2 * beatsin88(257, 4, 6));
 
-        //Clear out the LED array to a dim background blue-green
-        segDrawUtils::fillSegSetColor(*segSet, *bgColor, 0);
-
-        //Render each of four layers, with different scales and speeds, that vary over time
-        doOneLayer(&pacificaPal1_PS, sCIStart1, beatsin16(3, 11 * 256, 14 * 256), beatsin8(10, 70, 130), 0 - beat16(301));  //10
-        doOneLayer(&pacificaPal2_PS, sCIStart2, beatsin16(4, 6 * 256, 9 * 256), beatsin8(17, 40, 80), beat16(401));         //17
-        doOneLayer(&pacificaPal3_PS, sCIStart3, 6 * 256, beatsin8(9, 10, 38), 0 - beat16(503));                             //9
-        doOneLayer(&pacificaPal3_PS, sCIStart4, 5 * 256, beatsin8(8, 10, 28), beat16(601));                                 //8
-
-        //Add brighter 'whitecaps' where the waves lines up more
-        addWhitecaps();
+        //Make sure the palette LUTs are up to date (they're only re-built if a palette changes)
+        if( useLut ) {
+            pacificaUtilsPS::updatePaletteLut(paletteLuts[0], &pacificaPal1_PS, totBlendLength, numSteps);
+            pacificaUtilsPS::updatePaletteLut(paletteLuts[1], &pacificaPal2_PS, totBlendLength, numSteps);
+            pacificaUtilsPS::updatePaletteLut(paletteLuts[2], &pacificaPal3_PS, totBlendLength, numSteps);
+        }
 
-        //Deepen the blues and greens a bit
-        deepenColors();
+        //Set up each of four layers, with different scales and speeds, that vary over time
+        //(the last two layers share the third palette)
+        pacificaUtilsPS::setupLayer(layers[0], &pacificaPal1_PS, getLutArr(0), sCIStart1, beatsin16(3, 11 * 256, 14 * 256), beatsin8(10, 70, 130), 0 - beat16(301));  //10
+        pacificaUtilsPS::setupLayer(layers[1], &pacificaPal2_PS, getLutArr(1), sCIStart2, beatsin16(4, 6 * 256, 9 * 256), beatsin8(17, 40, 80), beat16(401));         //17
+        pacificaUtilsPS::setupLayer(layers[2], &pacificaPal3_PS, getLutArr(2), sCIStart3, 6 * 256, beatsin8(9, 10, 38), 0 - beat16(503));                             //9
+        pacificaUtilsPS::setupLayer(layers[3], &pacificaPal3_PS, getLutArr(2), sCIStart4, 5 * 256, beatsin8(8, 10, 28), beat16(601));                                 //8
+
+        //Set up the whitecap waves
+        baseThreshold = beatsin8(9, 55, 65);
+        wave = beat8(7);
+
+        //Run over each of the leds, working out each one's final color in a single pass:
+        //Starting with a dim background blue-green, we add the four wave layers,
+        //then add brighter 'whitecaps' where the waves lines up more, 
+        //and finally deepen the blues and greens a bit
+        for( uint16_t i = 0; i < numSegs; i++ ) {
+            totSegLen = segSet->getTotalSegLength(i);
+            for( uint16_t j = 0; j < totSegLen; j++ ) {
+                colorOut = *bgColor;
+                for( uint8_t k = 0; k < 4; k++ ) {
+                    colorOut += pacificaUtilsPS::getLayerColor(layers[k], totBlendLength, numSteps);
+                }
+
+                addWhitecaps();
+                deepenColors();
+
+                pixelNum = segDrawUtils::getSegmentPixel(*segSet, i, j);
+                if( pixelNum != D_LED_PS ) {
+                    segSet->leds[pixelNum] = colorOut;
+
+                    //Need to check to dim the pixel color manually
+                    //b/c we're not calling setPixelColor directly
+                    segDrawUtils::handleBri(*segSet, pixelNum);
+                }
+            }
+        }
 
         showCheckPS();
     }
 }
 
-//Add one layer of waves into the led array
-void PacificaPS::doOneLayer(palettePS *palette, uint16_t ciStart, uint16_t waveScale, uint8_t bri, uint16_t iOff) {
-    ci = ciStart;
-    waveAngle = iOff;
-    waveScaleHalf = (waveScale / 2) + 20;
-    //Run over each of the leds and set the color
-    for( uint16_t i = 0; i < numSegs; i++ ) {
-        totSegLen = segSet->getTotalSegLength(i);
-        for( uint16_t j = 0; j < totSegLen; j++ ) {
-            waveAngle += 250;
-            s16 = sin16(waveAngle) + 32768;
-            cs = scale16(s16, waveScaleHalf) + waveScaleHalf;
-            ci += cs;
-            sIndex16 = sin16(ci) + 32768;
-            index = scale16(sIndex16, totBlendLength);
-
-            //returns the blended color from the palette mapped into numSteps
-            colorOut = paletteUtilsPS::getPaletteGradColor(*palette, index, 0, totBlendLength, numSteps);
-            nscale8x3(colorOut.r, colorOut.g, colorOut.b, bri);
-            pixelNum = segDrawUtils::getSegmentPixel(*segSet, i, j);
-
-            segSet->leds[pixelNum] += colorOut;
-        }
+//Returns the LUT array for the palette LUT at lutNum, or nullptr if we're not using LUTs
+CRGB *PacificaPS::getLutArr(uint8_t lutNum) {
+    if( useLut ) {
+        return paletteLuts[lutNum].lutArr;
     }
+    return nullptr;
 }
 
-//Add extra 'white' to areas where the four layers of light have lined up brightly
+//Add extra 'white' to the current pixel color (colorOut) if the four layers of light have lined up brightly
+//Must be called once for each pixel, in order, since the whitecap wave is stepped for each pixel
 void PacificaPS::addWhitecaps() {
-    baseThreshold = beatsin8(9, 55, 65);
-    wave = beat8(7);
-
-    for( uint16_t i = 0; i < numSegs; i++ ) {
-        totSegLen = segSet->getTotalSegLength(i);
-        for( uint16_t j = 0; j < totSegLen; j++ ) {
-            threshold = scale8(sin8(wave), 20) + baseThreshold;
-            wave += 7;
-            pixelNum = segDrawUtils::getSegmentPixel(*segSet, i, j);
-            lightLvl = segSet->leds[pixelNum].getAverageLight();
-            if( lightLvl > threshold ) {
-                overage = lightLvl - threshold;
-                overage2 = qadd8(overage, overage);
-                segSet->leds[pixelNum] += CRGB(overage, overage2, qadd8(overage2, overage2));
-            }
-        }
+    threshold = scale8(sin8(wave), 20) + baseThreshold;
+    wave += 7;
+    lightLvl = colorOut.getAverageLight();
+    if( lightLvl > threshold ) {
+        overage = lightLvl - threshold;
+        overage2 = qadd8(overage, overage);
+        colorOut += CRGB(overage, overage2, qadd8(overage2, overage2));
     }
 }
 
-//Deepen the blues and greens
+//Deepen the blues and greens of the current pixel color (colorOut)
 void PacificaPS::deepenColors() {
-    for( uint16_t i = 0; i < numSegs; i++ ) {
-        totSegLen = segSet->getTotalSegLength(i);
-        for( uint16_t j = 0; j < totSegLen; j++ ) {
-            pixelNum = segDrawUtils::getSegmentPixel(*segSet, i, j);
-            segSet->leds[pixelNum].blue = scale8(segSet->leds[pixelNum].blue, 145);
-            segSet->leds[pixelNum].green = scale8(segSet->leds[pixelNum].green, 200);
-            //segSet->leds[pixelNum].red = scale8( segSet->leds[pixelNum].red, 200); //for lava colors
-            segSet->leds[pixelNum] |= CRGB(2, 5, 7);
-            //segSet->leds[pixelNum] |= CRGB( 8, 0, 0); //for lava colors
-
-            //Need to check to dim the pixel color manually
-            //b/c we're not calling setPixelColor directly
-            //we do this here b/c deepenColors is the last function in setting the colors
-            segDrawUtils::handleBri(*segSet, pixelNum);
-        }
-    }
+    colorOut.blue = scale8(colorOut.blue, 145);
+    colorOut.green = scale8(colorOut.green, 200);
+    //colorOut.red = scale8( colorOut.red, 200); //for lava colors
+    colorOut |= CRGB(2, 5, 7);
+    //colorOut |= CRGB( 8, 0, 0); //for lava colors
 }
\ No newline at end of file
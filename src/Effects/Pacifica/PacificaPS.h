@@ -7,6 +7,7 @@
 #include "GeneralUtils/generalUtilsPS.h"
 //The source of the palettes for the effect
 #include "PacificaPalette/pacificaPalettePS.h"
+#include "Utils/pacificaUtilsPS.h"
 
 /*
 
@@ -30,7 +31,9 @@ Recommend brightness >80 and rate > 20ms
 For low brightness values I recommend turning off dithering using
 FastLED.setDither(0);
 
-The effect is a bit computationally heavy
+The effect is a bit computationally heavy.
+To help with this, the wave layers, whitecaps, and color deepening are all worked out together in a single pass over the leds,
+and by default, the palette colors are taken from look up tables (LUTs) rather than being blended for every pixel.
 
 Note, I've made the background color a pointer so you can bind it externally (as it is in other effects).
 You probably shouldn't change it tho, b/c it heavily influences the effect.
@@ -39,6 +42,12 @@ Example calls:
     PacificaPS pacifica(mainSegments, 40);
     That's it, updates at 40ms
 
+Other Settings:
+    useLut (default true, false on AVR chips) -- If true, the wave colors will be taken from look up tables (LUTs) 
+                                                of the palette blend colors, which is faster than blending the palettes for each pixel. 
+                                                The LUTs are re-built automatically if the palettes change.
+                                                The LUTs take ~2k bytes of memory, so they're turned off by default on AVR chips.
+
 Functions:
     update() -- updates the effect 
 
@@ -47,10 +56,15 @@ class PacificaPS : public EffectBasePS {
     public:
         PacificaPS(SegmentSetPS &SegSet, uint16_t Rate);
 
+        ~PacificaPS();
+
         uint8_t
             //Produces a total blend length of 240 for the whole palette, matches the original code
             numSteps = 240 / pacificaPal1_PS.length;
 
+        bool
+            useLut = PACIFICA_USE_LUT_PS;
+
         CRGB
             bgColorOrig = CRGB(2, 6, 10),  //CRGB(10, 0, 0); for lava colors? Messing with this is tricky.
             *bgColor = &bgColorOrig;       //bgColor is a pointer so it can be tied to an external variable if needed (such as a palette color)
@@ -85,20 +99,19 @@ class PacificaPS : public EffectBasePS {
             sCIStart3,
             sCIStart4,
             speedFactor1,
-            speedFactor2,
-            ci,
-            waveAngle,
-            waveScaleHalf,
-            s16,
-            cs,
-            index,
-            sIndex16;
+            speedFactor2;
 
         CRGB
-            colorOut;
+            colorOut,
+            *getLutArr(uint8_t lutNum);
+
+        pacificaLayerPS
+            layers[4];
+
+        pacificaLutPS
+            paletteLuts[3] = {};  //Must init structs w/ pointers set to null for safety
 
         void
-            doOneLayer(palettePS *palette, uint16_t ciStart, uint16_t waveScale, uint8_t bri, uint16_t iOff),
             addWhitecaps(),
             deepenColors();
 };
@@ -0,0 +1,34 @@
+#ifndef pacificaLayerPS_h
+#define pacificaLayerPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "FastLED.h"
+#include "Include_Lists/PaletteFiles.h"
+
+/*
+A struct for storing the state of a single Pacifica wave layer.
+Pacifica effects draw four layers of waves, each with different scales and speeds.
+Originally, each layer was drawn across the whole strip in its own pass, 
+but by keeping each layer's wave values in a struct, the layers can be stepped together, 
+so that each pixel's final color can be worked out in a single pass.
+
+The layer is set up at the start of each update using pacificaUtilsPS::setupLayer(),
+and then pacificaUtilsPS::getLayerColor() is called to get the layer's color for each pixel (or line) in order.
+You shouldn't need to set any of the struct's variables yourself. */
+struct pacificaLayerPS {
+    palettePS *palette;      //the layer's palette
+    CRGB *lutArr;            //the layer's palette color LUT (see pacificaLutPS.h), or nullptr if not using a LUT
+    uint16_t ci;             //the "color index", which is stepped for each pixel to work out the pixel's color
+    uint16_t waveAngle;      //the wave angle, which is stepped for each pixel to work out how much to step the ci
+    uint16_t waveScaleHalf;  //the wave scale of the layer, (sets how quickly the ci changes across the pixels)
+    uint8_t bri;             //the brightness of the layer
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef pacificaLutPS_h
+#define pacificaLutPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "FastLED.h"
+#include "Include_Lists/PaletteFiles.h"
+
+//Pacifica effects use palette color LUTs by default, except on AVR chips, where the LUTs' ~2k bytes are more than most chips have
+#ifdef __AVR__
+    #define PACIFICA_USE_LUT_PS false
+#else
+    #define PACIFICA_USE_LUT_PS true
+#endif
+
+/*
+A struct for storing a palette color look up table (LUT) for Pacifica effects.
+Each Pacifica wave layer picks a color from a blend of its palette for every pixel, every update.
+Blending the palette colors is the most expensive part of this, but the blend only has a fixed number of steps
+(240 for both Pacifica effects), so we can work out the color for each step once, store them in the LUT,
+and then just look up each pixel's color using its blend step.
+
+The LUT is re-built automatically whenever its palette or blend length changes
+(including changes to the palette's colors, like when the hue of PacificaHueSL changes), see pacificaUtilsPS::updatePaletteLut().
+To catch changes to the palette's colors, the LUT keeps a copy of them (after the LUT colors, in the same memory block),
+which is compared to the palette each update. The comparison is exact, so the LUT is never left with old colors.
+
+You shouldn't need to set any of the struct's variables yourself, they are managed by pacificaUtilsPS::updatePaletteLut().
+Like with other structs, it must be initialized with its pointers set to null:
+    pacificaLutPS paletteLut = {}; //Must init structs w/ pointers set to null for safety
+!!The LUT is created dynamically, so make sure you free it when you're done by calling memUtilsPS::freePS(paletteLut.lutArr). */
+struct pacificaLutPS {
+    CRGB *lutArr;           //pointer to the LUT array, one color for each blend step, followed by the paletteColors
+    CRGB *paletteColors;    //a copy of the palette's colors when the LUT was built (stored in the same memory block as the lutArr)
+    palettePS *palette;     //the palette the LUT was built with
+    uint16_t length;        //the number of blend steps (the total blend length), the LUT has one more color than this (see updatePaletteLut())
+    uint16_t maxLength;     //The total length of the lutArr memory block, used for memory management (see patternPS for more)
+    uint8_t numSteps;       //the number of blend steps between each palette color when the LUT was built
+    uint8_t paletteLength;  //the length of the palette when the LUT was built
+};
+
+#endif
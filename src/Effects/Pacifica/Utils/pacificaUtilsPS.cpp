@@ -0,0 +1,71 @@
+#include "pacificaUtilsPS.h"
+
+//Makes sure the palette LUT matches the passed in palette and blend settings
+//re-building the LUT if anything has changed (including the palette's colors)
+//The palette's colors are checked against a copy of them stored after the LUT colors, so any color change is caught
+//The LUT has one color for each step of the palette blend, matching the colors from 
+//paletteUtilsPS::getPaletteGradColor() with numSteps between each palette color
+//Note that the LUT is totBlendLength + 1 long, because the wave index is from scale16(), which can return totBlendLength itself
+//Returns true if the LUT was re-built
+bool pacificaUtilsPS::updatePaletteLut(pacificaLutPS &paletteLut, palettePS *palette, uint16_t totBlendLength, uint8_t numSteps) {
+    if( paletteLut.lutArr && paletteLut.palette == palette && paletteLut.paletteLength == palette->length &&
+        paletteLut.length == totBlendLength && paletteLut.numSteps == numSteps &&
+        paletteUtilsPS::paletteColorsMatch(*palette, paletteLut.paletteColors) ) {
+        return false;
+    }
+
+    //The memory block holds the LUT colors, followed by the copy of the palette's colors
+    lutLength = totBlendLength + 1;
+    if( alwaysResizeObj_PS || (lutLength + palette->length > paletteLut.maxLength) ) {
+        memUtilsPS::freePS(paletteLut.lutArr);
+        paletteLut.maxLength = lutLength + palette->length;
+        paletteLut.lutArr = (CRGB *)memUtilsPS::allocPS(paletteLut.maxLength * sizeof(CRGB));
+    }
+    paletteLut.paletteColors = paletteLut.lutArr + lutLength;
+
+    paletteLut.palette = palette;
+    paletteLut.paletteLength = palette->length;
+    paletteUtilsPS::copyPaletteColors(*palette, paletteLut.paletteColors);
+    paletteLut.length = totBlendLength;
+    paletteLut.numSteps = numSteps;
+
+    //Fill in the color for each blend step
+    for( uint16_t i = 0; i < lutLength; i++ ) {
+        paletteLut.lutArr[i] = paletteUtilsPS::getPaletteGradColor(*palette, i, 0, totBlendLength, numSteps);
+    }
+    return true;
+}
+
+//Sets up a wave layer's values at the start of an update
+//The inputs are the same as the original Pacifica doOneLayer() function, 
+//plus a LUT of the palette's colors (pass in nullptr to not use a LUT)
+void pacificaUtilsPS::setupLayer(pacificaLayerPS &layer, palettePS *palette, CRGB *lutArr, uint16_t ciStart, uint16_t waveScale, uint8_t bri, uint16_t iOff) {
+    layer.palette = palette;
+    layer.lutArr = lutArr;
+    layer.ci = ciStart;
+    layer.waveAngle = iOff;
+    layer.waveScaleHalf = (waveScale / 2) + 20;
+    layer.bri = bri;
+}
+
+//Steps a wave layer forward by one pixel and returns the layer's color for the pixel
+//This is the same as the inner loop of the original Pacifica doOneLayer() function, 
+//but returns the color rather than adding it to the pixel directly
+//If the layer has a LUT, the color is read from it, otherwise it is blended from the palette
+CRGB pacificaUtilsPS::getLayerColor(pacificaLayerPS &layer, uint16_t totBlendLength, uint8_t numSteps) {
+    layer.waveAngle += 250;
+    s16 = sin16(layer.waveAngle) + 32768;
+    cs = scale16(s16, layer.waveScaleHalf) + layer.waveScaleHalf;
+    layer.ci += cs;
+    sIndex16 = sin16(layer.ci) + 32768;
+    index = scale16(sIndex16, totBlendLength);
+
+    //get the blended color from the palette mapped into numSteps
+    if( layer.lutArr ) {
+        colorOut = layer.lutArr[index];
+    } else {
+        colorOut = paletteUtilsPS::getPaletteGradColor(*layer.palette, index, 0, totBlendLength, numSteps);
+    }
+    nscale8x3(colorOut.r, colorOut.g, colorOut.b, layer.bri);
+    return colorOut;
+}
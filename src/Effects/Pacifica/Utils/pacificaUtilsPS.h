@@ -0,0 +1,47 @@
+#ifndef pacificaUtilsPS_h
+#define pacificaUtilsPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "Include_Lists/PaletteFiles.h"
+#include "Memory_Stuff/memUtilsPS.h"
+#include "./Include_Lists/GlobalVars/GlobalVars.h"  //need alwaysResizeObj_PS
+#include "pacificaLutPS.h"
+#include "pacificaLayerPS.h"
+
+/*
+common functions for the Pacifica effects (PacificaPS and PacificaHueSL)
+Includes a set of functions so that the effects can draw all their wave layers in a single pass:
+    updatePaletteLut() -- Keeps a palette color look up table up to date (see pacificaLutPS.h).
+    setupLayer() -- Sets up a wave layer's values at the start of an update (see pacificaLayerPS.h).
+    getLayerColor() -- Steps a wave layer forward one pixel and returns the layer's color for the pixel. */
+namespace pacificaUtilsPS {
+
+    bool  //Functions for the palette color LUTs
+        updatePaletteLut(pacificaLutPS &paletteLut, palettePS *palette, uint16_t totBlendLength, uint8_t numSteps);
+
+    void  //Functions for the wave layers
+        setupLayer(pacificaLayerPS &layer, palettePS *palette, CRGB *lutArr, uint16_t ciStart, uint16_t waveScale, uint8_t bri, uint16_t iOff);
+
+    CRGB
+        getLayerColor(pacificaLayerPS &layer, uint16_t totBlendLength, uint8_t numSteps);
+
+    //pre-allocated space for function variables
+    static uint16_t
+        lutLength,
+        s16,
+        cs,
+        sIndex16,
+        index;
+
+    static CRGB
+        colorOut;
+};
+
+#endif
@@ -28,6 +28,9 @@ PacificaHueSL::PacificaHueSL(SegmentSetPS &SegSet, bool AddWhiteCaps, uint8_t Hu
 
 PacificaHueSL::~PacificaHueSL() {
     PacificaPalette->~PacificaHuePalPS();
+    for( uint8_t i = 0; i < 3; i++ ) {
+        memUtilsPS::freePS(paletteLuts[i].lutArr);
+    }
 }
 
 //sets up core effect variables
@@ -104,14 +107,26 @@ void PacificaHueSL::update() {
         sCIStart3 -= (deltaTime1 * beatsin88(501, 5, 7));
         sCIStart4 -= (deltaTime2 * beatsin88(257, 4, 6));
 
+        //Make sure the palette LUTs are up to date
+        //(they're only re-built if a palette changes, ie when the hue changes)
+        if( useLut ) {
+            pacificaUtilsPS::updatePaletteLut(paletteLuts[0], &PacificaPalette->pacificaPal1_PS, totBlendLength, numSteps);
+            pacificaUtilsPS::updatePaletteLut(paletteLuts[1], &PacificaPalette->pacificaPal2_PS, totBlendLength, numSteps);
+            pacificaUtilsPS::updatePaletteLut(paletteLuts[2], &PacificaPalette->pacificaPal3_PS, totBlendLength, numSteps);
+        }
+
+        //Set up each of four layers, with different scales and speeds, that vary over time
+        //(the last two layers share the third palette)
+        pacificaUtilsPS::setupLayer(layers[0], &PacificaPalette->pacificaPal1_PS, getLutArr(0), sCIStart1, beatsin16(3, 11 * 256, 14 * 256), beatsin8(10, 70, 130), 0 - beat16(301));
+        pacificaUtilsPS::setupLayer(layers[1], &PacificaPalette->pacificaPal2_PS, getLutArr(1), sCIStart2, beatsin16(4, 6 * 256, 9 * 256), beatsin8(17, 40, 80), beat16(401));
+        pacificaUtilsPS::setupLayer(layers[2], &PacificaPalette->pacificaPal3_PS, getLutArr(2), sCIStart3, 6 * 256, beatsin8(9, 10, 38), 0 - beat16(503));
+        pacificaUtilsPS::setupLayer(layers[3], &PacificaPalette->pacificaPal3_PS, getLutArr(2), sCIStart4, 5 * 256, beatsin8(8, 10, 28), beat16(601));
+
         //Clear out the LED array to a dim background
         segDrawUtils::fillSegSetColor(*segSet, *bgColor, 0);
 
-        //Render each of four layers, with different scales and speeds, that vary over time
-        doOneLayer(&PacificaPalette->pacificaPal1_PS, sCIStart1, beatsin16(3, 11 * 256, 14 * 256), beatsin8(10, 70, 130), 0 - beat16(301));
-        doOneLayer(&PacificaPalette->pacificaPal2_PS, sCIStart2, beatsin16(4, 6 * 256, 9 * 256), beatsin8(17, 40, 80), beat16(401));
-        doOneLayer(&PacificaPalette->pacificaPal3_PS, sCIStart3, 6 * 256, beatsin8(9, 10, 38), 0 - beat16(503));
-        doOneLayer(&PacificaPalette->pacificaPal3_PS, sCIStart4, 5 * 256, beatsin8(8, 10, 28), beat16(601));
+        //Render all four layers together in one pass
+        drawLayers();
 
         //Add brighter 'whitecaps' where the waves lines up more
         //only needed for exact matrixes
@@ -124,23 +139,24 @@ void PacificaHueSL::update() {
     }
 }
 
-//Add one layer of waves into the led array
-void PacificaHueSL::doOneLayer(palettePS *palette, uint16_t ciStart, uint16_t waveScale, uint8_t bri, uint16_t iOff) {
-    ci = ciStart;
-    waveAngle = iOff;
-    waveScaleHalf = (waveScale / 2) + 20;
-    //Run over each of the lines and set a color
-    //We get one color for each segment line and then output it to all the segments
+//Returns the LUT array for the palette LUT at lutNum, or nullptr if we're not using LUTs
+CRGB *PacificaHueSL::getLutArr(uint8_t lutNum) {
+    if( useLut ) {
+        return paletteLuts[lutNum].lutArr;
+    }
+    return nullptr;
+}
+
+//Add all four layers of waves into the led array
+//We get one color for each segment line by adding together the colors from each layer, 
+//and then output it to all the segments
+//(The colors are added with saturation, so adding the layers together first gives the same result as adding them to the pixels one by one)
+void PacificaHueSL::drawLayers() {
     for( uint16_t i = 0; i < numLines; i++ ) {
-        waveAngle += 250;
-        s16 = sin16(waveAngle) + 32768;
-        cs = scale16(s16, waveScaleHalf) + waveScaleHalf;
-        ci += cs;
-        sIndex16 = sin16(ci) + 32768;
-        index = scale16(sIndex16, totBlendLength);
-        //returns the blended color from the palette mapped into numSteps
-        colorOut = paletteUtilsPS::getPaletteGradColor(*palette, index, 0, totBlendLength, numSteps);
-        nscale8x3(colorOut.r, colorOut.g, colorOut.b, bri);
+        colorOut = CRGB::Black;
+        for( uint8_t k = 0; k < 4; k++ ) {
+            colorOut += pacificaUtilsPS::getLayerColor(layers[k], totBlendLength, numSteps);
+        }
 
         //output the color to all the line segment pixels
         //Since the colors are additive, pixels in multiple lines will be brighter than those in single lines
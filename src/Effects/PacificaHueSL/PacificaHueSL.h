@@ -5,6 +5,7 @@
 #include "GeneralUtils/generalUtilsPS.h"
 //The source of the palettes for the effect
 #include "PacificaHuePal/PacificaHuePalPS.h"
+#include "Effects/Pacifica/Utils/pacificaUtilsPS.h"
 
 /*
 
@@ -23,7 +24,9 @@ Recommend brightness > 80 and rate > 20ms
 For low brightness values I recommend turning off dithering using
 FastLED.setDither(0);
 
-Like the original, the effect is a bit computationally heavy
+Like the original, the effect is a bit computationally heavy.
+To help with this, all the wave layers are worked out together in a single pass over the segment lines,
+and by default, the palette colors are taken from look up tables (LUTs) rather than being blended for every line.
 
 Almost all of the code is directly copied from the original linked above
 (with modifications by me to work with segment sets and hues)
@@ -92,6 +95,10 @@ Other Settings:
                                   as part of the addWhiteCaps() function
                                 Lower -> lower light cap.
     PacificaPalette -- The Pacifica Hue Palette instance. You shouldn't need to access this.
+    useLut (default true, false on AVR chips) -- If true, the wave colors will be taken from look up tables (LUTs) 
+                                                of the palette blend colors, which is faster than blending the palettes for each line. 
+                                                The LUTs are re-built automatically when the palettes change (ie when the hue changes).
+                                                The LUTs take ~2k bytes of memory, so they're turned off by default on AVR chips.
 
 Functions:
     setHue(newHue) -- Changes the hue value
@@ -120,7 +127,8 @@ class PacificaHueSL : public EffectBasePS {
             *PacificaPalette = nullptr;
 
         bool
-            addWhiteCaps = false;
+            addWhiteCaps = false,
+            useLut = PACIFICA_USE_LUT_PS;
 
         uint8_t
             hue,                 //for reference, call setHue() to change the hue (defaulted to 130 in PacificaHuePalPS.h)
@@ -163,22 +171,22 @@ class PacificaHueSL : public EffectBasePS {
             sCIStart3,
             sCIStart4,
             speedFactor1,
-            speedFactor2,
-            ci,
-            waveAngle,
-            waveScaleHalf,
-            s16,
-            cs,
-            index,
-            sIndex16;
+            speedFactor2;
 
         CRGB
             *bgColor = nullptr,  //bgColor is a pointer, it is tied to the bgColor in the PacificaHuePalPS
-            colorOut;
+            colorOut,
+            *getLutArr(uint8_t lutNum);
+
+        pacificaLayerPS
+            layers[4];
+
+        pacificaLutPS
+            paletteLuts[3] = {};  //Must init structs w/ pointers set to null for safety
 
         void
             init(uint16_t HueRate, SegmentSetPS &SegSet, uint16_t Rate),
-            doOneLayer(palettePS *palette, uint16_t ciStart, uint16_t waveScale, uint8_t bri, uint16_t iOff),
+            drawLayers(),
             addWhitecaps();
 };
 
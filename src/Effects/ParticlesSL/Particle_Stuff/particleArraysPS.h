@@ -0,0 +1,41 @@
+#ifndef particleArraysPS_h
+#define particleArraysPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for storing the motion properties of a group of particles as parallel arrays
+("structure of arrays" rather than particleSetPS's array of particle pointers).
+In a particleSetPS, each particle is allocated separately, so stepping through the set to move each particle
+jumps all over memory, and drags along all of the particle's drawing properties (size, trails, color, etc).
+Instead, particleArraysPS keeps the values needed to move particles (position, speed, life, etc) packed together,
+so that the particles can be moved in a tight loop using particleUtilsPS::advanceParticleArrays().
+The drawing properties can still be kept in a particleSetPS, with the same index used for both.
+
+Particles are moved one step forward, wrapping back to 0 once they reach their maxPosition.
+Like in RainSL, any direction changes are meant to be handled by the effect when drawing.
+The particles to move are picked by a particle schedule, which only holds the active particles,
+ordered by when they're next due to move (see particleSchedulePS.h).
+
+All the arrays are held in a single allocation, to limit heap fragmentation.
+Like with other structs, it must be initialized with its pointers set to null:
+    particleArraysPS partArrays = {nullptr}; //Must init structs w/ pointers set to null for safety
+    particleUtilsPS::resizeParticleArrays(partArrays, 20); //Creates arrays for 20 particles
+!!The arrays are created dynamically, so make sure you free them using particleUtilsPS::freeParticleArrays() when you're done. */
+struct particleArraysPS {
+    unsigned long *lastUpdateTime;  //the last time each particle was moved (ms) (also the start of the array allocation)
+    uint16_t *position;             //the current position of each particle
+    uint16_t *maxPosition;          //the position each particle wraps back to 0 at
+    uint16_t *speed;                //the update rate of each particle (in ms). (Lower is faster)
+    uint16_t *life;                 //the life of each particle, particles with 0 life are inactive
+    uint16_t length;                //the number of particles
+    uint16_t maxLength;             //the maximum number of particles the arrays can hold (used for memory management)
+};
+
+#endif
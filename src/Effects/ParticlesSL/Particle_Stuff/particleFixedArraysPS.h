@@ -0,0 +1,52 @@
+#ifndef particleFixedArraysPS_h
+#define particleFixedArraysPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for storing the motion of a group of particles using fixed point ("sub-pixel") positions and velocities.
+Normal particles (particlePS) have whole number positions and move one LED at a time, with their speed set by how often they move (in ms).
+This means they jump from LED to LED, and need to be updated often to look smooth.
+Fixed point particles instead store their position in 1/256ths of an LED, and move by a fractional velocity each update.
+When drawn using particleUtilsPS::drawFixedParticle(), a particle's color is split across the two LEDs it falls between,
+based on how far it is between them. So a particle that is 3/4 of the way from LED 5 to LED 6 is drawn at 1/4 brightness on LED 5,
+and 3/4 brightness on LED 6. This makes the particle glide smoothly between LEDs, even at low update rates.
+
+The values:
+    position: The particle's position in 1/256ths of an LED, ie a position of 256 is LED 1, and 384 is halfway between LEDs 1 and 2.
+              The lower 8 bits are the fractional part of the position. You can use (position >> 8) to get the whole LED.
+              (The position is 32 bit, so particles aren't limited to the first 256 LEDs)
+    velocity: How far the particle moves each update in 1/256ths of an LED (8.8 fixed point).
+              ie a velocity of 128 moves the particle half an LED each update, while -512 moves it two LEDs backwards.
+              Note that velocities are per update, not per ms, so they are tied to the update rate of whatever is moving them.
+              particleUtilsPS::loadParticleToFixed() can be used to convert a normal particle's speed to a velocity.
+              (ParticlesSL does this for its "smoothMove" setting, see ParticlesSL.h)
+    maxPosition: The number of LEDs the particle moves across (whole LEDs). 
+                 Particles either wrap back to 0, or bounce back (reversing their velocity) once they reach it.
+
+All the arrays are held in a single allocation, to limit heap fragmentation.
+Like with other structs, it must be initialized with its pointers set to null:
+    particleFixedArraysPS fixedArrays = {nullptr}; //Must init structs w/ pointers set to null for safety
+    particleUtilsPS::resizeFixedArrays(fixedArrays, 10); //Creates arrays for 10 particles
+    particleUtilsPS::setFixedParticle(fixedArrays, 0, 0, 96, 60); //Particle 0 starts at 0, moving 96/256ths of an LED each update, across 60 LEDs
+
+    //each update:
+    particleUtilsPS::advanceFixedArrays(fixedArrays, false); //move the particles, wrapping at the end
+    particleUtilsPS::drawFixedParticle(segSet, fixedArrays.position[0], fixedArrays.maxPosition[0], color, 0, true);
+
+!!The arrays are created dynamically, so make sure you free them using particleUtilsPS::freeFixedArrays() when you're done. */
+struct particleFixedArraysPS {
+    uint32_t *position;     //the current position of each particle, in 1/256ths of an LED (also the start of the array allocation)
+    int16_t *velocity;      //the velocity of each particle, in 1/256ths of an LED per update (8.8 fixed point)
+    uint16_t *maxPosition;  //the number of LEDs each particle moves across before wrapping or bouncing
+    uint16_t length;        //the number of particles
+    uint16_t maxLength;     //the maximum number of particles the arrays can hold (used for memory management)
+};
+
+#endif
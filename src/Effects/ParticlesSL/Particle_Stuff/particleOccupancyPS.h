@@ -0,0 +1,56 @@
+#ifndef particleOccupancyPS_h
+#define particleOccupancyPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for tracking how many particles are covering each position in a group of particle paths (lines, segments, etc).
+Particle effects often need to know if a position is clear, such as checking if a new particle can spawn without
+landing on top of another, or if a pixel can be set back to the background without cutting a hole in a different particle.
+Without a record of the particles' positions, the only way to answer these is to check every particle, or read the pixel colors back.
+
+Instead, effects add a count to a position when part of a particle (its body or trails) moves onto it,
+and remove the count when the particle moves off it. Since particles only move one step at a time, this is just one add and one remove
+per move. Checking if a position is occupied is then a single lookup.
+
+The counts are laid out path by path, ie for a grid with 10 columns (positions on each path), the first 10 entries are path 0, etc.
+For example, RainSL uses its segment lines as the rows and the segments as the columns.
+Counts are 8 bit, so up to 255 particles can share a position.
+
+Working with a grid (see particleUtilsPS for the functions):
+    particleOccupancyPS partOccupancy = {nullptr}; //Must init structs w/ pointers set to null for safety
+    particleUtilsPS::resizeParticleOccupancy(partOccupancy, 60, 4); //Creates a grid with 60 positions on 4 paths, all clear
+
+    //As a particle moves from position 10 to 11 on path 2, with its tail moving off position 5
+    particleUtilsPS::addParticleOccupancy(partOccupancy, 11, 2);
+    if( particleUtilsPS::removeParticleOccupancy(partOccupancy, 5, 2) ) {
+        //position 5 is now clear, so we can set it to the background
+    }
+
+    if( !partOccupancy.isOccupied(0, 2) ) {
+        //the start of path 2 is clear, so we can spawn a particle there
+    }
+
+Note that it's up to the effect to keep the counts balanced (every add needs a matching remove),
+and to only pass in positions that are within the grid.
+
+!!The grid is created dynamically, so make sure you free the countArr when you're done by calling memUtilsPS::freePS(partOccupancy.countArr). */
+struct particleOccupancyPS {
+    uint8_t *countArr;   //pointer to the count array
+    uint16_t numCols;    //the number of positions on each path
+    uint16_t numRows;    //the number of paths
+    uint16_t maxLength;  //The total length of the countArr, used for memory management (see patternPS for more)
+
+    //Returns true if any particles are covering the passed in column and row
+    bool isOccupied(uint16_t col, uint16_t row) {
+        return countArr[row * numCols + col];
+    };
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef particlePoolPS_h
+#define particlePoolPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for tracking which particles in a fixed group of particles are in use (active) or free (inactive).
+Effects like RainSL and FireworksPS pre-allocate enough particles for their maximum number of drops/sparks,
+but usually only a few are active at any one time. Rather than checking every particle each update to see if it's active,
+the pool keeps a dense list of the active particles' indexes, so update loops only need to touch the live particles.
+It also keeps a list of the free particle indexes, so a new particle can be spawned without searching for an inactive one.
+
+The pool only stores particle indexes, so it works alongside a particleSetPS and/or particleArraysPS,
+with the same index used for all of them.
+
+Working with a pool (see particleUtilsPS for the functions):
+    particlePoolPS partPool = {nullptr}; //Must init structs w/ pointers set to null for safety
+    particleUtilsPS::resizeParticlePool(partPool, 20); //Creates a pool for 20 particles, all free
+
+    //To spawn a particle (make sure a particle is free first!):
+    if( partPool.numFree > 0 ) {
+        uint16_t partNum = particleUtilsPS::spawnPoolParticle(partPool);
+    }
+
+    //To step through the active particles, go backwards through the active list
+    //This way, you can de-spawn a particle as you go without skipping any others
+    for( uint16_t i = partPool.numActive; i > 0; i-- ) {
+        uint16_t partNum = partPool.activeList[i - 1];
+        ...
+        particleUtilsPS::despawnPoolParticle(partPool, partNum); //if the particle is done
+    }
+
+!!The pool's lists are created dynamically, so make sure you free them using particleUtilsPS::freeParticlePool() when you're done. */
+struct particlePoolPS {
+    uint16_t *freeList;     //stack of the free particle indexes (also the start of the list allocation)
+    uint16_t *activeList;   //dense list of the active particle indexes
+    uint16_t *activeSlot;   //the location of each active particle in the activeList (used to remove particles quickly)
+    uint16_t numFree;       //the number of free particles
+    uint16_t numActive;     //the number of active particles
+    uint16_t length;        //the number of particles in the pool
+    uint16_t maxLength;     //the maximum number of particles the pool can hold (used for memory management)
+};
+
+#endif
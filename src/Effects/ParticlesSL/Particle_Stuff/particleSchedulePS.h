@@ -0,0 +1,51 @@
+#ifndef particleSchedulePS_h
+#define particleSchedulePS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for scheduling when a group of particles are next due to move.
+Particles move at their own speeds (the time between each step in ms), so normally each update we need to check every particle
+to see if enough time has passed for it to move. If most of the particles are slow, this means checking a lot of particles that aren't moving.
+
+Instead, the schedule keeps the particles in a "min heap" ordered by the time each particle is next due to move.
+The particle that is due soonest is always at the top of the heap, so each update we only need to take the particles
+off the top of the heap until we reach one that isn't due yet. Each particle that moves is put back into the heap at its next due time.
+Adding, removing, or re-scheduling a particle takes time proportional to log2(the number of scheduled particles),
+so the cost of an update depends on how many particles are moving, rather than how many particles there are.
+
+The schedule only stores particle indexes, so it works alongside a particleSetPS and/or particleArraysPS,
+with the same index used for all of them. 
+Only particles that are scheduled are moved, so when a particle becomes inactive, remove it from the schedule.
+
+Working with a schedule (see particleUtilsPS for the functions):
+    particleSchedulePS partSchedule = {nullptr}; //Must init structs w/ pointers set to null for safety
+    particleUtilsPS::resizeParticleSchedule(partSchedule, 20); //Creates a schedule for 20 particles, with none scheduled
+
+    //Schedule particle 3 to move at 500ms
+    particleUtilsPS::scheduleParticle(partSchedule, 3, 500);
+
+    //Move all the scheduled particles that are due (using a particleArraysPS)
+    //Each moved particle is re-scheduled using its speed
+    particleUtilsPS::advanceParticleArrays(partArrays, partSchedule, millis());
+
+    //The time that the next particle will be due (only valid if partSchedule.numScheduled > 0)
+    unsigned long nextTime = particleUtilsPS::getNextDueTime(partSchedule);
+
+!!The schedule's lists are created dynamically, so make sure you free them using particleUtilsPS::freeParticleSchedule() when you're done. */
+struct particleSchedulePS {
+    unsigned long *dueTime;  //the time each particle is next due to move (ms) (also the start of the list allocation)
+    uint16_t *heap;          //the indexes of the scheduled particles, ordered as a min heap by due time
+    uint16_t *heapSlot;      //the location of each particle in the heap (65535 if the particle isn't scheduled)
+    uint16_t numScheduled;   //the number of particles in the heap
+    uint16_t length;         //the number of particles in the schedule
+    uint16_t maxLength;      //the maximum number of particles the schedule can hold (used for memory management)
+};
+
+#endif
@@ -35,13 +35,13 @@ particleSetPS particleUtilsPS::buildParticleSet(uint16_t numParticles, uint16_t
                                                 bool randColor) {
 
     //particlePS **particleArr = new particlePS*[numParticles];
-    particlePS **particleArr = (particlePS **)malloc(numParticles * sizeof(particlePS *));
+    particlePS **particleArr = (particlePS **)memUtilsPS::allocPS(numParticles * sizeof(particlePS *));
     particleSetPS newParticleSet = {particleArr, numParticles, numParticles};
 
     //create a new set of particles
     for( uint16_t i = 0; i < numParticles; i++ ) {
         //particlePS *p = new particlePS();
-        particlePS *p = (particlePS *)malloc(sizeof(particlePS));
+        particlePS *p = (particlePS *)memUtilsPS::allocPS(sizeof(particlePS));
         newParticleSet.setParticle(p, i);
     }
 
@@ -275,7 +275,7 @@ void particleUtilsPS::freeParticleSet(particleSetPS &particleSet) {
         freeAllParticles(particleSet);
     }
     //Now free the pointer to the particle array itself
-    free(particleSet.particleArr);
+    memUtilsPS::freePS(particleSet.particleArr);
 }
 
 //Frees all the particles pointers in a particleSet, should only be used if the particles were generated using malloc()
@@ -291,7 +291,436 @@ void particleUtilsPS::freeAllParticles(particleSetPS &particleSet) {
 //Frees the pointer to a particle in a particleSet, should only be used if the particles was generated using malloc()
 //!!!DO NOT call this if the particle set was not created using malloc() or buildParticleSet()
 void particleUtilsPS::freeParticle(particleSetPS &particleSet, uint16_t partNum) {
-    free(particleSet.particleArr[partNum]);
+    memUtilsPS::freePS(particleSet.particleArr[partNum]);
+}
+
+//Sets the particle arrays to hold the passed in number of particles
+//The arrays are only re-allocated if they need to be larger (or alwaysResizeObj_PS is true)
+//All the arrays are held in a single allocation, so the array pointers are set to point into it
+//Note that any existing particle values are not preserved if the arrays are re-allocated
+//!!!Make sure you free the arrays using freeParticleArrays() when you're done with them
+void particleUtilsPS::resizeParticleArrays(particleArraysPS &partArrays, uint16_t numParticles) {
+    if( alwaysResizeObj_PS || !partArrays.lastUpdateTime || (numParticles > partArrays.maxLength) ) {
+        memUtilsPS::freePS(partArrays.lastUpdateTime);
+        //The lastUpdateTime array goes first, so that the block stays aligned for the unsigned longs
+        partArrays.lastUpdateTime = (unsigned long *)memUtilsPS::allocPS(numParticles * (sizeof(unsigned long) + 4 * sizeof(uint16_t)));
+        partArrays.position = (uint16_t *)(partArrays.lastUpdateTime + numParticles);
+        partArrays.maxPosition = partArrays.position + numParticles;
+        partArrays.speed = partArrays.maxPosition + numParticles;
+        partArrays.life = partArrays.speed + numParticles;
+        partArrays.maxLength = numParticles;
+    }
+    partArrays.length = numParticles;
+}
+
+//Frees the particle array memory
+//(all the arrays are held in a single allocation starting at lastUpdateTime)
+void particleUtilsPS::freeParticleArrays(particleArraysPS &partArrays) {
+    memUtilsPS::freePS(partArrays.lastUpdateTime);
+    partArrays.lastUpdateTime = nullptr;
+    partArrays.maxLength = 0;
+    partArrays.length = 0;
+}
+
+//Copies the motion properties of a particle into the particle arrays at partNum
+//maxPosition is the position where the particle will wrap back to 0
+void particleUtilsPS::loadParticleToArrays(particleArraysPS &partArrays, uint16_t partNum, particlePS *particle, uint16_t maxPosition) {
+    partArrays.position[partNum] = particle->position;
+    partArrays.maxPosition[partNum] = maxPosition;
+    partArrays.speed[partNum] = particle->speed;
+    partArrays.life[partNum] = particle->life;
+    partArrays.lastUpdateTime[partNum] = particle->lastUpdateTime;
+}
+
+//Moves the particles in the particle arrays that are due to move in the passed in particle schedule (see particleSchedulePS.h)
+//Only the particles at the top of the schedule's heap that are due are touched, so the cost depends on the number of moving particles.
+//Each particle is moved one step forward (wrapping back to 0 at its maxPosition),
+//and is re-scheduled to move again after its speed has passed.
+//Particle life is ignored, since the schedule tracks what particles are active.
+//(Particles with a speed of 0 are re-scheduled for the next ms, so that they only move once per update)
+//Returns the number of particles moved.
+uint16_t particleUtilsPS::advanceParticleArrays(particleArraysPS &partArrays, particleSchedulePS &partSchedule, unsigned long currentTime) {
+    uint16_t numMoved = 0;
+    uint16_t partNum;
+    //Note that we compare the times using a signed difference so that the schedule works across millis() rollover
+    while( partSchedule.numScheduled > 0 && (long)(currentTime - partSchedule.dueTime[partSchedule.heap[0]]) >= 0 ) {
+        partNum = partSchedule.heap[0];
+
+        partPosTemp = partArrays.position[partNum] + 1;
+        if( partPosTemp >= partArrays.maxPosition[partNum] ) {
+            partPosTemp = 0;
+        }
+        partArrays.position[partNum] = partPosTemp;
+        partArrays.lastUpdateTime[partNum] = currentTime;
+        numMoved++;
+
+        //re-schedule the particle, since it's at the top of the heap, we only need to sift it down
+        partSchedule.dueTime[partNum] = currentTime + (partArrays.speed[partNum] ? partArrays.speed[partNum] : 1);
+        siftScheduleDown(partSchedule, 0);
+    }
+    return numMoved;
+}
+
+//Sets the particle schedule to hold the passed in number of particles, and resets it so that no particles are scheduled
+//The schedule's lists are only re-allocated if they need to be larger (or alwaysResizeObj_PS is true)
+//All the lists are held in a single allocation
+//!!!Make sure you free the schedule using freeParticleSchedule() when you're done with it
+void particleUtilsPS::resizeParticleSchedule(particleSchedulePS &partSchedule, uint16_t numParticles) {
+    if( alwaysResizeObj_PS || !partSchedule.dueTime || (numParticles > partSchedule.maxLength) ) {
+        memUtilsPS::freePS(partSchedule.dueTime);
+        //The dueTime array goes first, so that the block stays aligned for the unsigned longs
+        partSchedule.dueTime = (unsigned long *)memUtilsPS::allocPS(numParticles * (sizeof(unsigned long) + 2 * sizeof(uint16_t)));
+        partSchedule.heap = (uint16_t *)(partSchedule.dueTime + numParticles);
+        partSchedule.heapSlot = partSchedule.heap + numParticles;
+        partSchedule.maxLength = numParticles;
+    }
+    partSchedule.length = numParticles;
+    resetParticleSchedule(partSchedule);
+}
+
+//Removes all the particles from the schedule
+void particleUtilsPS::resetParticleSchedule(particleSchedulePS &partSchedule) {
+    for( uint16_t i = 0; i < partSchedule.length; i++ ) {
+        partSchedule.heapSlot[i] = 65535;
+    }
+    partSchedule.numScheduled = 0;
+}
+
+//Frees the particle schedule memory
+//(all the lists are held in a single allocation starting at dueTime)
+void particleUtilsPS::freeParticleSchedule(particleSchedulePS &partSchedule) {
+    memUtilsPS::freePS(partSchedule.dueTime);
+    partSchedule.dueTime = nullptr;
+    partSchedule.maxLength = 0;
+    partSchedule.length = 0;
+    partSchedule.numScheduled = 0;
+}
+
+//Schedules a particle to move at the passed in time (ms)
+//If the particle is already scheduled, its due time is changed
+void particleUtilsPS::scheduleParticle(particleSchedulePS &partSchedule, uint16_t partNum, unsigned long dueTime) {
+    uint16_t slot = partSchedule.heapSlot[partNum];
+    partSchedule.dueTime[partNum] = dueTime;
+
+    //if the particle isn't in the heap, add it to the bottom
+    if( slot == 65535 ) {
+        slot = partSchedule.numScheduled;
+        partSchedule.heap[slot] = partNum;
+        partSchedule.heapSlot[partNum] = slot;
+        partSchedule.numScheduled++;
+    }
+
+    //move the particle into place in the heap (only one of these will actually move it)
+    siftScheduleUp(partSchedule, slot);
+    siftScheduleDown(partSchedule, partSchedule.heapSlot[partNum]);
+}
+
+//Removes a particle from the schedule (does nothing if the particle isn't scheduled)
+//The last particle in the heap is moved into the removed particle's place, and then sifted into order
+void particleUtilsPS::unscheduleParticle(particleSchedulePS &partSchedule, uint16_t partNum) {
+    uint16_t slot = partSchedule.heapSlot[partNum];
+    if( slot == 65535 ) {
+        return;
+    }
+
+    partSchedule.numScheduled--;
+    partSchedule.heapSlot[partNum] = 65535;
+    if( slot == partSchedule.numScheduled ) {
+        return;
+    }
+
+    uint16_t lastPartNum = partSchedule.heap[partSchedule.numScheduled];
+    partSchedule.heap[slot] = lastPartNum;
+    partSchedule.heapSlot[lastPartNum] = slot;
+    siftScheduleUp(partSchedule, slot);
+    siftScheduleDown(partSchedule, partSchedule.heapSlot[lastPartNum]);
+}
+
+//Returns the time the next scheduled particle is due to move
+//!!Make sure there are particles in the schedule before calling (partSchedule.numScheduled > 0)
+unsigned long particleUtilsPS::getNextDueTime(particleSchedulePS &partSchedule) {
+    return partSchedule.dueTime[partSchedule.heap[0]];
+}
+
+//Moves the particle at the passed in heap slot up the heap until its parent is due before it
+void particleUtilsPS::siftScheduleUp(particleSchedulePS &partSchedule, uint16_t slot) {
+    uint16_t parent;
+    while( slot > 0 ) {
+        parent = (slot - 1) / 2;
+        if( !scheduleBefore(partSchedule, slot, parent) ) {
+            return;
+        }
+        swapScheduleSlots(partSchedule, slot, parent);
+        slot = parent;
+    }
+}
+
+//Moves the particle at the passed in heap slot down the heap until both its children are due after it
+void particleUtilsPS::siftScheduleDown(particleSchedulePS &partSchedule, uint16_t slot) {
+    uint16_t child;
+    while( true ) {
+        child = slot * 2 + 1;
+        if( child >= partSchedule.numScheduled ) {
+            return;
+        }
+        //pick the child that is due first
+        if( (child + 1) < partSchedule.numScheduled && scheduleBefore(partSchedule, child + 1, child) ) {
+            child++;
+        }
+        if( !scheduleBefore(partSchedule, child, slot) ) {
+            return;
+        }
+        swapScheduleSlots(partSchedule, slot, child);
+        slot = child;
+    }
+}
+
+//Swaps the particles in two heap slots, updating their recorded slots
+void particleUtilsPS::swapScheduleSlots(particleSchedulePS &partSchedule, uint16_t slotA, uint16_t slotB) {
+    uint16_t partNum = partSchedule.heap[slotA];
+    partSchedule.heap[slotA] = partSchedule.heap[slotB];
+    partSchedule.heap[slotB] = partNum;
+    partSchedule.heapSlot[partSchedule.heap[slotA]] = slotA;
+    partSchedule.heapSlot[partNum] = slotB;
+}
+
+//Returns true if the particle in heap slotA is due before the particle in heap slotB
+//(we compare the times using a signed difference so that the schedule works across millis() rollover)
+bool particleUtilsPS::scheduleBefore(particleSchedulePS &partSchedule, uint16_t slotA, uint16_t slotB) {
+    return (long)(partSchedule.dueTime[partSchedule.heap[slotA]] - partSchedule.dueTime[partSchedule.heap[slotB]]) < 0;
+}
+
+//Sets the fixed point particle arrays to hold the passed in number of particles
+//The arrays are only re-allocated if they need to be larger (or alwaysResizeObj_PS is true)
+//All the arrays are held in a single allocation
+//!!!Make sure you free the arrays using freeFixedArrays() when you're done with them
+void particleUtilsPS::resizeFixedArrays(particleFixedArraysPS &fixedArrays, uint16_t numParticles) {
+    if( alwaysResizeObj_PS || !fixedArrays.position || (numParticles > fixedArrays.maxLength) ) {
+        memUtilsPS::freePS(fixedArrays.position);
+        //The position array goes first, so that the block stays aligned for the 32 bit positions
+        fixedArrays.position = (uint32_t *)memUtilsPS::allocPS(numParticles * (sizeof(uint32_t) + sizeof(int16_t) + sizeof(uint16_t)));
+        fixedArrays.velocity = (int16_t *)(fixedArrays.position + numParticles);
+        fixedArrays.maxPosition = (uint16_t *)(fixedArrays.velocity + numParticles);
+        fixedArrays.maxLength = numParticles;
+    }
+    fixedArrays.length = numParticles;
+}
+
+//Frees the fixed point particle array memory
+//(all the arrays are held in a single allocation starting at position)
+void particleUtilsPS::freeFixedArrays(particleFixedArraysPS &fixedArrays) {
+    memUtilsPS::freePS(fixedArrays.position);
+    fixedArrays.position = nullptr;
+    fixedArrays.maxLength = 0;
+    fixedArrays.length = 0;
+}
+
+//Sets the position (in 1/256ths of an LED), velocity (in 1/256ths of an LED per update),
+//and maxPosition (in whole LEDs) of a fixed point particle (see particleFixedArraysPS.h)
+void particleUtilsPS::setFixedParticle(particleFixedArraysPS &fixedArrays, uint16_t partNum, uint32_t position, int16_t velocity, uint16_t maxPosition) {
+    fixedArrays.position[partNum] = position;
+    fixedArrays.velocity[partNum] = velocity;
+    fixedArrays.maxPosition[partNum] = maxPosition;
+}
+
+//Copies the position and direction of a normal particle into the fixed point arrays at partNum,
+//converting its speed (the ms between each LED step) into a velocity (the fraction of an LED moved each update)
+//The rate is the time between each update of the fixed point particles (ms)
+//So a particle with a speed of 80ms being updated every 20ms will move 1/4 of an LED each update (a velocity of 64)
+//(velocities are capped at 127 LEDs per update)
+//If the fixed point particle is already on the particle's LED, its fractional position is kept,
+//so you can re-load particles each update to pick up any speed or direction changes without them jumping
+void particleUtilsPS::loadParticleToFixed(particleFixedArraysPS &fixedArrays, uint16_t partNum, particlePS *particle, uint16_t maxPosition, uint16_t rate) {
+    fixedPosTemp = ((uint32_t)rate << 8) / (particle->speed ? particle->speed : 1);
+    if( fixedPosTemp > 32767 ) {
+        fixedPosTemp = 32767;
+    }
+    if( (fixedArrays.position[partNum] >> 8) != particle->position ) {
+        fixedArrays.position[partNum] = (uint32_t)particle->position << 8;
+    }
+    fixedArrays.velocity[partNum] = fixedPosTemp * getDirectStep(particle->direction);
+    fixedArrays.maxPosition[partNum] = maxPosition;
+}
+
+//Moves every particle in the fixed point arrays by its velocity (see advanceFixedParticle())
+void particleUtilsPS::advanceFixedArrays(particleFixedArraysPS &fixedArrays, bool bounce) {
+    for( uint16_t i = 0; i < fixedArrays.length; i++ ) {
+        advanceFixedParticle(fixedArrays, i, bounce);
+    }
+}
+
+//Moves the particle at partNum in the fixed point arrays by its velocity
+//If bounce is true, a particle that reaches either end of its maxPosition is reflected back, reversing its velocity
+//otherwise it wraps to the other end
+//(Since particles are drawn across two LEDs, a bouncing particle turns around when it reaches its last LED (maxPosition - 1)
+//so that it never spills off the end)
+void particleUtilsPS::advanceFixedParticle(particleFixedArraysPS &fixedArrays, uint16_t partNum, bool bounce) {
+    int32_t maxFixedPos;
+    fixedPosTemp = (int32_t)fixedArrays.position[partNum] + fixedArrays.velocity[partNum];
+
+    if( bounce ) {
+        maxFixedPos = ((int32_t)fixedArrays.maxPosition[partNum] - 1) << 8;
+        if( fixedPosTemp < 0 ) {
+            fixedPosTemp = -fixedPosTemp;
+            fixedArrays.velocity[partNum] = -fixedArrays.velocity[partNum];
+        } else if( fixedPosTemp > maxFixedPos ) {
+            fixedPosTemp = 2 * maxFixedPos - fixedPosTemp;
+            fixedArrays.velocity[partNum] = -fixedArrays.velocity[partNum];
+        }
+    } else {
+        maxFixedPos = (int32_t)fixedArrays.maxPosition[partNum] << 8;
+        if( fixedPosTemp < 0 ) {
+            fixedPosTemp += maxFixedPos;
+        } else if( fixedPosTemp >= maxFixedPos ) {
+            fixedPosTemp -= maxFixedPos;
+        }
+    }
+    fixedArrays.position[partNum] = fixedPosTemp;
+}
+
+/* Draws a fixed point particle (see particleFixedArraysPS.h) on a segment set along its segment lines,
+splitting the particle's color between the two lines it falls between.
+The color is blended into each line based on how close the particle is to it, so the particle glides smoothly from line to line.
+The particle is drawn on all the segments, like in ParticlesSL.
+If wrap is true, a particle that is between the last line (maxPosition - 1) and the first line will be split between them
+otherwise only the last line is drawn.
+Because the particle is blended into the existing LED colors, it will leave a faint trail as it moves, 
+so you should re-fill the background before drawing the particles each update.
+The colorMode is the color mode of the particle (see segDrawUtils::setPixelColor). */
+void particleUtilsPS::drawFixedParticle(SegmentSetPS &segSet, uint32_t position, uint16_t maxPosition, CRGB &color, uint8_t colorMode, bool wrap) {
+    uint16_t lineNum = position >> 8;
+    uint8_t frac = position & 0xFF;
+    uint16_t nextLineNum = lineNum + 1;
+    uint16_t pixelNum;
+    CRGB colorFinal;
+
+    if( nextLineNum >= maxPosition ) {
+        nextLineNum = wrap ? 0 : segSet.numLines;
+    }
+
+    for( uint16_t i = 0; i < segSet.numSegs; i++ ) {
+        //the line the particle is past gets the inverse of the fraction
+        if( lineNum < segSet.numLines ) {
+            pixelNum = segDrawUtils::getPixelNumFromLineNum(segSet, i, lineNum);
+            colorFinal = segDrawUtils::getPixelColor(segSet, pixelNum, color, colorMode, i, lineNum);
+            segSet.leds[pixelNum] = blend(segSet.leds[pixelNum], colorFinal, 255 - frac);
+        }
+
+        //the line the particle is moving towards gets the fraction
+        //(we skip it if the particle is right on the first line)
+        if( frac > 0 && nextLineNum < segSet.numLines ) {
+            pixelNum = segDrawUtils::getPixelNumFromLineNum(segSet, i, nextLineNum);
+            colorFinal = segDrawUtils::getPixelColor(segSet, pixelNum, color, colorMode, i, nextLineNum);
+            segSet.leds[pixelNum] = blend(segSet.leds[pixelNum], colorFinal, frac);
+        }
+    }
+}
+
+//Sets the particle pool to hold the passed in number of particles, and resets the pool so that all particles are free
+//The pool's lists are only re-allocated if they need to be larger (or alwaysResizeObj_PS is true)
+//All the lists are held in a single allocation
+//!!!Make sure you free the pool using freeParticlePool() when you're done with it
+void particleUtilsPS::resizeParticlePool(particlePoolPS &partPool, uint16_t numParticles) {
+    if( alwaysResizeObj_PS || !partPool.freeList || (numParticles > partPool.maxLength) ) {
+        memUtilsPS::freePS(partPool.freeList);
+        partPool.freeList = (uint16_t *)memUtilsPS::allocPS(numParticles * 3 * sizeof(uint16_t));
+        partPool.activeList = partPool.freeList + numParticles;
+        partPool.activeSlot = partPool.activeList + numParticles;
+        partPool.maxLength = numParticles;
+    }
+    partPool.length = numParticles;
+    resetParticlePool(partPool);
+}
+
+//Sets all the particles in a pool as free
+//The free list is filled in reverse so that the particles are spawned in index order (0, 1, 2, etc)
+void particleUtilsPS::resetParticlePool(particlePoolPS &partPool) {
+    for( uint16_t i = 0; i < partPool.length; i++ ) {
+        partPool.freeList[i] = partPool.length - 1 - i;
+    }
+    partPool.numFree = partPool.length;
+    partPool.numActive = 0;
+}
+
+//Frees the particle pool memory
+//(all the lists are held in a single allocation starting at freeList)
+void particleUtilsPS::freeParticlePool(particlePoolPS &partPool) {
+    memUtilsPS::freePS(partPool.freeList);
+    partPool.freeList = nullptr;
+    partPool.maxLength = 0;
+    partPool.length = 0;
+    partPool.numFree = 0;
+    partPool.numActive = 0;
+}
+
+//Takes a free particle from the pool, adds it to the active list, and returns its index
+//!!Make sure the pool has a free particle before calling (partPool.numFree > 0)
+uint16_t particleUtilsPS::spawnPoolParticle(particlePoolPS &partPool) {
+    partPool.numFree--;
+    uint16_t partNum = partPool.freeList[partPool.numFree];
+
+    partPool.activeSlot[partNum] = partPool.numActive;
+    partPool.activeList[partPool.numActive] = partNum;
+    partPool.numActive++;
+    return partNum;
+}
+
+//Removes an active particle from the pool's active list and returns it to the free list
+//The last particle in the active list is moved into the removed particle's spot, keeping the list dense
+//(so if you're stepping through the active list, go backwards, see particlePoolPS.h)
+//!!Make sure the particle is active before calling
+void particleUtilsPS::despawnPoolParticle(particlePoolPS &partPool, uint16_t partNum) {
+    uint16_t slot = partPool.activeSlot[partNum];
+    uint16_t lastPartNum = partPool.activeList[partPool.numActive - 1];
+
+    partPool.activeList[slot] = lastPartNum;
+    partPool.activeSlot[lastPartNum] = slot;
+    partPool.numActive--;
+
+    partPool.freeList[partPool.numFree] = partNum;
+    partPool.numFree++;
+}
+
+//Sets the occupancy grid to the passed in number of columns (positions on each path) and rows (paths), and clears it
+//The count array is only re-allocated if it needs to be larger (or alwaysResizeObj_PS is true)
+//!!!Make sure you free the countArr when you're done with it
+void particleUtilsPS::resizeParticleOccupancy(particleOccupancyPS &partOccupancy, uint16_t numCols, uint16_t numRows) {
+    uint16_t length = numCols * numRows;
+    if( alwaysResizeObj_PS || !partOccupancy.countArr || (length > partOccupancy.maxLength) ) {
+        memUtilsPS::freePS(partOccupancy.countArr);
+        partOccupancy.countArr = (uint8_t *)memUtilsPS::allocPS(length * sizeof(uint8_t));
+        partOccupancy.maxLength = length;
+    }
+    partOccupancy.numCols = numCols;
+    partOccupancy.numRows = numRows;
+    clearParticleOccupancy(partOccupancy);
+}
+
+//Sets all the positions in the occupancy grid to clear (no particles)
+void particleUtilsPS::clearParticleOccupancy(particleOccupancyPS &partOccupancy) {
+    uint16_t length = partOccupancy.numCols * partOccupancy.numRows;
+    for( uint16_t i = 0; i < length; i++ ) {
+        partOccupancy.countArr[i] = 0;
+    }
+}
+
+//Records that part of a particle has moved onto the passed in position
+//(The count is capped at 255, see particleOccupancyPS.h)
+void particleUtilsPS::addParticleOccupancy(particleOccupancyPS &partOccupancy, uint16_t col, uint16_t row) {
+    uint8_t &count = partOccupancy.countArr[row * partOccupancy.numCols + col];
+    if( count < 255 ) {
+        count++;
+    }
+}
+
+//Records that part of a particle has moved off the passed in position
+//Returns true if the position is now clear (no particles are covering it)
+bool particleUtilsPS::removeParticleOccupancy(particleOccupancyPS &partOccupancy, uint16_t col, uint16_t row) {
+    uint8_t &count = partOccupancy.countArr[row * partOccupancy.numCols + col];
+    if( count > 0 ) {
+        count--;
+    }
+    return count == 0;
 }
 
 /* Returns a particle trail color, blended towards the `targetColor` by the ratio `steps / totalSteps`.
@@ -2,8 +2,16 @@
 #define particleUtilsPS_h
 
 #include "particlePS.h"
+#include "particleArraysPS.h"
+#include "particlePoolPS.h"
+#include "particleOccupancyPS.h"
+#include "particleFixedArraysPS.h"
+#include "particleSchedulePS.h"
 #include "ColorUtils/colorUtilsPS.h"
 #include "MathUtils/mathUtilsPS.h"
+#include "Segment_Stuff/segDrawUtils.h"
+#include "Memory_Stuff/memUtilsPS.h"
+#include "./Include_Lists/GlobalVars/GlobalVars.h"  //need alwaysResizeObj_PS
 
 /* Particles need a bit of an explanation.
 A particle is a moving pixel. Particles can move backwards or forwards along the strip. They move at their own speeds.
@@ -73,6 +81,61 @@ namespace particleUtilsPS {
         setTrailRand(particleSetPS &particleSet, uint16_t partNum, bool noTrails,
                      bool oneTrail, bool twoTrail, bool revTrail, bool infTrail);
 
+    //functions for particle arrays (see particleArraysPS.h)
+    void
+        resizeParticleArrays(particleArraysPS &partArrays, uint16_t numParticles),
+        freeParticleArrays(particleArraysPS &partArrays),
+        loadParticleToArrays(particleArraysPS &partArrays, uint16_t partNum, particlePS *particle, uint16_t maxPosition);
+
+    uint16_t
+        advanceParticleArrays(particleArraysPS &partArrays, particleSchedulePS &partSchedule, unsigned long currentTime);
+
+    //functions for particle schedules (see particleSchedulePS.h)
+    void
+        resizeParticleSchedule(particleSchedulePS &partSchedule, uint16_t numParticles),
+        resetParticleSchedule(particleSchedulePS &partSchedule),
+        freeParticleSchedule(particleSchedulePS &partSchedule),
+        scheduleParticle(particleSchedulePS &partSchedule, uint16_t partNum, unsigned long dueTime),
+        unscheduleParticle(particleSchedulePS &partSchedule, uint16_t partNum),
+        siftScheduleUp(particleSchedulePS &partSchedule, uint16_t slot),
+        siftScheduleDown(particleSchedulePS &partSchedule, uint16_t slot),
+        swapScheduleSlots(particleSchedulePS &partSchedule, uint16_t slotA, uint16_t slotB);
+
+    unsigned long
+        getNextDueTime(particleSchedulePS &partSchedule);
+
+    bool
+        scheduleBefore(particleSchedulePS &partSchedule, uint16_t slotA, uint16_t slotB);
+
+    //functions for fixed point particles (see particleFixedArraysPS.h)
+    void
+        resizeFixedArrays(particleFixedArraysPS &fixedArrays, uint16_t numParticles),
+        freeFixedArrays(particleFixedArraysPS &fixedArrays),
+        setFixedParticle(particleFixedArraysPS &fixedArrays, uint16_t partNum, uint32_t position, int16_t velocity, uint16_t maxPosition),
+        loadParticleToFixed(particleFixedArraysPS &fixedArrays, uint16_t partNum, particlePS *particle, uint16_t maxPosition, uint16_t rate),
+        advanceFixedArrays(particleFixedArraysPS &fixedArrays, bool bounce),
+        advanceFixedParticle(particleFixedArraysPS &fixedArrays, uint16_t partNum, bool bounce),
+        drawFixedParticle(SegmentSetPS &segSet, uint32_t position, uint16_t maxPosition, CRGB &color, uint8_t colorMode, bool wrap);
+
+    //functions for particle pools (see particlePoolPS.h)
+    void
+        resizeParticlePool(particlePoolPS &partPool, uint16_t numParticles),
+        resetParticlePool(particlePoolPS &partPool),
+        freeParticlePool(particlePoolPS &partPool),
+        despawnPoolParticle(particlePoolPS &partPool, uint16_t partNum);
+
+    uint16_t
+        spawnPoolParticle(particlePoolPS &partPool);
+
+    //functions for particle occupancy grids (see particleOccupancyPS.h)
+    void
+        resizeParticleOccupancy(particleOccupancyPS &partOccupancy, uint16_t numCols, uint16_t numRows),
+        clearParticleOccupancy(particleOccupancyPS &partOccupancy),
+        addParticleOccupancy(particleOccupancyPS &partOccupancy, uint16_t col, uint16_t row);
+
+    bool
+        removeParticleOccupancy(particleOccupancyPS &partOccupancy, uint16_t col, uint16_t row);
+
     //for getting colors of particles
     CRGB
         getTrailColor(CRGB &color, CRGB &targetColor, uint8_t step, uint8_t totalSteps, int8_t dimPow);
@@ -85,6 +148,12 @@ namespace particleUtilsPS {
     static uint8_t
         dimRatio;
 
+    static uint16_t
+        partPosTemp;
+
+    static int32_t
+        fixedPosTemp;
+
     static uint16_t
         particleSetLength;
 
@@ -13,7 +13,7 @@ ParticlesSL::ParticlesSL(SegmentSetPS &SegSet, palettePS &Palette, CRGB BgColor,
                                                         speedRange, size, sizeRange, trailType, trailSize,
                                                         trailRange, bounce, colorIndex, randColor);
     particleSet = &particleSetTemp;
-    trailEndColors = (CRGB *)malloc(numParticles * sizeof(CRGB));
+    trailEndColors = (CRGB *)memUtilsPS::allocPS(numParticles * sizeof(CRGB));
 }
 
 //constructor for using a particle set you've already made
@@ -21,7 +21,7 @@ ParticlesSL::ParticlesSL(SegmentSetPS &SegSet, particleSetPS &ParticleSet, palet
     : particleSet(&ParticleSet), palette(&Palette)  //
 {
     init(BgColor, SegSet);
-    trailEndColors = (CRGB *)malloc((particleSet->maxLength) * sizeof(CRGB));
+    trailEndColors = (CRGB *)memUtilsPS::allocPS((particleSet->maxLength) * sizeof(CRGB));
 }
 
 //destructor
@@ -32,7 +32,10 @@ ParticlesSL::ParticlesSL(SegmentSetPS &SegSet, particleSetPS &ParticleSet, palet
 ParticlesSL::~ParticlesSL() {
     //clear the memory of the existing particles (to prevent a memory leak)
     particleUtilsPS::freeParticleSet(particleSetTemp);
-    free(trailEndColors);
+    memUtilsPS::freePS(trailEndColors);
+    particleUtilsPS::freeFixedArrays(fixedArrays);
+    memUtilsPS::freePS(bgCache.pixelArr);
+    memUtilsPS::freePS(bgCache.segLayout.segPtrArr);
 }
 
 //initializes the core variables of the effect
@@ -60,8 +63,8 @@ void ParticlesSL::setParticleSet(particleSetPS &newParticleSet) {
     //This helps prevent memory fragmentation by limiting the number of heap allocations
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || (newParticleSet.maxLength > particleSet->maxLength) ) {
-        free(trailEndColors);
-        trailEndColors = (CRGB *)malloc((newParticleSet.maxLength) * sizeof(CRGB));
+        memUtilsPS::freePS(trailEndColors);
+        trailEndColors = (CRGB *)memUtilsPS::allocPS((newParticleSet.maxLength) * sizeof(CRGB));
     }
 
     particleSet = &newParticleSet;
@@ -105,9 +108,16 @@ void ParticlesSL::update() {
         prevTime = currentTime;
 
         //refill the background if directed (if we're using a dynamic rainbow or something)
-        if( fillBg || blend ) {
-            segDrawUtils::fillSegSetColor(*segSet, *bgColor, bgColorMode);
+        //Smooth particles are blended into the background, so we always refill it for them
+        //(including for the first update after smoothMove is turned off, to clear out the smooth particles)
+        if( fillBg || blend || smoothMove || smoothOn ) {
+            if( cacheBg ) {
+                segDrawUtils::fillSegSetColorCached(*segSet, bgCache, *bgColor, bgColorMode);
+            } else {
+                segDrawUtils::fillSegSetColor(*segSet, *bgColor, bgColorMode);
+            }
         }
+        smoothOn = smoothMove;
 
         //re-fetch the segment vars in-case they've been modified
         numParticles = particleSet->length;
@@ -115,6 +125,12 @@ void ParticlesSL::update() {
         numSegs = segSet->numSegs;
         longestSeg = segSet->segNumMaxNumLines;
 
+        if( smoothMove ) {
+            updateSmooth();
+            showCheckPS();
+            return;
+        }
+
         /* for each particle, in order:
         move it to it's next position (ie line number) (if needed)
         then set the line at the previous location to the BgColor (including trail ends)
@@ -269,6 +285,32 @@ void ParticlesSL::update() {
     }
 }
 
+//Updates the particles using sub-pixel motion (see smoothMove in the .h file)
+//Each update, the particles are loaded into the fixed point arrays, picking up any changes to their speeds, directions, etc
+//(their speeds are converted to the fraction of a line they move each update using the effect's rate)
+//They are then moved and drawn split across the two lines they fall between (see particleFixedArraysPS.h)
+//Their new positions and directions are copied back into the particles, so they stay up to date
+void ParticlesSL::updateSmooth() {
+    if( !fixedArrays.position || fixedArrays.length != numParticles ) {
+        particleUtilsPS::resizeFixedArrays(fixedArrays, numParticles);
+    }
+
+    for( uint16_t i = 0; i < numParticles; i++ ) {
+        particlePtr = particleSet->particleArr[i];
+        bounce = particlePtr->bounce;
+
+        particleUtilsPS::loadParticleToFixed(fixedArrays, i, particlePtr, numLines, *rate);
+        particleUtilsPS::advanceFixedParticle(fixedArrays, i, bounce);
+
+        particlePtr->position = fixedArrays.position[i] >> 8;
+        particlePtr->direction = (fixedArrays.velocity[i] >= 0);
+        particlePtr->lastUpdateTime = currentTime;
+
+        partColor = paletteUtilsPS::getPaletteColor(*palette, particlePtr->colorIndex);
+        particleUtilsPS::drawFixedParticle(*segSet, fixedArrays.position[i], numLines, partColor, colorMode, !bounce);
+    }
+}
+
 //Moves the particle according to it's direction
 //also handles bounce behavior
 //when bouncing, the whole particle body is reversed, so it's head position is
@@ -156,6 +156,18 @@ Other Settings:
                             See explanation of this in more detail above in effect intro
     fillBg (default false) -- Sets the background to be redrawn every update, useful for bgColorModes that are dynamic
                              Warning!: Not compatible with infinite trails (mode 4). They will be drawn over.
+    cacheBg (default true, false on AVR chips) -- If true, the background colors are cached when the background is re-drawn each update,
+                                                 so they can be copied straight back to the pixels, rather than being re-calculated.
+                                                 The cache is re-built automatically whenever the background changes (see bgCachePS.h).
+                                                 It uses 5 bytes of memory per pixel, so it's turned off by default on AVR chips.
+    smoothMove (default false) -- If true, the particles glide smoothly from line to line using sub-pixel motion,
+                                  rather than jumping a whole line at a time (see particleFixedArraysPS.h).
+                                  Each particle is drawn as a single dot, split between the two lines it's between,
+                                  so the particle sizes and trails are ignored, and the background is re-drawn every update.
+                                  The particle speeds are converted to the fraction of a line moved each update using the effect's rate,
+                                  so the motion is smooth even at slower rates. A rate of 20 - 30ms works well (raise it from the default 5ms).
+                                  Particles slower than (rate * 256) ms won't move.
+                                  Uses an extra 8 bytes of memory per particle.
     *particleSet -- The effect's particle set. Is a pointer, so you can bind it to an external set. 
                     If the effect builds a particle set for you, `particleSet`, 
                     will be bound to the effect's local set, `particleSetTemp`. 
@@ -192,7 +204,9 @@ class ParticlesSL : public EffectBasePS {
 
         bool
             blend = false,  //sets if particles should add onto one another
-            fillBg = false;
+            fillBg = false,
+            cacheBg = BG_USE_CACHE_PS,
+            smoothMove = false;
 
         CRGB
             *trailEndColors = nullptr,  //used to store the last colors of each trail, so the background color can be set
@@ -245,7 +259,8 @@ class ParticlesSL : public EffectBasePS {
         bool
             direction,
             bounce,
-            movePart;
+            movePart,
+            smoothOn = false;
 
         particlePS
             *particlePtr = nullptr;
@@ -255,8 +270,15 @@ class ParticlesSL : public EffectBasePS {
             partColor,
             colorFinal;
 
+        bgCachePS
+            bgCache = {};  //Must init structs w/ pointers set to null for safety
+
+        particleFixedArraysPS
+            fixedArrays = {};  //Must init structs w/ pointers set to null for safety
+
         void
             init(CRGB BgColor, SegmentSetPS &SegSet),
+            updateSmooth(),
             moveParticle(particlePS *particlePtr),
             setTrailColor(uint16_t trailLineNum, uint16_t segNum, uint8_t trailPixelNum);
 };
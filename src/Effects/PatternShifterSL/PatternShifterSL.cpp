@@ -13,6 +13,12 @@ PatternShifterSL::PatternShifterSL(shiftPatternPS &ShiftPattern, palettePS &Pale
     reset();
 }
 
+PatternShifterSL::~PatternShifterSL() {
+    memUtilsPS::freePS(shiftScroll.rowArr);
+    memUtilsPS::freePS(shiftScroll.pixelArr);
+    memUtilsPS::freePS(shiftScroll.segLayout.segPtrArr);
+}
+
 //resets the effect to restart it
 void PatternShifterSL::reset() {
     cycleNum = 0;
@@ -77,17 +83,69 @@ void PatternShifterSL::setRepeat(bool newRepeat) {
     } else {
         modVal = numLines;
     }
+
+    buildScroll();
+}
+
+//Lays out the pattern across the segment lines, recording which pattern "row" is drawn on each line
+//(the lines are "virtual", covering the whole repeated pattern, so there are modVal of them) 
+//We do this by drawing the pattern as it would be for cycleNum 0, but only recording the pattern rows
+//instead of drawing colors. Any lines not covered by the pattern are left as 65535.
+//Each update we then scroll the lines forward by the cycleNum, see update().
+//Note that the pattern's segments are not shifted, so the segments just map directly onto the pattern's columns.
+void PatternShifterSL::buildScroll() {
+    shiftScrollUtilsPS::resizeScroll(shiftScroll, modVal, numPatSegs);
+
+    for( uint16_t i = 0; i < modVal; i++ ) {
+        shiftScroll.rowArr[i] = 65535;
+    }
+
+    for( uint16_t i = 0; i < numPatSegs; i++ ) {
+        shiftScroll.colArr[i] = i;
+    }
+
+    //We run over each pattern "row", getting the start and end lines,
+    //and then record the row for each line it covers
+    //We repeat this process repeatCount number of times (min of 1), offsetting where the lines are each time
+    for( uint16_t i = 0; i < numPatRows * repeatCount; i++ ) {
+
+        //The current pattern row, adjusted for repeat number
+        patternRow = mod16PS(i, numPatRows);
+
+        //The number of the repeat we're on, ie the "second repeat out of four"
+        curRepeatNum = i / numPatRows;
+
+        //Get the starting index for the current pattern "row"
+        rowStartIndex = shiftPattern->getPatRowStartIndex(patternRow);
+
+        //Get the pattern "row's" starting line, and then offset it by which repeat we're on, wrapping as needed
+        //We also do the same to get the end line
+        startLine = shiftPattern->getLineStartOrEnd(patternRow, false);
+        startLine = addMod16PS(startLine, patLineLength * curRepeatNum, modVal);
+
+        endLine = shiftPattern->getLineStartOrEnd(patternRow, true);
+        endLine = addMod16PS(endLine, patLineLength * curRepeatNum, modVal);
+
+        //Record the pattern row for each line between the start and end lines
+        //Note that because the pattern may be wrapping, the endLine may actually be before the start line
+        //But because shiftPatterns are continuous, if we also wrap as we increment j, we know that
+        //we will eventually reach the end line
+        for( uint16_t j = startLine; j != endLine; j = addMod16PS(j, 1, modVal) ) {
+            shiftScroll.rowArr[j] = rowStartIndex;
+        }
+    }
 }
 
 /* Updates the effect
 For info on shiftPatterns, see shiftPatternPS.h
 The goal of the effect is to move the shiftPattern across the segment set lines.
-For each update we draw the pattern, offsetting the start and end points by the cycleNum (which is incremented after each update)
-So the pattern is shifted across the segment set one line at a time.
-If we're repeating, then we draw the pattern up to repeatCount number of times, 
+When the pattern or repeat is set, we lay the pattern out across a set of "virtual" segment lines, 
+recording which pattern "row" is drawn on each line (see buildScroll()). 
+If we're repeating, then the pattern is laid out up to repeatCount number of times, 
 with each new pattern being offset by the patLineLength (how many segment lines the pattern covers)
 so that the patterns are placed directly one after another, filling the whole segment set.
-We draw each pattern segment line by line, seg by seg, filling in each pixel as we go according to the shiftPattern
+For each update we then draw the pattern rows onto the segment set, offsetting the lines by the cycleNum 
+(which is incremented after each update), so the pattern is shifted across the segment set one line at a time.
 Note that since we move the pattern's segment lines, the pattern can be longer than the segment lines,
 with any extra parts being cycled on as the pattern moves.
 On the other hand, the length of the segment pattern cannot be greater than the number of segments in the segment set
@@ -105,61 +163,9 @@ void PatternShifterSL::update() {
             segDrawUtils::drawSegLine(*segSet, prevLine, *bgColor, bgColorMode);
         }
 
-        //To draw the pattern, we run over each pattern "row", getting the start and end lines,
-        //and then filling in each line and segment according to the "row" in shiftPattern array
-        //We repeat this process repeatLineCount number of times (min of 1), offsetting where the lines are each time
-        for( uint16_t i = 0; i < numPatRows * repeatCount; i++ ) {
-
-            //The current pattern row, adjusted for repeat number
-            patternRow = mod16PS(i, numPatRows);
-
-            //The number of the repeat we're on, ie the "second repeat out of four"
-            curRepeatNum = i / numPatRows;
-
-            //Get the starting index for the current pattern "row"
-            rowStartIndex = shiftPattern->getPatRowStartIndex(patternRow);
-
-            //Get the pattern "row's" starting line, and then offset it by the cycleNum and which repeat we're on, wrapping as needed
-            //This moves the pattern over time
-            //We also do the same to get the end line
-            startLine = shiftPattern->getLineStartOrEnd(patternRow, false);
-            startLine = addMod16PS(startLine, cycleNum + patLineLength * curRepeatNum, modVal);
-
-            endLine = shiftPattern->getLineStartOrEnd(patternRow, true);
-            endLine = addMod16PS(endLine, cycleNum + patLineLength * curRepeatNum, modVal);
-
-            //Draw the pattern row between the start and end lines
-            //We draw each line segment by segment, getting each segment pixel color individually
-            //Note that because the pattern may be wrapping, the endLine may actually be before the start line
-            //But because shiftPatterns are continuous, if we also wrap as we increment j, we know that
-            //we will eventually reach the end line
-            for( uint16_t j = startLine; j != endLine; j = addMod16PS(j, 1, modVal) ) {
-                //If the pattern is longer than the number of segment lines, some
-                //of the pattern will always be off the segment set,
-                //We don't want to try to draw these, so we skip them
-                if( j >= numLines ) {
-                    continue;
-                }
-
-                //For each segment we get the colorIndex from the pattern, the output the color
-                for( uint16_t k = 0; k < numPatSegs; k++ ) {
-                    //Get the color index of the segment pixel in the pattern
-                    colorIndex = shiftPattern->getLineColorIndexQuick(rowStartIndex, k);
-                    //In shiftPatterns, 255 indicates a background
-                    //so we need to check for this before outputting
-                    if( colorIndex == 255 ) {
-                        colorOut = *bgColor;
-                        modeOut = bgColorMode;
-                    } else {
-                        colorOut = paletteUtilsPS::getPaletteColor(*palette, colorIndex);
-                        modeOut = colorMode;
-                    }
-                    //get the physical pixel location and output the color and colorMode
-                    pixelNum = segDrawUtils::getPixelNumFromLineNum(*segSet, k, j);
-                    segDrawUtils::setPixelColor(*segSet, pixelNum, colorOut, modeOut, k, j);
-                }
-            }
-        }
+        //Draw the pattern, scrolled forward along the segment lines by the cycleNum
+        //(the pattern segments are not shifted)
+        shiftScrollUtilsPS::drawScroll(*segSet, shiftScroll, *shiftPattern, *palette, *bgColor, colorMode, bgColorMode, cycleNum, 0, cachePixels);
 
         //Set prevLine, which is the line that must be turned off if we're not repeating the shiftPattern
         //The prevLine is just the current location of the first line in the shiftPattern, since shiftPatterns always move forwards
@@ -5,6 +5,7 @@
 #include "GeneralUtils/generalUtilsPS.h"
 #include "shiftPatternPS.h"
 #include "MathUtils/mathUtilsPS.h"
+#include "Utils/shiftScrollUtilsPS.h"
 
 //TODO -- add "bounce" ability? Could just reverse direction of cycleNum at each end
 //        If you want to flip the pattern, you'll need to flip the start/end lines -> add/subtract the patternLineLen?
@@ -49,8 +50,14 @@ The bgColor is a pointer, so you can bind it to an external color variable.
 
 This effect is fully compatible with Color Modes.
 
-!!While you can change the values of a pattern during runtime, you should avoid changing the row/column dimensions.
-You can change the pattern using the `setShiftPattern()` function.
+!!While you can change the values of a pattern during runtime, you should avoid changing the row/column dimensions,
+or the segment lines of the pattern "rows". You can change the pattern using the `setShiftPattern()` function.
+
+Since a shift pattern doesn't change shape as it moves, the effect lays the pattern out across the segment lines once
+(when the pattern or repeat is set), and then just scrolls it forward by one segment line each update
+(see shiftScrollPS.h for more). This makes long patterns, like marquee-style arrows and flags, much faster to draw,
+because only the visible segment lines are drawn each update. Note that this uses 2 bytes of memory for each segment line and segment the pattern covers,
+plus 2 bytes for each segment line pixel if cachePixels is on (see Other Settings below).
 
     Repeating Patterns:
         The shiftPattern can be set to repeat, 
@@ -105,6 +112,9 @@ Constructor inputs:
 Other Settings:
     colorMode (default 0) -- sets the color mode for the pattern pixels (see segDrawUtils::setPixelColor)
     bgColorMode (default 0) -- sets the color mode for the background pixels (see segDrawUtils::setPixelColor)
+    cachePixels (default true, false on AVR chips) -- If true, the physical address of each segment line pixel is cached,
+                                                      so the pixels don't need to be looked up each update. 
+                                                      Uses 2 bytes of memory per pixel (numLines * numSegs).
 
 Functions:
     setShiftPattern(shiftPatternPS *newShiftPattern) -- Sets the effect's shiftPattern.
@@ -124,6 +134,8 @@ class PatternShifterSL : public EffectBasePS {
     public:
         PatternShifterSL(shiftPatternPS &ShiftPattern, palettePS &Palette, CRGB BgColor, bool Repeat, uint16_t Rate);
 
+        ~PatternShifterSL();
+
         uint8_t
             colorMode = 0,
             bgColorMode = 0;
@@ -132,7 +144,8 @@ class PatternShifterSL : public EffectBasePS {
             cycleNum = 0;  //for reference only
 
         bool
-            repeat;  //for reference only, set using setRepeat()
+            repeat,  //for reference only, set using setRepeat()
+            cachePixels = SHIFT_CACHE_PIXELS_PS;
 
         CRGB
             bgColorOrig,
@@ -155,14 +168,9 @@ class PatternShifterSL : public EffectBasePS {
             currentTime,
             prevTime = 0;
 
-        uint8_t
-            modeOut,
-            colorIndex;
-
         uint16_t
             numPatSegs,
             numLines,
-            pixelNum,
             numPatRows,
             patternRow,
             patLineLength,
@@ -174,8 +182,11 @@ class PatternShifterSL : public EffectBasePS {
             prevLine = 65535,
             repeatCount = 1;
 
-        CRGB
-            colorOut;
+        shiftScrollPS
+            shiftScroll = {};  //Must init structs w/ pointers set to null for safety
+
+        void
+            buildScroll();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,59 @@
+#ifndef shiftScrollPS_h
+#define shiftScrollPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "Segment_Stuff/SegmentSetPS.h"
+#include "Segment_Stuff/segLayoutPS.h"
+
+//The PatternShifter effects cache the physical address of each segment line pixel by default,
+//except on AVR chips, where the cache's 2 bytes per pixel are a large chunk of memory
+#ifdef __AVR__
+    #define SHIFT_CACHE_PIXELS_PS false
+#else
+    #define SHIFT_CACHE_PIXELS_PS true
+#endif
+
+/*
+A struct for scrolling a shiftPattern (see shiftPatternPS.h) across a segment set, used by the PatternShifter effects.
+A shift pattern doesn't change shape as it moves, each update is just the last one shifted by a single segment line or segment.
+So, rather than walking through all the pattern "rows" and repeats every update, the pattern is laid out once into two maps:
+    The rowArr, which stores the pattern "row" drawn on each segment line (as the row's start index in the patternArr).
+    The colArr, which stores the pattern column drawn on each segment (the pattern row index of the segment's color).
+Both maps use 65535 for lines/segments where nothing is drawn.
+To move the pattern, the effects just rotate where the maps start on the segment set (like a ring buffer),
+see shiftScrollUtilsPS::drawScroll(). Each pixel's color is still read from the shiftPattern and palette when it is drawn,
+so changes to the pattern's color indexes or to the palette show up as normal.
+
+If caching is turned on, the physical address of each segment line pixel is also stored in the pixelArr,
+so that they don't have to be looked up with getPixelNumFromLineNum() every update. 
+The pixel cache is re-built automatically whenever the segment set's layout changes.
+It uses 2 bytes for each line pixel (numLines * numSegs), so it is turned off by default on AVR chips.
+
+You shouldn't need to set any of the struct's variables yourself, they are managed by the PatternShifter effects
+and the shiftScrollUtilsPS functions.
+Like with other structs, it must be initialized with its pointers set to null:
+    shiftScrollPS shiftScroll = {}; //Must init structs w/ pointers set to null for safety
+!!The maps are created dynamically, so make sure you free them when you're done by calling
+memUtilsPS::freePS(shiftScroll.rowArr), memUtilsPS::freePS(shiftScroll.pixelArr), 
+and memUtilsPS::freePS(shiftScroll.segLayout.segPtrArr).
+(the colArr shares its memory with the rowArr, so it does not need to be freed) */
+struct shiftScrollPS {
+    uint16_t *rowArr;         //the start index of the pattern "row" drawn on each segment line (65535 if there isn't one)
+    uint16_t *colArr;         //the pattern column drawn on each segment (65535 if there isn't one), stored in the rowArr's memory block
+    uint16_t numRows;         //the length of the rowArr
+    uint16_t numCols;         //the length of the colArr
+    uint16_t maxLength;       //The total length of the rowArr memory block, used for memory management (see patternPS for more)
+    uint16_t *pixelArr;       //the cached physical address of each segment line pixel, line by line
+    uint16_t pixelMaxLength;  //The total length of the pixelArr, used for memory management
+    segLayoutPS segLayout;    //the segment set layout the pixel cache was built for (see segLayoutPS.h)
+    uint16_t numLines;        //the segment set's number of lines when the pixel cache was built
+};
+
+#endif
@@ -0,0 +1,128 @@
+#include "shiftScrollUtilsPS.h"
+
+//Sizes the rowArr and colArr maps of a shiftScrollPS to hold "numRows" segment lines and "numCols" segments
+//Both maps are stored in the same memory block, with the colArr after the rowArr
+//Like other library objects, the memory is only re-allocated if it needs to grow, unless alwaysResizeObj_PS is true
+//Note that the maps are not cleared, the effects fill them in themselves
+void shiftScrollUtilsPS::resizeScroll(shiftScrollPS &shiftScroll, uint16_t numRows, uint16_t numCols) {
+    if( alwaysResizeObj_PS || (numRows + numCols > shiftScroll.maxLength) ) {
+        memUtilsPS::freePS(shiftScroll.rowArr);
+        shiftScroll.rowArr = (uint16_t *)memUtilsPS::allocPS((numRows + numCols) * sizeof(uint16_t));
+        shiftScroll.maxLength = numRows + numCols;
+    }
+    shiftScroll.colArr = shiftScroll.rowArr + numRows;
+    shiftScroll.numRows = numRows;
+    shiftScroll.numCols = numCols;
+}
+
+//Makes sure the pixelArr of a shiftScrollPS holds the physical address of every segment line pixel in the segment set
+//stored line by line, ie the address of segment 2 on line 5 is at pixelArr[5 * numSegs + 2]
+//The addresses are only re-built if the segment set or its layout has changed (checked exactly, see segLayoutPS.h)
+void shiftScrollUtilsPS::updatePixelCache(SegmentSetPS &SegSet, shiftScrollPS &shiftScroll) {
+    numLines = SegSet.numLines;
+    numSegs = SegSet.numSegs;
+
+    if( !segDrawUtils::updateSegLayout(SegSet, shiftScroll.segLayout) && shiftScroll.pixelArr && shiftScroll.numLines == numLines ) {
+        return;
+    }
+
+    if( alwaysResizeObj_PS || (numLines * numSegs > shiftScroll.pixelMaxLength) ) {
+        memUtilsPS::freePS(shiftScroll.pixelArr);
+        shiftScroll.pixelArr = (uint16_t *)memUtilsPS::allocPS(numLines * numSegs * sizeof(uint16_t));
+        shiftScroll.pixelMaxLength = numLines * numSegs;
+    }
+
+    for( uint16_t i = 0; i < numLines; i++ ) {
+        for( uint16_t j = 0; j < numSegs; j++ ) {
+            shiftScroll.pixelArr[i * numSegs + j] = segDrawUtils::getPixelNumFromLineNum(SegSet, j, i);
+        }
+    }
+
+    shiftScroll.numLines = numLines;
+}
+
+/* Draws a shiftPattern onto a segment set using the rowArr and colArr maps of a shiftScrollPS (see shiftScrollPS.h)
+The maps are treated as rings, with the map entry at index 0 being drawn on line "lineOffset" and segment "segOffset", 
+so to move the pattern along the lines or segments you just need to increase the offsets by 1 each update.
+(the offsets must be less than the map lengths)
+Only the lines and segments that are on both the segment set and the maps are drawn, 
+and any lines or segments that have no pattern row or column are skipped (are left as they are).
+Like in the PatternShifter effects, pattern color indexes of 255 are drawn in the bgColor with the bgColorMode,
+while all other indexes are drawn using the palette with the colorMode.
+If "cachePixels" is true, the physical address of each pixel is cached in the shiftScroll's pixelArr
+(see updatePixelCache()), otherwise they are looked up using getPixelNumFromLineNum(). 
+(pixels drawn with color modes 1 and 6 are always looked up) */
+void shiftScrollUtilsPS::drawScroll(SegmentSetPS &SegSet, shiftScrollPS &shiftScroll, shiftPatternPS &shiftPattern, palettePS &palette,
+                                    const CRGB &bgColor, uint8_t colorMode, uint8_t bgColorMode, uint16_t lineOffset, uint16_t segOffset, bool cachePixels) {
+    if( !shiftScroll.rowArr || shiftScroll.numRows == 0 || shiftScroll.numCols == 0 ) {
+        return;
+    }
+
+    if( cachePixels ) {
+        updatePixelCache(SegSet, shiftScroll);
+    }
+
+    //We only draw the lines and segments that are in both the maps and the segment set
+    numLines = SegSet.numLines;
+    if( numLines > shiftScroll.numRows ) {
+        numLines = shiftScroll.numRows;
+    }
+
+    numSegs = SegSet.numSegs;
+    if( numSegs > shiftScroll.numCols ) {
+        numSegs = shiftScroll.numCols;
+    }
+
+    //The map index for line/segment 0
+    //Because the maps are offset forwards, we need to step backwards from 0 by the offset (wrapping)
+    rowStart = mod16PS(shiftScroll.numRows - mod16PS(lineOffset, shiftScroll.numRows), shiftScroll.numRows);
+    colStart = mod16PS(shiftScroll.numCols - mod16PS(segOffset, shiftScroll.numCols), shiftScroll.numCols);
+
+    rowIndex = rowStart;
+    for( uint16_t i = 0; i < numLines; i++ ) {
+        rowStartIndex = shiftScroll.rowArr[rowIndex];
+
+        //Only draw the line if it has a pattern row
+        if( rowStartIndex != 65535 ) {
+            colIndex = colStart;
+            for( uint16_t j = 0; j < numSegs; j++ ) {
+                colNum = shiftScroll.colArr[colIndex];
+
+                //Only draw the segment if it has a pattern column
+                if( colNum != 65535 ) {
+                    //Get the color index of the segment pixel in the pattern
+                    colorIndex = shiftPattern.getLineColorIndexQuick(rowStartIndex, colNum);
+                    //In shiftPatterns, 255 indicates a background
+                    //so we need to check for this before outputting
+                    if( colorIndex == 255 ) {
+                        colorOut = bgColor;
+                        modeOut = bgColorMode;
+                    } else {
+                        colorOut = paletteUtilsPS::getPaletteColor(palette, colorIndex);
+                        modeOut = colorMode;
+                    }
+
+                    //get the physical pixel location and output the color and colorMode
+                    //Color modes 1 and 6 need the pixel's location in the segment set, which is only set by looking up the pixel
+                    //(see segDrawUtils::getPixelColor()), so we can't use the cached pixel for them
+                    if( cachePixels && modeOut != 1 && modeOut != 6 ) {
+                        pixelNum = shiftScroll.pixelArr[i * SegSet.numSegs + j];
+                    } else {
+                        pixelNum = segDrawUtils::getPixelNumFromLineNum(SegSet, j, i);
+                    }
+                    segDrawUtils::setPixelColor(SegSet, pixelNum, colorOut, modeOut, j, i);
+                }
+
+                colIndex++;
+                if( colIndex == shiftScroll.numCols ) {
+                    colIndex = 0;
+                }
+            }
+        }
+
+        rowIndex++;
+        if( rowIndex == shiftScroll.numRows ) {
+            rowIndex = 0;
+        }
+    }
+}
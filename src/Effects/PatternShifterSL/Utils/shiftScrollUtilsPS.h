@@ -0,0 +1,52 @@
+#ifndef shiftScrollUtilsPS_h
+#define shiftScrollUtilsPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "Include_Lists/SegmentFiles.h"
+#include "Include_Lists/PaletteFiles.h"
+#include "Memory_Stuff/memUtilsPS.h"
+#include "MathUtils/mathUtilsPS.h"
+#include "Effects/EffectBasePS.h"  //need bindSegSetPtrPS() for shiftPatternPS
+#include "Effects/PatternShifterSL/shiftPatternPS.h"
+#include "shiftScrollPS.h"
+
+/*
+Functions for drawing a shiftPattern that scrolls across a segment set, used by the PatternShifter effects.
+The effects lay out their pattern into the rowArr and colArr maps of a shiftScrollPS,
+and then draw it each update using drawScroll(), offsetting the maps to move the pattern (see shiftScrollPS.h). */
+namespace shiftScrollUtilsPS {
+
+    void
+        resizeScroll(shiftScrollPS &shiftScroll, uint16_t numRows, uint16_t numCols),
+        updatePixelCache(SegmentSetPS &SegSet, shiftScrollPS &shiftScroll),
+        drawScroll(SegmentSetPS &SegSet, shiftScrollPS &shiftScroll, shiftPatternPS &shiftPattern, palettePS &palette,
+                   const CRGB &bgColor, uint8_t colorMode, uint8_t bgColorMode, uint16_t lineOffset, uint16_t segOffset, bool cachePixels);
+
+    //pre-allocated space for function variables
+    static uint8_t
+        colorIndex,
+        modeOut;
+
+    static uint16_t
+        numLines,
+        numSegs,
+        rowStart,
+        colStart,
+        rowIndex,
+        colIndex,
+        rowStartIndex,
+        colNum,
+        pixelNum;
+
+    static CRGB
+        colorOut;
+};
+
+#endif
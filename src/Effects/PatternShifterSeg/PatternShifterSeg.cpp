@@ -14,6 +14,12 @@ PatternShifterSeg::PatternShifterSeg(shiftPatternPS &ShiftPattern, palettePS &Pa
     reset();
 }
 
+PatternShifterSeg::~PatternShifterSeg() {
+    memUtilsPS::freePS(shiftScroll.rowArr);
+    memUtilsPS::freePS(shiftScroll.pixelArr);
+    memUtilsPS::freePS(shiftScroll.segLayout.segPtrArr);
+}
+
 //resets the effect to restart it
 void PatternShifterSeg::reset() {
     cycleNum = 0;
@@ -90,22 +96,81 @@ void PatternShifterSeg::setRepeat(bool newRepeatSeg, bool newRepeatLine) {
     } else {
         modVal = numSegs;
     }
+
+    buildScroll();
+}
+
+//Lays out the pattern across the segment set, recording which pattern "row" is drawn on each segment line,
+//and which pattern column is drawn on each segment
+//(the segments are "virtual", covering the whole repeated pattern, so there are modVal of them)
+//We do this by drawing the pattern as it would be for cycleNum 0, but only recording the pattern rows and columns
+//instead of drawing colors. Any lines or segments not covered by the pattern are left as 65535.
+//Each update we then scroll the segments along by the cycleNum, see update().
+void PatternShifterSeg::buildScroll() {
+    shiftScrollUtilsPS::resizeScroll(shiftScroll, numLines, modVal);
+
+    for( uint16_t i = 0; i < numLines; i++ ) {
+        shiftScroll.rowArr[i] = 65535;
+    }
+
+    //Each segment takes its color from the pattern column matching its place in the pattern,
+    //wrapping for each repeat, with any segments after the pattern (and its repeats) being left blank
+    for( uint16_t i = 0; i < modVal; i++ ) {
+        if( i < numPatSegs * repeatSegCount ) {
+            shiftScroll.colArr[i] = mod16PS(i, numPatSegs);
+        } else {
+            shiftScroll.colArr[i] = 65535;
+        }
+    }
+
+    //We run over each pattern "row", getting the start and end lines,
+    //and then record the row for each line it covers
+    //We repeat this process repeatLineCount number of times (min of 1), offsetting where the lines are each time
+    for( uint16_t i = 0; i < numPatRows * repeatLineCount; i++ ) {
+
+        //The current pattern row, adjusted for repeat number
+        patternRow = mod16PS(i, numPatRows);
+
+        //The number of the repeat we're on, ie the "second repeat out of four"
+        repeatLineNum = i / numPatRows;
+
+        //Get the starting index for the current pattern "row"
+        rowStartIndex = shiftPattern->getPatRowStartIndex(patternRow);
+
+        //Get the pattern "row's" starting line, and then offset it by which repeat we're on
+        //We also do the same to get the end line
+        startLine = shiftPattern->getLineStartOrEnd(patternRow, false);
+        startLine = startLine + patLineLength * repeatLineNum;
+
+        endLine = shiftPattern->getLineStartOrEnd(patternRow, true);
+        endLine = endLine + patLineLength * repeatLineNum;
+
+        //Record the pattern row for each line between the start and end lines
+        for( uint16_t j = startLine; j != endLine; j++ ) {
+            //If the current line falls outside of the segment set, we need to skip it
+            if( j >= numLines ) {
+                continue;
+            }
+            shiftScroll.rowArr[j] = rowStartIndex;
+        }
+    }
 }
 
 /* Updates the effect
 For info on shiftPatterns, see shiftPatternPS.h
 The goal of the effect is to shift the segment section of the pattern by one every update cycle
 Ie so the pattern shifts along the segments. 
-To do this we draw the pattern segment line by segment line, segment by segment pixel
-To move the pattern, we offset the segments we're drawing to by a cycleNum (which increments each cycle)
-So the pattern for segment 0 may actually be drawn on segment 1 etc.
+When the pattern or repeat is set, we lay the pattern out across the segment set, 
+recording which pattern "row" is drawn on each segment line, and which pattern column is drawn on each segment (see buildScroll()).
 The pattern is allowed to repeat across segment lines and segments, to cover the whole segment set
 (the number of repeats is worked out in setRepeat())
-If we're repeating, then we draw the pattern "rows" repeatLineCount number of times,
+If we're repeating, then the pattern "rows" are laid out repeatLineCount number of times,
 and the segment pattern repeatSegCount number of times, 
 with each new pattern being offset by the patLineLength (how many segment lines the pattern covers),
 or the numPatSegs (how many segments the pattern takes up)
 so that the patterns are placed directly one after another, filling the whole segment set.
+To move the pattern, we offset the segments we're drawing to by a cycleNum (which increments each cycle)
+So the pattern for segment 0 may actually be drawn on segment 1 etc.
 Note that since we never move the pattern's segment lines, the pattern must fit into the segment set, anything extra is cut off
 On the other hand, the length of the segment pattern can be longer than the number of segments in the segment set,
 with any extra parts being cycled on as the pattern moves. */
@@ -117,90 +182,29 @@ void PatternShifterSeg::update() {
 
         numSegs = segSet->numSegs;
 
-        //We use this to shift the segment pattern forward or backward based on the direction
-        //It resolves to either 1 or -1 depending on direct.
-        directStep = direct - !direct;
-
         //If we're not repeating, we need to turn off the last segment
         //that the pattern was on for the previous cycle (as long as it's in the segment set)
         if( !repeatSeg && prevSeg < numSegs ) {
             segDrawUtils::fillSegColor(*segSet, prevSeg, *bgColor, bgColorMode);
         }
 
-        //To draw the pattern, we run over each pattern "row", getting the start and end lines,
-        //and then filling in each segment according to the "row" in shiftPattern array
-        //We repeat this process repeatLineCount number of times (min of 1), offsetting where the lines are each time
-        for( uint16_t i = 0; i < numPatRows * repeatLineCount; i++ ) {
-
-            //The current pattern row, adjusted for repeat number
-            patternRow = mod16PS(i, numPatRows);
-
-            //The number of the repeat we're on, ie the "second repeat out of four"
-            repeatLineNum = i / numPatRows;
-
-            //Get the starting index for the current pattern "row"
-            rowStartIndex = shiftPattern->getPatRowStartIndex(patternRow);
-            //Get the pattern "row's" starting line, and then offset it by the cycleNum and which repeat we're on, wrapping as needed
-            //This moves the pattern over time
-            //We also do the same to get the end line
-            startLine = shiftPattern->getLineStartOrEnd(patternRow, false);
-            startLine = startLine + patLineLength * repeatLineNum;
-
-            endLine = shiftPattern->getLineStartOrEnd(patternRow, true);
-            endLine = endLine + patLineLength * repeatLineNum;
-
-            //Draw the pattern row between the start and end lines
-            //We draw each line segment by segment, getting each segment pixel color individually
-            //Note that because the pattern may be wrapping, the endLine may actually be before the start line
-            //But because shiftPatterns are continuous, if we also wrap as we increment j, we know that
-            //we will eventually reach the end line
-            for( uint16_t j = startLine; j != endLine; j++ ) {
-                //If the current line falls outside of the segment set, we need to avoid drawing it
-                //so we skip its loop iteration
-                if( j >= numLines ) {
-                    continue;
-                }
-
-                //Color in the pixels for each segment in the current pattern row
-                //For each segment we get the colorIndex from the pattern, the output the color
-                //Note that the output segments are shifted according to the cycleNum and direction
-                //We repeat this process repeatSegCount number of times
-                for( uint16_t k = 0; k < numPatSegs * repeatSegCount; k++ ) {
-
-                    //Get the actual output segment, which is shifted by the cycleNum either backwards or forwards depending on the direction
-                    //Note that to keep cycleNum * directStep positive, we add modVal to it.
-                    //(This doesn't change the cycle motion, )
-                    segNum = addMod16PS(k, cycleNum * directStep + modVal, modVal);
-
-                    //For longer shiftPatterns, parts may fall outside the segment set
-                    //we want to avoid drawing these, so we skip them
-                    if( segNum >= numSegs ) {
-                        continue;
-                    }
-
-                    colorIndex = mod16PS(k, numPatSegs);
-                    //Get the color index of the segment pixel in the pattern
-                    colorIndex = shiftPattern->getLineColorIndexQuick(rowStartIndex, colorIndex);
-                    //In shiftPatterns, 255 indicates a background
-                    //so we need to check for this before outputting
-                    if( colorIndex == 255 ) {
-                        colorOut = *bgColor;
-                        modeOut = bgColorMode;
-                    } else {
-                        colorOut = paletteUtilsPS::getPaletteColor(*palette, colorIndex);
-                        modeOut = colorMode;
-                    }
-                    //get the physical pixel location and output the color and colorMode
-                    pixelNum = segDrawUtils::getPixelNumFromLineNum(*segSet, segNum, j);
-                    segDrawUtils::setPixelColor(*segSet, pixelNum, colorOut, modeOut, segNum, j);
-                }
-            }
+        //Work out how far the pattern segments are shifted, either forwards or backwards depending on the direction
+        //When moving backwards, we shift the segments forward by the remainder of the cycle instead, 
+        //which is the same as shifting them backwards by the cycleNum (including wrapping)
+        if( direct ) {
+            segOffset = cycleNum;
+        } else {
+            segOffset = mod16PS(modVal - cycleNum, modVal);
         }
 
+        //Draw the pattern, scrolled along the segments by the segOffset
+        //(the pattern lines are not shifted)
+        shiftScrollUtilsPS::drawScroll(*segSet, shiftScroll, *shiftPattern, *palette, *bgColor, colorMode, bgColorMode, 0, segOffset, cachePixels);
+
         //Set prevSeg, which is the segment that must be turned off if we're not repeating the shiftPattern
         //The prevSeg is just the current location of the first/last segment in the shiftPattern,
         //(first seg if direct is true, last seg if direct is false)
-        //So we just need to work out where the first or last segment is based on the cycleNum
+        //So we just need to work out where the first or last segment is based on the segOffset
         if( direct ) {
             //When moving forward, the segment we need to turn off is always the first segment, shifted by the cycleNum
             //(Since shiftPattern always have the segments in order in each pattern "row", so we always have a colored first segment)
@@ -208,9 +212,8 @@ void PatternShifterSeg::update() {
             prevSeg = cycleNum;
         } else {
             //When moving backwards, the segment we need to turn off is always the last segment in the pattern "row",
-            //but we need to shift the segment by cycleNum, including wrapping
-            //Note that to keep cycleNum * directStep positive, we add modVal to it.
-            prevSeg = addMod16PS(numPatSegs - 1, cycleNum * directStep + modVal, modVal);
+            //shifted by the segOffset, including wrapping
+            prevSeg = addMod16PS(numPatSegs - 1, segOffset, modVal);
         }
 
         //Increment the cycleNum to shift the pattern forward in the next update cycle
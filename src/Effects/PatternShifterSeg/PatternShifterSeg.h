@@ -11,6 +11,7 @@
 #include "GeneralUtils/generalUtilsPS.h"
 #include "Effects/PatternShifterSL/shiftPatternPS.h"
 #include "MathUtils/mathUtilsPS.h"
+#include "Effects/PatternShifterSL/Utils/shiftScrollUtilsPS.h"
 
 /*
 NOTE: You must understand ShiftPatterns to use this effect (see shiftPatternPS.h or the "Shift Pattern''s wiki page).
@@ -54,8 +55,13 @@ The bgColor is a pointer, so you can bind it to an external color variable.
 
 This effect is fully compatible with colorModes.
 
-!!While you can change the values of a pattern during runtime, you should avoid changing the row/column dimensions.
-You can change the pattern using the `setShiftPattern()` function. 
+!!While you can change the values of a pattern during runtime, you should avoid changing the row/column dimensions,
+or the segment lines of the pattern "rows". You can change the pattern using the `setShiftPattern()` function. 
+
+Since a shift pattern doesn't change shape as it moves, the effect lays the pattern out across the segments and lines once
+(when the pattern or repeat is set), and then just scrolls it along by one segment each update
+(see shiftScrollPS.h for more). Note that this uses 2 bytes of memory for each segment line and segment the pattern covers,
+plus 2 bytes for each segment line pixel if cachePixels is on (see Other Settings below).
 
     Repeating Patterns:
         The shift pattern can be set to repeat, segment lines, segments, or both,
@@ -124,6 +130,9 @@ Constructor inputs:
 Other Settings:
     colorMode (default 0) -- sets the color mode for the pattern pixels (see segDrawUtils::setPixelColor)
     bgColorMode (default 0) -- sets the color mode for the background pixels (see segDrawUtils::setPixelColor)
+    cachePixels (default true, false on AVR chips) -- If true, the physical address of each segment line pixel is cached,
+                                                      so the pixels don't need to be looked up each update. 
+                                                      Uses 2 bytes of memory per pixel (numLines * numSegs).
 
 Functions:
     setShiftPattern(shiftPatternPS *newShiftPattern) -- Sets the effect's shiftPattern.
@@ -145,6 +154,8 @@ class PatternShifterSeg : public EffectBasePS {
         PatternShifterSeg(shiftPatternPS &ShiftPattern, palettePS &Palette, CRGB BgColor,
                           bool RepeatLine, bool RepeatSeg, bool Direct, uint16_t Rate);
 
+        ~PatternShifterSeg();
+
         uint8_t
             colorMode = 0,
             bgColorMode = 0;
@@ -155,7 +166,8 @@ class PatternShifterSeg : public EffectBasePS {
         bool
             repeatLine,  //for reference only, set using setRepeat()
             repeatSeg,   //for reference only, set using setRepeat()
-            direct;      //true is first to last segment
+            direct,      //true is first to last segment
+            cachePixels = SHIFT_CACHE_PIXELS_PS;
 
         CRGB
             bgColorOrig,
@@ -178,18 +190,10 @@ class PatternShifterSeg : public EffectBasePS {
             currentTime,
             prevTime = 0;
 
-        int8_t
-            directStep;  //1 or -1
-
-        uint8_t
-            modeOut,
-            colorIndex;
-
         uint16_t
             numPatSegs,
             numLines,
             numSegs,
-            pixelNum,
             numPatRows,
             patternRow,
             patLineLength,
@@ -199,12 +203,15 @@ class PatternShifterSeg : public EffectBasePS {
             startLine,
             endLine,
             prevSeg = 65535,
-            segNum,
+            segOffset,
             repeatLineCount = 1,
             repeatSegCount = 1;
 
-        CRGB
-            colorOut;
+        shiftScrollPS
+            shiftScroll = {};  //Must init structs w/ pointers set to null for safety
+
+        void
+            buildScroll();
 };
 
 #endif
\ No newline at end of file
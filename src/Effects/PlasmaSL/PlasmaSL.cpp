@@ -17,7 +17,8 @@ PlasmaSL::PlasmaSL(SegmentSetPS &SegSet, uint8_t numColors, uint16_t BlendSteps,
 }
 
 PlasmaSL::~PlasmaSL() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(lineColors.colorArr);
 }
 
 //sets up variables for the effect
@@ -74,6 +75,9 @@ void PlasmaSL::update() {
         numLines = segSet->numLines;
         totBlendLength = blendSteps * palette->length;
 
+        //Make sure we have space to store a color for each line
+        segDrawUtils::resizeLineColors(lineColors, numLines);
+
         //run over each of the lines in the segment set and set a color value
         for( uint16_t i = 0; i < numLines; i++ ) {
             //For each of the LED's in the strand, set a brightness based on a wave as follows:
@@ -91,12 +95,12 @@ void PlasmaSL::update() {
             //colorOut = colorUtilsPS::getCrossFadeColor(colorOut, 0, 255 - brightness);
             nscale8x3(colorOut.r, colorOut.g, colorOut.b, brightness);
 
-            //reverse the line number so that the effect moves positively along the strip
-            lineNum = numLines - i - 1;
-
-            //write the color out to all the leds in the segment line
-            segDrawUtils::drawSegLine(*segSet, lineNum, colorOut, 0);
+            lineColors.colorArr[i] = colorOut;
         }
+
+        //write the colors out to all the leds in each segment line in one pass
+        //The lines are reversed so that the effect moves positively along the strip
+        segDrawUtils::drawLineColors(*segSet, lineColors, 0, true);
         showCheckPS();
     }
 }
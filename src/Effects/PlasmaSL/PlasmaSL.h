@@ -178,13 +178,15 @@ class PlasmaSL : public EffectBasePS {
 
         uint16_t
             numLines,
-            lineNum,
             colorIndex,
             totBlendLength;
 
         CRGB
             colorOut;
 
+        lineColorsPS
+            lineColors = {nullptr, 0, 0};  //Must init structs w/ pointers set to null for safety
+
         void
             shiftPhase(uint8_t *phase, uint8_t *phaseTarget, int8_t *phaseStep, uint8_t phaseBase, uint8_t phaseRange),
             init(SegmentSetPS &SegSet, uint16_t Rate);
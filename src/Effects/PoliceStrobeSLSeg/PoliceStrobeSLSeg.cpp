@@ -36,8 +36,8 @@ PoliceStrobeSLSeg::PoliceStrobeSLSeg(SegmentSetPS &SegSet, palettePS &Palette, C
 }
 
 PoliceStrobeSLSeg::~PoliceStrobeSLSeg() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //restarts the effect
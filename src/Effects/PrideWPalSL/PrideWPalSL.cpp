@@ -44,7 +44,8 @@ PrideWPalSL::PrideWPalSL(SegmentSetPS &SegSet, palettePS &Palette, bool BriDirec
 }
 
 PrideWPalSL::~PrideWPalSL() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(lineColors.colorArr);
 }
 
 //Initializes core variables and also picks random values for briThetaInc16 and briThetaFreq if randomBriInc is true
@@ -117,10 +118,12 @@ void PrideWPalSL::update() {
 
         //fetch some core vars
         //we re-fetch these in case the segment set or palette has changed
-        numSegs = segSet->numSegs;
         numLines = segSet->numLines;
         numSteps = gradLength * palette->length;
 
+        //Make sure we have space to store a color for each line
+        segDrawUtils::resizeLineColors(lineColors, numLines);
+
         //For each segment line do the following:
         for( uint16_t i = 0; i < numLines; i++ ) {
 
@@ -153,19 +156,13 @@ void PrideWPalSL::update() {
                 newColor = CHSV(hue8, sat8, bri8);
             }
 
-            //reverse the line number so that the effect moves positively along the strip
-            lineNum = numLines - i - 1;
-
-            for( uint16_t j = 0; j < numSegs; j++ ) {
-                //get the physical pixel location based on the line and seg numbers
-                pixelNum = segDrawUtils::getPixelNumFromLineNum(*segSet, j, lineNum);
-                nblend(segSet->leds[pixelNum], newColor, 128);
-
-                //Need to check to dim the pixel color manually
-                //b/c we're not calling setPixelColor directly
-                segDrawUtils::handleBri(*segSet, pixelNum);
-            }
+            lineColors.colorArr[i] = newColor;
         }
+
+        //Blend the new colors into all the pixels on each line in one pass
+        //The lines are reversed so that the effect moves positively along the strip
+        //(the segment set brightness is handled by drawLineColors())
+        segDrawUtils::drawLineColors(*segSet, lineColors, 0, true, 128);
         showCheckPS();
     }
 }
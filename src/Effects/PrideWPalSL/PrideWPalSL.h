@@ -213,15 +213,15 @@ class PrideWPalSL : public EffectBasePS {
             b16,
             bri16,
             h16_128,
-            pixelNum,
-            lineNum,
-            numSegs,
             numLines;
 
         CRGB
             newColor,
             colorOut;
 
+        lineColorsPS
+            lineColors = {nullptr, 0, 0};  //Must init structs w/ pointers set to null for safety
+
         void
             init(bool RandomBriInc, SegmentSetPS &SegSet, uint16_t Rate);
 };
@@ -44,7 +44,7 @@ PrideWPalSL2::PrideWPalSL2(SegmentSetPS &SegSet, palettePS &Palette, bool Direct
 }
 
 PrideWPalSL2::~PrideWPalSL2() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
 }
 
 //Initializes core variables and also picks random values for briThetaInc16 and briThetaFreq if randomBriInc is true
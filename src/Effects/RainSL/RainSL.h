@@ -27,7 +27,9 @@ Drop colors can either be a static color or picked randomly from a palette.
 This effect is fully compatible with color modes, and the bgColor is a pointer, so you can bind it
 to an external color variable
 
-Note that the effect requires an array of particles and a booleans of size `maxNumDrops * numSegs`. 
+Note that the effect requires an array of particles of size `maxNumDrops * numSegs`. 
+It also uses an occupancy grid of one byte per pixel to track which pixels are covered by drops (see particleOccupancyPS.h).
+(The grid replaces the old `trailEndColors` array, which has been removed)
 These are allocated dynamically, so, to avoid memory fragmentation, when you create the effect, 
 you should set `maxNumDrops` to the maximum value you expect to use. 
 See https://github.com/AlbertGBarber/PixelSpork/wiki/Effects-Advanced#managing-dynamic-memory-and-fragmentation
@@ -194,8 +196,17 @@ Other Settings:
                              See explanation of this in more detail above in effect intro
     fillBg (default false) -- Sets the background to be redrawn every update, useful for bgColorModes that are dynamic
                               Warning!: Not compatible with infinite trails (mode 4). They will be drawn over.
+    cacheBg (default true, false on AVR chips) -- If true, the background colors are cached when the background is re-drawn each update,
+                                                 so they can be copied straight back to the pixels, rather than being re-calculated.
+                                                 The cache is re-built automatically whenever the background changes (see bgCachePS.h).
+                                                 It uses 5 bytes of memory per pixel, so it's turned off by default on AVR chips.
     spawnBasis (default 1000) -- The spawn probability threshold. 
                                  A drop will spawn if "random(spawnBasis) <= spawnChance".
+    skipIdle (default true) -- If true, updates are skipped while no drops are due to move and no lines are able to spawn a drop
+                               (nothing would change in them). Skipping is only done when the colorMode and bgColorMode are 0.
+                               If you are changing the palette, drop colors, or bgColor over time (ie with a palette blend),
+                               the drops will only pick up the changes when they next move, so you may want to turn this off.
+                               Likewise, where drops overlap, a drop that's been drawn over will only be re-drawn when a drop next moves.
 
 Functions:
     setupDrops(newMaxNumDrops) -- Changes the maximum number of drops. 
@@ -260,7 +271,9 @@ class RainSL : public EffectBasePS {
             direct,
             bgPrefill,
             fillBg = false,
+            cacheBg = BG_USE_CACHE_PS,
             blend = false,
+            skipIdle = true,
             *partActive = nullptr;
 
         //trail type flags
@@ -272,7 +285,6 @@ class RainSL : public EffectBasePS {
             infTrail = false;
 
         CRGB
-            *trailEndColors = nullptr,  //used to store the last colors of each trail, so the background color can be set
             bgColorOrig,
             *bgColor = nullptr;  //bgColor is a pointer so it can be tied to an external variable if needed (such as a palette color)
 
@@ -302,7 +314,8 @@ class RainSL : public EffectBasePS {
             partTrailSize,
             posOffset,
             sizeAdj,
-            dimRatio;
+            dimRatio,
+            *lineDropCounts = nullptr;  //the number of active drops on each line
 
         uint16_t
             numLines = 0,  //for first init function call
@@ -312,35 +325,51 @@ class RainSL : public EffectBasePS {
             totPartSize,
             partPos,
             headPos,
-            partSpeed,
             lineNum,
             partSize,
             maxPosition,
             trailLedLocation,
+            dropLine,              //the line of the current drop
+            maxLines = 0,          //the maximum number of lines we have spawn tracking memory for
+            *dropLines = nullptr,  //the line of each drop
+            *dropHeads = nullptr,  //the head position of each drop, as last recorded in the occupancy grid
             getParticlePixelLoc(uint16_t trailLedLocation, uint16_t lineNum),
             getTrailLedLoc(bool trailDirect, uint8_t trailPixelNum, uint16_t maxPosition);
 
         bool
-            bgFilled = false,    //flag for if the background has been filled in already
-            spawnOkTest = true,  //flag for if a particle is able to spawn
-            movePart,            //flag for if a particle should move this cycle
-            isActive(uint8_t particleIndex); //returns true if the particle is active
+            bgFilled = false,        //flag for if the background has been filled in already
+            spawnOpen = true,        //flag for if any line was still able to spawn a drop after the last update
+            lineSpawnClear(uint16_t lineNum);
 
         particlePS
             *particlePtr = nullptr;
 
+        particleArraysPS
+            partArrays = {nullptr};  //Must init structs w/ pointers set to null for safety
+
+        particlePoolPS
+            dropPool = {nullptr};  //tracks which drops are active (Must init structs w/ pointers set to null for safety)
+
+        particleSchedulePS
+            dropSchedule = {nullptr};  //tracks when each active drop is next due to move (Must init structs w/ pointers set to null for safety)
+
+        particleOccupancyPS
+            dropOccupancy = {nullptr};  //tracks which pixels are covered by drops (Must init structs w/ pointers set to null for safety)
+
         CRGB
             colorEnd,
             colorOut,
             colorTemp;
 
+        bgCachePS
+            bgCache = {};  //Must init structs w/ pointers set to null for safety
+
         void
             init(uint8_t MaxNumDrops, CRGB BgColor, SegmentSetPS &SegSet),
             setDropSpawnPos(particlePS *particlePtr),
-            setActive(uint8_t particleIndex, bool isActive),
-            moveParticle(particlePS *particlePtr),
+            setDropSizeVars(),
             drawParticlePixel(uint16_t trailLedLocation, uint8_t trailPixelNum, uint8_t trailSize, uint16_t lineNum, bool bodyPixel),
-            spawnParticle(uint8_t particleIndex, uint16_t lineNum);
+            spawnParticle(uint16_t particleIndex, uint16_t lineNum);
 };
 
 #endif
\ No newline at end of file
@@ -57,8 +57,14 @@ RainSeg::RainSeg(SegmentSetPS &SegSet, CRGB Color, CRGB BgColor, bool BgPrefill,
 RainSeg::~RainSeg() {
     //Free all particles and the particle array pointer
     particleUtilsPS::freeParticleSet(particleSetTemp);
-    free(trailEndColors);
-    free(paletteTemp.paletteArr);
+    particleUtilsPS::freeParticleArrays(partArrays);
+    particleUtilsPS::freeParticlePool(dropPool);
+    particleUtilsPS::freeParticleSchedule(dropSchedule);
+    memUtilsPS::freePS(dropSegs);
+    memUtilsPS::freePS(segDropCounts);
+    memUtilsPS::freePS(dropHeads);
+    memUtilsPS::freePS(dropOccupancy.countArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
 }
 
 //general setup function for class vars
@@ -76,15 +82,11 @@ void RainSeg::init(uint8_t MaxNumDrops, CRGB BgColor, SegmentSetPS &SegSet) {
 //Resets the effect by setting all particles to inactive
 //Configures the background to be cleared on the next update if bgPrefill is true
 void RainSeg::reset(void) {
-    //set all the particles to inactive
-    //and set their spawn positions
-    for( uint16_t i = 0; i < numSegs; i++ ) {
-        for( uint8_t j = 0; j < maxNumDrops; j++ ) {
-            particleIndex = i * maxNumDrops + j;
-            //set the particle to inactive
-            setActive(particleIndex, false);
-        }
-    }
+    //set all the particles to inactive by freeing them in the drop pool
+    particleUtilsPS::resetParticlePool(dropPool);
+    particleUtilsPS::resetParticleSchedule(dropSchedule);
+    //with no active particles, all the segment pixels are clear
+    particleUtilsPS::clearParticleOccupancy(dropOccupancy);
 
     //Flag the background to be filled to clear any leftover active particles
     //This will only trigger the background to fill if bgPrefill is true.
@@ -114,8 +116,11 @@ void RainSeg::setupDrops(uint8_t newMaxNumDrops) {
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || !particleSet || (numParticles > particleSet->maxLength) ) {
 
-        free(trailEndColors);
-        trailEndColors = (CRGB *)malloc(numParticles * sizeof(CRGB));
+        memUtilsPS::freePS(dropHeads);
+        dropHeads = (uint16_t *)memUtilsPS::allocPS(numParticles * sizeof(uint16_t));
+
+        memUtilsPS::freePS(dropSegs);
+        dropSegs = (uint16_t *)memUtilsPS::allocPS(numParticles * sizeof(uint16_t));
 
         //Free all particles and the particle array pointer
         particleUtilsPS::freeParticleSet(particleSetTemp);
@@ -129,6 +134,29 @@ void RainSeg::setupDrops(uint8_t newMaxNumDrops) {
     //This "hides" any unused particles from the rest of the effect
     particleSet->length = numParticles;
 
+    //Create the arrays for the particle motion, the drop pool, and the move schedule (these also manage their own memory size)
+    particleUtilsPS::resizeParticleArrays(partArrays, numParticles);
+    particleUtilsPS::resizeParticlePool(dropPool, numParticles);
+    particleUtilsPS::resizeParticleSchedule(dropSchedule, numParticles);
+
+    //Create the occupancy grid for tracking the particles on each segment (see particleOccupancyPS.h)
+    //The grid needs to fit the longest segment
+    uint16_t maxSegLength = 0;
+    for( uint16_t i = 0; i < numSegs; i++ ) {
+        sectionEnd = segSet->getTotalSegLength(i);
+        if( sectionEnd > maxSegLength ) {
+            maxSegLength = sectionEnd;
+        }
+    }
+    particleUtilsPS::resizeParticleOccupancy(dropOccupancy, maxSegLength, numSegs);
+
+    //Create the arrays for tracking spawning on each segment
+    if( alwaysResizeObj_PS || (numSegs > maxSegs) ) {
+        maxSegs = numSegs;
+        memUtilsPS::freePS(segDropCounts);
+        segDropCounts = (uint8_t *)memUtilsPS::allocPS(numSegs * sizeof(uint8_t));
+    }
+
     reset();
 }
 
@@ -140,14 +168,14 @@ How it works:
     We have a single set of particles ( created using setupDrops() )
     Each particle is either active or inactive
     An active particle is drawn moving on the segSet, while an inactive on is waiting to become activated
-    The active/inactive status of particles is stored in the "life" property of each particle
-    (1 is active, 0 is inactive)
-    There is a single particle set for all the particles across all the segments
-    The areas in the array for each segment's particles go up sequentially
-        so for two segments, each with three possible active particles
-        particleSet[0],[1],[2] would be the particles in the first segment
-        and [3],[4],[5] would be those in the second segment
-        in general particleIndex = segmentNumber * maxNumDrops + particleNumber
+    The active/inactive status of particles is tracked using a particle pool (see particlePoolPS.h)
+    So we only need to loop over the active particles, and can grab a free particle to spawn quickly
+    The motion of the particles is stored separately in a particleArraysPS, and all the particles are moved at once
+    The active particles are also kept in a particle schedule, so we only need to move the particles that are due
+    There is a single particle set for all the particles across all the segments, with maxNumDrops * <num segments> particles
+    The particles aren't tied to a segment, any free particle in the pool can be spawned on any segment
+    The segment a drop is on is recorded in dropSegs when it spawns (ie dropSegs[particleIndex] is the drop's segment)
+    The number of active drops on each segment is counted during each update, so no segment goes over maxNumDrops
 2: Particle motion
     It's critical that particles fully go off the strip before being set to inactive, including tails
     To allow them to move off the strip, we create a "phantom" zone off of the end of the strip
@@ -162,21 +190,25 @@ How it works:
     When a particle is re-spawned, its position is set to 0, and it is given a new set of random traits
     (size, speed, color, etc) depending on the effect options
     As part of spawning, the particle is also drawn (at 0)
-    When a particle spawns, it blocks other particles from spawning until it has fully cleared the first pixel
-    (including trails) "spawnOk" is set to false
+    We keep an occupancy grid with a count of the particles covering each segment pixel (see particleOccupancyPS.h)
+    As a particle moves, it adds to the count of the pixel its head moves onto, and removes from the pixel its tail moves off of
+    This lets us check if a pixel is clear before setting it to the background
+    It also lets us space out the particles when spawning:
+    A particle can only spawn on a segment if the first two pixels of the segment are clear,
+    so there is always at least one clear pixel between a new particle and the end of the particle ahead of it
 4: Overall Steps:
-    On each update cycle, for each segment we check all its particle to see if they are active and should move, 
-    if so, we move them
-    Then, if the particle moved, we set the background color on the led that the particle has moved off of (the last pixel in the trail)
-    We also check its position to see if should block any other particles from spawning, if so we set the spawnOkTest flag
+    On each update cycle, we move all the active particles that are due to move in one go
+    Then, for each active particle, if the particle has moved, we update its pixels in the occupancy grid
+    If the pixel that the particle has moved off of (the last pixel in the trail) is no longer covered by any particles,
+    we set it to the background color
     Next, even if the particle has not moved, we re-draw the trails and the particle body
     (unless the particle has moved fully off the segment, we set it to inactive and skip drawing it)
     This prevents another, faster particle from wiping out a slower on, only to have the slower one 
     suddenly re-appear once it's time to move it again
-    Once all the active particles have been drawn, we go over the inactive ones and try to spawn them
-    (is spawnOkTest has not been flagged)
-    When a particle is spawned it is drawn in the 0 position of the segment and spawnOkTest is flagged
-    to prevent any more spawning */
+    Once all the active particles have been drawn, we go over each segment and try to spawn new particles from the free ones
+    (if the start of the segment is clear, and it has less than maxNumDrops active)
+    When a particle is spawned it is drawn in the 0 position of the segment and added to the occupancy grid,
+    which prevents any more spawning */
 void RainSeg::update() {
     currentTime = millis();
 
@@ -192,8 +224,8 @@ void RainSeg::update() {
         /* for each segment and then each particle, in order:
         if active:
             move it to its next position (if needed)
-            set the spawnOkTest flag if the particle is blocking the 0th pixel in the segment
-            then sets the pixel at the previous location to the bgColor (including trail ends)
+            update its pixels in the occupancy grid if it has moved
+            then sets the pixel at the previous location to the bgColor (including trail ends) if no other particles are on it
             Checks if the particle should still be active after moving (if not, we skip the rest of the steps)
             then draws new trails if needed
             then draws the particle in its new position
@@ -201,167 +233,143 @@ void RainSeg::update() {
             As a particle passes over another, we want to maintain the look of both particles as much as possible
             This is why we always re-draw all the particles with each update, so that a fast particle doesn't erase a slower one
             Also we pay special attention when setting the background pixel:
-            If a previous particle from the set has already overwritten the background pixel, then we don't need to set it
-            To track this, we record the color that we expect the background pixel to be (it's the last color in the trail/body)
-            Then when we go to set the background, we check the current color of the pixel
-            If it doesn't match, then we don't overwrite.
+            If another particle from the set is also covering the background pixel, then we don't want to set it
+            To track this, we use the occupancy grid, which counts the particles covering each pixel
+            If the pixel's count isn't 0 after the particle moves off it, then we don't overwrite.
         if not active:
-            Try to spawn the particle if spawnOKTest is true
+            Try to spawn the particle if the start of the segment is clear
             If it's spawned, set it to active and its position to zero
             and randomize it properties (speed, size, etc)
             the draw the particle head in the 0th position */
-        for( uint16_t i = 0; i < numSegs; i++ ) {
-            sectionEnd = segSet->getTotalSegLength(i);
-            //sectionStart = 0;
-            //reset the spawnOkTest for each segment
-            spawnOkTest = true;
-            for( uint8_t j = 0; j < maxNumDrops; j++ ) {
-                //get the particle's location in the particleSet
-                particleIndex = i * maxNumDrops + j;
-
-                //if the particle is active, we need to increment it and draw trails
-                if( isActive(particleIndex) ) {
-                    //get the particle from the set, and record some vars locally for ease of access
-                    particlePtr = particleSet->particleArr[particleIndex];
-                    partPos = particlePtr->position;         //the current position of the particle
-                    partSpeed = particlePtr->speed;          //the speed of the particle
-                    partSize = particlePtr->size;            //the length of the main body of the particle
-                    partTrailType = particlePtr->trailType;  //the type of trail for the particle (see above for types)
-                    partTrailSize = particlePtr->trailSize;  //the length of the trail(s) of the particle (only applies if the pixel has a trail)
-
-                    colorOut = paletteUtilsPS::getPaletteColor(*palette, particlePtr->colorIndex);
-                    //calculate the maximum position the particle can have before all of it is off the segment
-                    totPartSize = partTrailSize + partSize;
-
-                    //for particles with leading or twin trails, we need to do some extra adjustments to the
-                    //maximum particle postion, and introduce an offset b/c the postion of the particle is off the segment
-                    //initially
-                    posOffset = 0;
-                    if( partTrailType == 2 || partTrailType == 3 ) {
-                        posOffset = partTrailSize;
-                        if( partTrailType == 2 ) {
-                            totPartSize += partTrailSize;
-                        }
-                    }
+        //Move all the active particles that are due to move in one go
+        //(particle motion is stored separately from the drawing properties, see particleArraysPS.h)
+        //The particles are kept in a schedule ordered by when they next need to move,
+        //so only the particles that are due are touched (see particleSchedulePS.h)
+        particleUtilsPS::advanceParticleArrays(partArrays, dropSchedule, currentTime);
 
-                    maxPosition = sectionEnd + totPartSize;
+        //reset the drop counts for each segment
+        for( uint16_t i = 0; i < numSegs; i++ ) {
+            segDropCounts[i] = 0;
+        }
 
-                    //if enough time has passed, we need to move the particle
-                    movePart = ((currentTime - particlePtr->lastUpdateTime) >= partSpeed);
-                    //if the particle needs to move, move it and record the time
-                    if( movePart ) {
-                        particlePtr->lastUpdateTime = currentTime;
-                        moveParticle(particlePtr);
-                    }
+        //For each active particle, draw it on its segment
+        //We go backwards through the active particles so that we can de-spawn particles as we go (see particlePoolPS.h)
+        for( uint16_t j = dropPool.numActive; j > 0; j-- ) {
+            particleIndex = dropPool.activeList[j - 1];
+            dropSeg = dropSegs[particleIndex];
+            sectionEnd = segSet->getTotalSegLength(dropSeg);
+
+            //get the particle from the set, and record some vars locally for ease of access
+            particlePtr = particleSet->particleArr[particleIndex];
+            partPos = partArrays.position[particleIndex];  //the current position of the particle
+            partSize = particlePtr->size;                    //the length of the main body of the particle
+            partTrailType = particlePtr->trailType;          //the type of trail for the particle (see above for types)
+            partTrailSize = particlePtr->trailSize;          //the length of the trail(s) of the particle (only applies if the pixel has a trail)
+
+            colorOut = paletteUtilsPS::getPaletteColor(*palette, particlePtr->colorIndex);
+
+            //get the particle's size, offset, and maximum position (see setDropSizeVars())
+            setDropSizeVars();
+
+            //headPos is the leading position of the particle, taking into account the leading trails for trailTypes 2 and 3
+            headPos = addMod16PS(partPos, posOffset, maxPosition);
+
+            //If the particle has moved, we need to update where it is in the occupancy grid (see particleOccupancyPS.h)
+            //Since particles only move one step at a time, the particle will have moved onto a new head position,
+            //and off of its last rear position (the end of its body, or its rear trail)
+            //If no other particles are covering the rear position, it is clear, so we set it to the background
+            //This prevents background holes from being placed in other particles
+            //Note that the grid only covers the positions on the segment, so we skip any in the "phantom zone"
+            if( headPos != dropHeads[particleIndex] ) {
+                dropHeads[particleIndex] = headPos;
+                if( headPos < sectionEnd ) {
+                    particleUtilsPS::addParticleOccupancy(dropOccupancy, headPos, dropSeg);
+                }
 
-                    //if any part of the particle is in the 0th segment pixel
-                    //we need to block any new particles from spawning
-                    //headPos takes into account the leading trails for trailTypes 2 and 3
-                    headPos = addMod16PS(partPos, posOffset, maxPosition);
-                    if( headPos <= totPartSize ) {
-                        spawnOkTest = false;
-                    }
+                //get the rear position
+                //if we have a rear trail, it is the pixel just past the end of the trail
+                //otherwise it's the pixel just behind the particle body
+                //(in the case of two trails, we only need the rear trail, since the front one moves with the particle)
+                if( partTrailType == 1 || partTrailType == 2 ) {
+                    trailLedLocation = getTrailLedLoc(true, partTrailSize + 1, maxPosition);
+                } else {
+                    trailLedLocation = getTrailLedLoc(true, 1, maxPosition);
+                }
 
+                if( trailLedLocation < sectionEnd && particleUtilsPS::removeParticleOccupancy(dropOccupancy, trailLedLocation, dropSeg) ) {
                     //if we have 4 trails or more, we are in infinite trails mode, so we don't touch the previous leds
-                    //otherwise we need to set the last pixel in the trail to the background
                     if( partTrailType < 4 && (!fillBg && !blend) ) {
-                        //get the physical pixel location and the color it's meant to be
-                        //if we don't have trails, we just need to turn off the first trail pixel
-                        //otherwise we need to switch the pixel at the end of the trail
-                        if( partTrailType == 0 || partTrailType == 3 ) {
-                            trailLedLocation = getTrailLedLoc(true, 1, maxPosition);
-                        } else if( partTrailType == 1 || partTrailType == 2 ) {
-                            //in the case of two trails, we only need to set the rear trail, since the
-                            //front one will be overwritten as the particle moves
-                            trailLedLocation = getTrailLedLoc(true, partTrailSize + 1, maxPosition);
-                        }
-
-                        //only try to draw a pixel if it's within the segment
-                        if( trailLedLocation < sectionEnd ) {
-                            //get the pixel location in the current segment
-                            pixelPosTemp = segDrawUtils::getSegmentPixel(*segSet, i, trailLedLocation);
-
-                            //only turn off the pixel if it hasn't been touched by another particle's trail (or something else)
-                            //this prevents background holes from being placed in other particles
-                            if( segSet->leds[pixelPosTemp] == trailEndColors[particleIndex] ) {
-                                lineNum = segDrawUtils::getLineNumFromPixelNum(*segSet, trailLedLocation, i);
-                                segSet->leds[pixelPosTemp] = segDrawUtils::getPixelColor(*segSet, pixelPosTemp, *bgColor, bgColorMode, i, lineNum);
-                            }
-                        }
+                        pixelPosTemp = segDrawUtils::getSegmentPixel(*segSet, dropSeg, trailLedLocation);
+                        lineNum = segDrawUtils::getLineNumFromPixelNum(*segSet, trailLedLocation, dropSeg);
+                        segSet->leds[pixelPosTemp] = segDrawUtils::getPixelColor(*segSet, pixelPosTemp, *bgColor, bgColorMode, dropSeg, lineNum);
                     }
+                }
+            }
 
-                    //if a particle has reached the end of the segment + (total particle size), it is now inactive
-                    //the reason why we include the particle size is to allow the whole particle to move off the segment
-                    //anything that falls outside the segment won't be drawn,
-                    //so we can skip drawing the particle, and break out of the loop
-                    if( headPos == maxPosition - 1 ) {
-                        setActive(particleIndex, false);
-                        continue;
-                    }
+            //if a particle has reached the end of the segment + (total particle size), it is now inactive
+            //the reason why we include the particle size is to allow the whole particle to move off the segment
+            //anything that falls outside the segment won't be drawn,
+            //so we can skip drawing the particle, and break out of the loop
+            if( headPos == maxPosition - 1 ) {
+                particleUtilsPS::despawnPoolParticle(dropPool, particleIndex);
+                particleUtilsPS::unscheduleParticle(dropSchedule, particleIndex);
+                continue;
+            }
 
-                    //if we have trails, draw them
-                    //if it has two, we draw the trail in front of the particle first, followed by the one behind it
-                    if( partTrailType != 0 && partTrailType < 4 ) {
-                        //draw a trail, extending positively or negatively, dimming with each step
-                        for( uint8_t k = partTrailSize; k > 0; k-- ) {
-
-                            //if we have two trails, we need to draw the negative trail
-                            if( partTrailType == 2 || partTrailType == 3 ) {
-                                trailLedLocation = getTrailLedLoc(false, k, maxPosition);
-                                if( trailLedLocation < sectionEnd ) {
-                                    drawParticlePixel(trailLedLocation, k, partTrailSize, i, false);
-                                }
-                            }
-
-                            //draw the positive trail
-                            if( partTrailType == 1 || partTrailType == 2 ) {
-                                trailLedLocation = getTrailLedLoc(true, k, maxPosition);
-                                //only try to draw a pixel if it's within the segment
-                                if( trailLedLocation < sectionEnd ) {
-                                    drawParticlePixel(trailLedLocation, k, partTrailSize, i, false);
-                                    //drawParticlePixel gets pixelPosTemp for the current pixel
-                                    //If we have trails, we need to record the trail end color at the end of the trail
-                                    if( k == partTrailSize ) {
-                                        trailEndColors[particleIndex] = segSet->leds[pixelPosTemp];  //pixelInfo.color;
-                                    }
-                                }
-                            }
-                        }
-                    }
+            //the particle is still active, so it counts towards the segment's drops
+            segDropCounts[dropSeg]++;
 
-                    //draw the main particle
-                    //we always start at the particle's head and move opposite the direction of motion
-                    for( uint16_t k = 0; k < partSize; k++ ) {
+            //if we have trails, draw them
+            //if it has two, we draw the trail in front of the particle first, followed by the one behind it
+            if( partTrailType != 0 && partTrailType < 4 ) {
+                //draw a trail, extending positively or negatively, dimming with each step
+                for( uint8_t k = partTrailSize; k > 0; k-- ) {
 
-                        trailLedLocation = addMod16PS(partPos, maxPosition - k, maxPosition);  //( (position - k * directStep) + numLEDs) % numLEDs;
+                    //if we have two trails, we need to draw the negative trail
+                    if( partTrailType == 2 || partTrailType == 3 ) {
+                        trailLedLocation = getTrailLedLoc(false, k, maxPosition);
+                        if( trailLedLocation < sectionEnd ) {
+                            drawParticlePixel(trailLedLocation, k, partTrailSize, dropSeg, false);
+                        }
+                    }
 
+                    //draw the positive trail
+                    if( partTrailType == 1 || partTrailType == 2 ) {
+                        trailLedLocation = getTrailLedLoc(true, k, maxPosition);
                         //only try to draw a pixel if it's within the segment
                         if( trailLedLocation < sectionEnd ) {
-                            //get the pixel location and color and set it
-                            drawParticlePixel(trailLedLocation, k, partTrailSize, i, true);
-                            //drawParticlePixel gets pixelPosTemp for the current pixel
-                            //if we don't have a rear trail, then the next pixel that needs to be set to background
-                            //is the last pixel in the particle body, so we record it's color
-                            if( k == (partSize - 1) && (partTrailType == 0 || partTrailType == 3) ) {
-                                trailEndColors[particleIndex] = segSet->leds[pixelPosTemp];  //pixelInfo.color;
-                            }
+                            drawParticlePixel(trailLedLocation, k, partTrailSize, dropSeg, false);
                         }
                     }
                 }
             }
 
-            //with the active particles drawn, we now try to spawn any inactive ones
-            //(if we can)
-            for( uint8_t j = 0; j < maxNumDrops; j++ ) {
-                particleIndex = i * maxNumDrops + j;
-                if( spawnOkTest && !isActive(particleIndex) ) {
-                    //try to spawn particle
-                    //if we spawn a particle, stop more from spawning (prevents overlapping),
-                    //then set the particle's properties using spawnParticle();
-                    if( random16(spawnBasis) <= spawnChance ) {
-                        spawnOkTest = false;
-                        spawnParticle(particleIndex, i);
-                    }
+            //draw the main particle
+            //we always start at the particle's head and move opposite the direction of motion
+            for( uint16_t k = 0; k < partSize; k++ ) {
+
+                trailLedLocation = addMod16PS(partPos, maxPosition - k, maxPosition);  //( (position - k * directStep) + numLEDs) % numLEDs;
+
+                //only try to draw a pixel if it's within the segment
+                if( trailLedLocation < sectionEnd ) {
+                    //get the pixel location and color and set it
+                    drawParticlePixel(trailLedLocation, k, partTrailSize, dropSeg, true);
+                }
+            }
+        }
+
+        //with the active particles drawn, we now try to spawn new ones on each segment (if we can)
+        //Each segment can have up to maxNumDrops drops, we try to spawn each missing drop until one spawns
+        for( uint16_t i = 0; i < numSegs; i++ ) {
+            //A drop can only spawn if the start of the segment is clear (prevents overlapping, see segSpawnClear())
+            for( uint8_t j = segDropCounts[i]; j < maxNumDrops && segSpawnClear(i); j++ ) {
+                //try to spawn particle
+                //if we spawn a particle, set the particle's properties using spawnParticle();
+                //(the new particle covers the first pixel, stopping more from spawning)
+                if( random16(spawnBasis) <= spawnChance ) {
+                    particleIndex = particleUtilsPS::spawnPoolParticle(dropPool);
+                    dropSegs[particleIndex] = i;
+                    spawnParticle(particleIndex, i);
                 }
             }
         }
@@ -369,18 +377,6 @@ void RainSeg::update() {
     }
 }
 
-//Moves the particle forward by one step
-void RainSeg::moveParticle(particlePS *particlePtr) {
-    partPos = particlePtr->position;
-
-    //get the next position of the particle
-    //we use mod to keep the particle within the strip bounds
-    partPos = addMod16PS(partPos, maxPosition + 1, maxPosition);  //(position + 1 + maxPosition) % maxPosition;
-
-    //update the particle's position
-    particlePtr->position = partPos;
-}
-
 //writes out the pixel color according to the pixel number in the trail / body (ie 0 - trailSize)
 //a trail pixel is indicated by setting bodyPixel to false
 //the trail is blended towards background color according to the trailSize and the trailPixelNum
@@ -430,10 +426,7 @@ uint16_t RainSeg::getTrailLedLoc(bool trailDirect, uint8_t trailPixelNum, uint16
 //spawns a particle by taking an inactive particle and resetting its position to 0
 //and randomizing its properties
 //also draws the first step of the particle
-void RainSeg::spawnParticle(uint8_t particleIndex, uint16_t segNum) {
-    //set the particle to active
-    setActive(particleIndex, true);
-
+void RainSeg::spawnParticle(uint16_t particleIndex, uint16_t segNum) {
     //randomize the particle properties
     particleUtilsPS::randomizeParticle(*particleSet, particleIndex, 0, true, speed, speedRange, size, sizeRange,
                                        trailType, trailSize, trailRange, false, palette->length, true);
@@ -451,11 +444,20 @@ void RainSeg::spawnParticle(uint8_t particleIndex, uint16_t segNum) {
     partTrailType = particlePtr->trailType;
 
     //for particles with no trails we need to set their trail size to 1 (min)
-    //so that block spawning correctly
+    //so that they have a step in the "phantom zone" (see setDropSizeVars())
     if( partTrailType == 0 || partTrailType == 4 ) {
         particlePtr->trailSize = 1;
     }
 
+    //set the particle's motion values in the particle arrays
+    //(the particle's maxPosition depends on its trail size, so we need to do this after adjusting it)
+    partSize = particlePtr->size;
+    partTrailSize = particlePtr->trailSize;
+    setDropSizeVars();
+    particleUtilsPS::loadParticleToArrays(partArrays, particleIndex, particlePtr, maxPosition);
+    //schedule the particle's first move
+    particleUtilsPS::scheduleParticle(dropSchedule, particleIndex, particlePtr->lastUpdateTime + particlePtr->speed);
+
     //draw the first step of the particle
     //for particles with leading trails, the first step is the end of the trail
     if( partTrailType == 2 || partTrailType == 3 ) {
@@ -463,9 +465,19 @@ void RainSeg::spawnParticle(uint8_t particleIndex, uint16_t segNum) {
     } else {
         drawParticlePixel(0, 0, particlePtr->trailSize, segNum, true);
     }
-    //we need to store the trailEndColor for size 1 particles
-    //otherwise, when they next update, trailEndColors will be empty
-    trailEndColors[particleIndex] = segSet->leds[pixelPosTemp];
+    //record the particle in the occupancy grid
+    //(all particles spawn with their head at the first pixel, with the rest of the particle in the "phantom zone")
+    particleUtilsPS::addParticleOccupancy(dropOccupancy, 0, segNum);
+    dropHeads[particleIndex] = 0;
+}
+
+//Returns true if a new drop can spawn on the passed in segment
+//To keep the drops spaced out, the first two pixels of the segment must be clear, 
+//so there's a gap of at least one pixel between the new drop and the end of the drop ahead of it
+//We check the occupancy grid for this, so the check doesn't depend on the number of drops (see particleOccupancyPS.h)
+//(the grid's rows are the length of the longest segment, so for shorter segments the extra positions are always clear)
+bool RainSeg::segSpawnClear(uint16_t segNum) {
+    return !dropOccupancy.isOccupied(0, segNum) && (dropOccupancy.numCols < 2 || !dropOccupancy.isOccupied(1, segNum));
 }
 
 //sets the inital spawn position of a particle
@@ -486,13 +498,21 @@ void RainSeg::setDropSpawnPos(particlePS *particlePtr, uint16_t segNum) {
     }
 }
 
-//Returns true if the particle is active, false if not
-//Note, we use the "life" particle property to track if the particle is active (1 is active, 0 is not)
-bool RainSeg::isActive(uint8_t particleIndex) {
-    return particleSet->particleArr[particleIndex]->life == 1;
-}
+/* Sets the total size, position offset, and the maximum position of the current particle
+(based on the partSize, partTrailType, and partTrailSize vars)
+The maximum position is the position where all of the particle is off the segment
+For particles with leading or twin trails, we need to do some extra adjustments to the
+maximum particle position, and introduce an offset b/c the position of the particle is off the segment initially */
+void RainSeg::setDropSizeVars() {
+    totPartSize = partTrailSize + partSize;
 
-//Sets the active status of a particle
-void RainSeg::setActive(uint8_t particleIndex, bool isActive) {
-    particleSet->particleArr[particleIndex]->life = uint8_t(isActive);
-}
\ No newline at end of file
+    posOffset = 0;
+    if( partTrailType == 2 || partTrailType == 3 ) {
+        posOffset = partTrailSize;
+        if( partTrailType == 2 ) {
+            totPartSize += partTrailSize;
+        }
+    }
+
+    maxPosition = sectionEnd + totPartSize;
+}
@@ -23,7 +23,9 @@ This effect is fully compatible with color modes, and the bgColor is a pointer,
 to an external color variable
 
 Note that the effect requires an array of particles of size `maxNumDrops * numSegs`. 
-It is allocated dynamically, so, to avoid memory fragmentation, when you create the effect, 
+It also uses an occupancy grid of one byte per pixel (sized for the longest segment) to track which pixels are covered by drops
+(see particleOccupancyPS.h). (The grid replaces the old `trailEndColors` array, which has been removed)
+These are allocated dynamically, so, to avoid memory fragmentation, when you create the effect, 
 you should set `maxNumDrops` to the maximum value you expect to use. 
 See https://github.com/AlbertGBarber/PixelSpork/wiki/Effects-Advanced#managing-dynamic-memory-and-fragmentation
 for more details. 
@@ -263,7 +265,6 @@ class RainSeg : public EffectBasePS {
             infTrail = false;
 
         CRGB
-            *trailEndColors = nullptr,  //used to store the last colors of each trail, so the background color can be set
             bgColorOrig,
             *bgColor = nullptr;  //bgColor is a pointer so it can be tied to an external variable if needed (such as a palette color)
 
@@ -293,7 +294,8 @@ class RainSeg : public EffectBasePS {
             partTrailSize,
             posOffset,
             sizeAdj,
-            dimRatio;
+            dimRatio,
+            *segDropCounts = nullptr;  //the number of active drops on each segment
 
         uint16_t
             numSegs = 0,  //for first init function call
@@ -302,24 +304,37 @@ class RainSeg : public EffectBasePS {
             totPartSize,
             partPos,
             headPos,
-            partSpeed,
             lineNum,
             partSize,
             maxPosition,
             trailLedLocation,
             sectionEnd,
             sectionStart = 0,
+            dropSeg,              //the segment of the current drop
+            maxSegs = 0,          //the maximum number of segments we have spawn tracking memory for
+            *dropSegs = nullptr,  //the segment of each drop
+            *dropHeads = nullptr, //the head position of each drop, as last recorded in the occupancy grid
             getTrailLedLoc(bool trailDirect, uint8_t trailPixelNum, uint16_t maxPosition);
 
         bool
-            bgFilled = false,    //flag for if the background has been filled in already
-            spawnOkTest = true,  //flag for if a particle is able to spawn
-            movePart,            //flag for if a particle should move this cycle
-            isActive(uint8_t particleIndex); //returns true if the particle is active
-            
+            bgFilled = false,  //flag for if the background has been filled in already
+            segSpawnClear(uint16_t segNum);
+
         particlePS
             *particlePtr = nullptr;
 
+        particleArraysPS
+            partArrays = {nullptr};  //Must init structs w/ pointers set to null for safety
+
+        particlePoolPS
+            dropPool = {nullptr};  //tracks which drops are active (Must init structs w/ pointers set to null for safety)
+
+        particleSchedulePS
+            dropSchedule = {nullptr};  //tracks when each active drop is next due to move (Must init structs w/ pointers set to null for safety)
+
+        particleOccupancyPS
+            dropOccupancy = {nullptr};  //tracks which pixels are covered by drops (Must init structs w/ pointers set to null for safety)
+
         CRGB
             colorEnd,
             colorOut,
@@ -328,10 +343,9 @@ class RainSeg : public EffectBasePS {
         void
             init(uint8_t MaxNumDrops, CRGB BgColor, SegmentSetPS &SegSet),
             setDropSpawnPos(particlePS *particlePtr, uint16_t segNum),
-            setActive(uint8_t particleIndex, bool isActive),
-            moveParticle(particlePS *particlePtr),
+            setDropSizeVars(),
             drawParticlePixel(uint16_t trailLedLocation, uint8_t trailPixelNum, uint8_t trailSize, uint16_t segNum, bool bodyPixel),
-            spawnParticle(uint8_t particleIndex, uint16_t segNum);
+            spawnParticle(uint16_t particleIndex, uint16_t segNum);
 };
 
 #endif
\ No newline at end of file
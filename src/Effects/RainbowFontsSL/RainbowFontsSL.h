@@ -54,6 +54,8 @@ class RainbowFontsSL : public EffectBasePS {
     public:
         RainbowFontsSL(SegmentSetPS &SegSet, uint8_t WaveFreq, uint16_t Rate);
 
+        ~RainbowFontsSL();
+
         uint8_t
             sat = 255, //The HSV rainbow saturation value.
             val = 255, //The HSV rainbow "value" value
@@ -74,13 +76,10 @@ class RainbowFontsSL : public EffectBasePS {
 
         uint16_t
             hl,
-            pixelNum,
-            lineNum,
-            numSegs,
             numLines;
 
-        CRGB
-            colorOut;
+        lineColorsPS
+            lineColors = {nullptr, 0, 0};  //Must init structs w/ pointers set to null for safety
 };
 
 #endif
\ No newline at end of file
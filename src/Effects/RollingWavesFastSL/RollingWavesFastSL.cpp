@@ -41,8 +41,8 @@ RollingWavesFastSL::RollingWavesFastSL(SegmentSetPS &SegSet, CRGB Color, CRGB Bg
 }
 
 RollingWavesFastSL::~RollingWavesFastSL() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //inits core variables for the effect
@@ -41,8 +41,9 @@ RollingWavesSL::RollingWavesSL(SegmentSetPS &SegSet, CRGB Color, CRGB BgColor, u
 }
 
 RollingWavesSL::~RollingWavesSL() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
+    memUtilsPS::freePS(lineColors.colorArr);
 }
 
 //inits core variables for the effect
@@ -156,6 +157,14 @@ void RollingWavesSL::update() {
         //because it will not automatically be set in the loop unless the first blendStep is 0
         setNextColors(0);
 
+        //If we're not using color modes, then each line is a single color
+        //So we can store the line colors and then write them out in one pass after the loop
+        //Otherwise we need to get the color of each pixel individually
+        useLineColors = (colorMode == 0 && bgColorMode == 0);
+        if( useLineColors ) {
+            segDrawUtils::resizeLineColors(lineColors, numLines);
+        }
+
         for( uint16_t i = 0; i < numLines; i++ ) {
 
             blendStep = addMod16PS(cycleNum, i, blendLimit);  // what step of the wave we're on (incl spacing)
@@ -185,6 +194,19 @@ void RollingWavesSL::update() {
                 setBg = true;
             }
 
+            if( useLineColors ) {
+                if( setBg ) {
+                    colorOut = *bgColor;
+                } else if( blendStep != midPoint ) {
+                    //Dim the color (see notes below)
+                    colorOut = particleUtilsPS::getTrailColor(currentColor, *bgColor, stepTemp, halfGrad, dimPow);
+                } else {
+                    colorOut = currentColor;
+                }
+                lineColors.colorArr[i] = colorOut;
+                continue;
+            }
+
             //reverse the line number so that the effect moves positively along the strip
             lineNum = numLines - i - 1;
 
@@ -211,6 +233,12 @@ void RollingWavesSL::update() {
             }
         }
 
+        //Write out the stored line colors
+        //The lines are reversed so that the effect moves positively along the strip
+        if( useLineColors ) {
+            segDrawUtils::drawLineColors(*segSet, lineColors, 0, true);
+        }
+
         cycleNum = addMod16PS(cycleNum, 1, totalCycleLength);
         showCheckPS();
     }
@@ -188,12 +188,16 @@ class RollingWavesSL : public EffectBasePS {
             numLines;
 
         bool
-            setBg = false;
+            setBg = false,
+            useLineColors;
 
         CRGB
             currentColor,
             colorOut;
 
+        lineColorsPS
+            lineColors = {nullptr, 0, 0};  //Must init structs w/ pointers set to null for safety
+
         void
             init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate),
             setTotalEffectLength(),
@@ -29,9 +29,9 @@ RollingWavesSL2::RollingWavesSL2(SegmentSetPS &SegSet, uint8_t NumColors, CRGB B
 }
 
 RollingWavesSL2::~RollingWavesSL2() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
-    free(nextLine);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
+    memUtilsPS::freePS(nextLine);
 }
 
 //inits core variables for the effect
@@ -75,8 +75,8 @@ void RollingWavesSL2::buildLineArr() {
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || (numSegs > numSegsMax) ) {
         numSegsMax = numSegs;
-        free(nextLine);
-        nextLine = (uint16_t *)malloc(numSegs * sizeof(uint16_t));
+        memUtilsPS::freePS(nextLine);
+        nextLine = (uint16_t *)memUtilsPS::allocPS(numSegs * sizeof(uint16_t));
     }
 
     //fetch some core vars
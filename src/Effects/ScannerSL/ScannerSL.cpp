@@ -43,9 +43,9 @@ ScannerSL::ScannerSL(SegmentSetPS &SegSet, palettePS &Palette, CRGB BgColor, uin
 //However if particleSetTemp has not been set, then trying to clean it up will probably cause an error
 //by default, the particleArr pointer is NULL, so we can check for that to confirm if particleSetTemp has been used or not
 ScannerSL::~ScannerSL() {
-    free(trailEndColors);
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(trailEndColors);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
     //clear the memory of the existing particles (to prevent a memory leak)
     particleUtilsPS::freeParticleSet(particleSet);
 }
@@ -90,8 +90,8 @@ void ScannerSL::makeWaveSet(uint16_t numWaves, bool direction, bool alternate, b
         particleUtilsPS::freeParticleSet(particleSet);
         particleSet = particleUtilsPS::buildParticleSet(numWaves, numLines, direction, *rate, 0, size, 0, trailType, trailSize, 0, bounce, 0, false);
 
-        free(trailEndColors);
-        trailEndColors = (CRGB *)malloc(numWaves * sizeof(CRGB));
+        memUtilsPS::freePS(trailEndColors);
+        trailEndColors = (CRGB *)memUtilsPS::allocPS(numWaves * sizeof(CRGB));
     }
     //Set the length of the particle set to the number of waves
     //The particle set may be longer (due to numWavesMax above)
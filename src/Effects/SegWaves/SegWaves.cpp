@@ -65,9 +65,9 @@ SegWaves::SegWaves(SegmentSetPS &SegSet, uint8_t FadeSteps, bool Direct, uint16_
 
 //destructor
 SegWaves::~SegWaves() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
-    free(segColors);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
+    memUtilsPS::freePS(segColors);
 }
 
 //initialization of core variables and pointers
@@ -107,8 +107,8 @@ void SegWaves::resetSegColors() {
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || (numSegs > numSegsMax) ) {
         numSegsMax = numSegs;
-        free(segColors);
-        segColors = (CRGB *)malloc((numSegs + 1) * sizeof(CRGB));
+        memUtilsPS::freePS(segColors);
+        segColors = (CRGB *)memUtilsPS::allocPS((numSegs + 1) * sizeof(CRGB));
     }
 }
 
@@ -136,8 +136,8 @@ void SegWaves::makeRainbowWaves(){
         palLength = numSegs;
     }
     
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 
     uint8_t *patternArr = new uint8_t[palLength];
     CRGB *paletteArr = new CRGB[palLength];
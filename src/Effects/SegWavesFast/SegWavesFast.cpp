@@ -53,8 +53,8 @@ SegWavesFast::SegWavesFast(SegmentSetPS &SegSet, CRGB Color, CRGB BgColor, uint1
 }
 
 SegWavesFast::~SegWavesFast() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //initialization of core variables and pointers
@@ -59,9 +59,10 @@ ShiftingSeaSL::ShiftingSeaSL(SegmentSetPS &SegSet, uint8_t GradLength, uint8_t S
 }
 
 ShiftingSeaSL::~ShiftingSeaSL() {
-    free(offsets);
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(offsets);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
+    memUtilsPS::freePS(lineColors.colorArr);
 }
 
 //initializes core variables
@@ -159,8 +160,8 @@ void ShiftingSeaSL::resetOffsets() {
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || (numLines > numLinesMax) ) {
         numLinesMax = numLines;
-        free(offsets);
-        offsets = (uint16_t *)malloc(numLines * sizeof(uint16_t));
+        memUtilsPS::freePS(offsets);
+        offsets = (uint16_t *)memUtilsPS::allocPS(numLines * sizeof(uint16_t));
     }
 
     setTotalCycleLen();
@@ -217,6 +218,9 @@ void ShiftingSeaSL::update() {
         //to account for the extra blank color cycle steps
         setTotalCycleLen();
 
+        //Make sure we have space to store a color for each line
+        segDrawUtils::resizeLineColors(lineColors, numLines);
+
         for( uint16_t i = 0; i < numLines; i++ ) {
 
             //where we are in the cycle of all the colors based on the current pixel's offset
@@ -260,8 +264,8 @@ void ShiftingSeaSL::update() {
                 color = colorUtilsPS::getCrossFadeColor(currentColor, nextColor, gradStep, gradLength);
             }
 
-            //Write out the color
-            segDrawUtils::drawSegLine(*segSet, i, color, 0);
+            //Store the line color, it will be written out after the loop
+            lineColors.colorArr[i] = color;
 
             //randomly increment the offset (keeps the effect varied)
             if( randomShift ) {
@@ -281,6 +285,9 @@ void ShiftingSeaSL::update() {
             }
         }
 
+        //Write out the line colors to all the leds in each segment line in one pass
+        segDrawUtils::drawLineColors(*segSet, lineColors, 0, false);
+
         //increment the cycle, clamping it's max value to prevent any overflow
         cycleNum = addMod16PS(cycleNum, 1, totalCycleLength);
 
@@ -302,6 +302,9 @@ class ShiftingSeaSL : public EffectBasePS {
             currentColor,
             nextColor;
 
+        lineColorsPS
+            lineColors = {nullptr, 0, 0};  //Must init structs w/ pointers set to null for safety
+
         void
             init(SegmentSetPS &SegSet, uint16_t Rate),
             setTotalCycleLen();
@@ -28,7 +28,7 @@ ShimmerSL::ShimmerSL(SegmentSetPS &SegSet, palettePS &Palette, uint8_t ShimmerMi
 }
 
 ShimmerSL::~ShimmerSL() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
 }
 
 void ShimmerSL::init(SegmentSetPS &SegSet, uint16_t Rate) {
@@ -39,7 +39,7 @@ void ShimmerSL::init(SegmentSetPS &SegSet, uint16_t Rate) {
 
 //creates an palette of length 1 containing the passed in color
 void ShimmerSL::setSingleColor(CRGB color) {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
     paletteTemp = paletteUtilsPS::makeSingleColorPalette(color);
     palette = &paletteTemp;
 }
@@ -49,10 +49,10 @@ CRGB ShimmerSL::pickColor() {
     switch( randMode ) {
         case 0:  // we're picking from a set of colors
         default:
-            color = paletteUtilsPS::getPaletteColor(*palette, random8(paletteLength));
+            color = paletteUtilsPS::getPaletteColor(*palette, randUtilsPS::rand8(randStream, paletteLength));
             break;
         case 1:
-            color = colorUtilsPS::randColor();
+            color = colorUtilsPS::randColor(randStream);
             break;
     }
     return color;
@@ -72,7 +72,7 @@ void ShimmerSL::update() {
         paletteLength = palette->length;
 
         for( uint16_t i = 0; i < numLines; i++ ) {
-            shimmerVal = 255 - random8(shimmerMin, shimmerMax);
+            shimmerVal = 255 - randUtilsPS::rand8(randStream, shimmerMin, shimmerMax);
             color = pickColor();
 
             for( uint16_t j = 0; j < numSegs; j++ ) {
@@ -80,7 +80,7 @@ void ShimmerSL::update() {
 
                 //If we're not in line mode, then each individual pixel is to have it's own shimmer brightness
                 if( !lineMode ) {
-                    shimmerVal = 255 - random8(shimmerMin, shimmerMax);
+                    shimmerVal = 255 - randUtilsPS::rand8(randStream, shimmerMin, shimmerMax);
                 }
 
                 colorOut = segDrawUtils::getPixelColor(*segSet, pixelNum, color, colorMode, j, i);
@@ -37,8 +37,8 @@ StreamerFastSL::StreamerFastSL(SegmentSetPS &SegSet, CRGB Color, CRGB BgColor, u
 }
 
 StreamerFastSL::~StreamerFastSL() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //takes the passed in pattern and creates a pattern for the streamer
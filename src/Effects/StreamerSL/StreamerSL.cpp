@@ -39,9 +39,9 @@ StreamerSL::StreamerSL(SegmentSetPS &SegSet, CRGB Color, CRGB BgColor, uint16_t
 
 //destructor
 StreamerSL::~StreamerSL() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
-    free(prevLineColors);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
+    memUtilsPS::freePS(prevLineColors);
 }
 
 //initialization of core variables and pointers
@@ -93,8 +93,8 @@ void StreamerSL::reset() {
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || (numSegs > numSegsMax) ) {
         numSegsMax = numSegs;
-        free(prevLineColors);
-        prevLineColors = (CRGB *)malloc(numSegs * sizeof(CRGB));
+        memUtilsPS::freePS(prevLineColors);
+        prevLineColors = (CRGB *)memUtilsPS::allocPS(numSegs * sizeof(CRGB));
     }
 }
 
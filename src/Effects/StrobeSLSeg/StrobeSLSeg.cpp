@@ -58,8 +58,8 @@ void StrobeSLSeg::init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate) {
 }
 
 StrobeSLSeg::~StrobeSLSeg() {
-    free(paletteTemp.paletteArr);
-    free(patternTemp.patternArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
 }
 
 //sets the pattern to match the current palette
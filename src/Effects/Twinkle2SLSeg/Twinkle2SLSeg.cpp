@@ -22,7 +22,7 @@ Twinkle2SLSeg::Twinkle2SLSeg(SegmentSetPS &SegSet, CRGB Color, CRGB BgColor, uin
 }
 
 Twinkle2SLSeg::~Twinkle2SLSeg() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
     deleteTwinkleSet();
 }
 
@@ -45,7 +45,7 @@ void Twinkle2SLSeg::init(uint8_t FadeInSteps, uint8_t FadeOutSteps, CRGB BgColor
 
 //creates an palette of length 1 containing the passed in color
 void Twinkle2SLSeg::setSingleColor(CRGB Color) {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
     paletteTemp = paletteUtilsPS::makeSingleColorPalette(Color);
     palette = &paletteTemp;
 }
@@ -58,11 +58,11 @@ void Twinkle2SLSeg::initTwinkleArrays() {
 
     //make a new set of twinkles and a twinkleSet
     //and bind the twinkleSet to the twinkles
-    twinkleArr = (twinkleStarPS **)malloc(numTwinkles * sizeof(twinkleStarPS *));
+    twinkleArr = (twinkleStarPS **)memUtilsPS::allocPS(numTwinkles * sizeof(twinkleStarPS *));
     twinkleSetTemp = {twinkleArr, numTwinkles, numTwinkles};
     twinkleSet = &twinkleSetTemp;
     for( uint16_t i = 0; i < numTwinkles; i++ ) {
-        twinkleStarPS *t = (twinkleStarPS *)malloc(sizeof(struct twinkleStarPS));
+        twinkleStarPS *t = (twinkleStarPS *)memUtilsPS::allocPS(sizeof(struct twinkleStarPS));
         twinkleSetTemp.setTwinkle(t, i);
     }
     reset();
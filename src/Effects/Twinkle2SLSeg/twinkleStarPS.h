@@ -9,6 +9,8 @@
     #include "pins_arduino.h"
 #endif
 
+#include "Memory_Stuff/memUtilsPS.h"
+
 //A structure for holding a twinkle
 //Twinkles are single pixels of a single color that fades in and out
 struct twinkleStarPS {
@@ -67,14 +69,14 @@ struct twinkleSetPS {
     };
 
     //Frees the memory of the twinkle set by freeing all the twinkles and the twinkle array. 
-    //++Should only be use if the twinkle set was dynamically allocated (ie using malloc() or "new")++
+    //++Should only be use if the twinkle set was dynamically allocated (ie using malloc() or memUtilsPS::allocPS())++
     void deleteTwinkleSet(){
         if( twinkleArr ) {  //check that the twinkle set array exists
             //we need to delete all the twinkles in the set before deleting the twinkle array
             for( uint16_t i = 0; i < maxLength; i++ ) {
-                free(twinkleArr[i]);
+                memUtilsPS::freePS(twinkleArr[i]);
             }
-            free(twinkleArr);
+            memUtilsPS::freePS(twinkleArr);
         }
     };
 };
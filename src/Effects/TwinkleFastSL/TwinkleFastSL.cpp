@@ -18,7 +18,7 @@ TwinkleFastSL::TwinkleFastSL(SegmentSetPS &SegSet, CRGB Color, CRGB BgColor, uin
 }
 
 TwinkleFastSL::~TwinkleFastSL() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
 }
 
 //sets up all the core class vars, and initializes the pixel and color arrays
@@ -33,7 +33,7 @@ void TwinkleFastSL::init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate) {
 
 //creates an palette of length 1 containing the passed in color
 void TwinkleFastSL::setSingleColor(CRGB Color) {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
     paletteTemp = paletteUtilsPS::makeSingleColorPalette(Color);
     palette = &paletteTemp;
 }
@@ -18,7 +18,9 @@ TwinkleSL::TwinkleSL(SegmentSetPS &SegSet, CRGB Color, CRGB BgColor, uint16_t Nu
 }
 
 TwinkleSL::~TwinkleSL() {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
+    memUtilsPS::freePS(bgCache.pixelArr);
+    memUtilsPS::freePS(bgCache.segLayout.segPtrArr);
     deleteTwinkleArrays();
 }
 
@@ -31,58 +33,50 @@ void TwinkleSL::init(uint8_t FadeInSteps, uint8_t FadeOutSteps, CRGB BgColor, Se
     bindBGColorPS();
     //Set the steps, this will also create the twinkle color and location arrays
     setSteps(FadeInSteps, FadeOutSteps);
-    //Since the twinkle color and location arrays have been created, we need to record their size as the current maximum
-    numTwinklesMax = numTwinkles;
     reset();
 }
 
 //creates an palette of length 1 containing the passed in color
 void TwinkleSL::setSingleColor(CRGB Color) {
-    free(paletteTemp.paletteArr);
+    memUtilsPS::freePS(paletteTemp.paletteArr);
     paletteTemp = paletteUtilsPS::makeSingleColorPalette(Color);
     palette = &paletteTemp;
 }
 
-//creates the 2D arrays for storing the random twinkle locations (relative to the segSet) and their colors
-//There's two separate arrays, which could be combined into an array of structs, but ehh
-//The arrays are laid out like [numTwinkles][totalFadeSteps], where the column index is the fade step the twinkle is on
-//the minium value of totalFadeSteps is 2, one step to fade in, and one step to fade out
+//creates the arrays for storing the random twinkle locations (relative to the segSet) and their colors
+//Both arrays are held in a single allocation, with the location array first, followed by the color array
+//The arrays are laid out as a ring of totFadeSteps rows, each numTwinkles long, where each row holds the twinkles on one fade step
+//The row at ringHead holds the newest twinkles (fade step 0), with the following rows holding the later fade steps (wrapping)
+//(see incrementTwinkleArrays())
+//The arrays are only re-allocated if they need to be larger (or alwaysResizeObj_PS is true)
 //we don't initialize the arrays to anything, since we want a gradual build up to the twinkles fading
 void TwinkleSL::initTwinkleArrays() {
     //the total length of each column is the number of steps needed to fade a twinkle in and out
     //We overlap the center step (where the twinkle is fully fade in)
     //so that that step isn't doubly long
     totFadeSteps = fadeInSteps + fadeOutSteps;
+    twinkleArrLen = (uint32_t)numTwinkles * totFadeSteps;
 
-    //delete the old arrays to prevent memory leak
-    deleteTwinkleArrays();
-
-    //create new 2D arrays
-    //we need to make the rows first, and then fill them
-    //with pointers to the column arrays
-    ledArray = (uint16_t **)malloc(numTwinkles * sizeof(uint16_t *));
+    if( alwaysResizeObj_PS || (twinkleArrLen > twinkleArrMaxLen) ) {
+        twinkleArrMaxLen = twinkleArrLen;
 
-    colorIndexArr = (CRGB **)malloc(numTwinkles * sizeof(CRGB *));
+        //delete the old arrays to prevent memory leak
+        deleteTwinkleArrays();
 
-    for( uint16_t i = 0; i < numTwinkles; i++ ) {
-        ledArray[i] = (uint16_t *)malloc(totFadeSteps * sizeof(uint16_t));
-        colorIndexArr[i] = (CRGB *)malloc(totFadeSteps * sizeof(CRGB));
+        //The uint16_t locations are placed first so they are aligned, the CRGB colors have no alignment needs
+        ledArray = (uint16_t *)memUtilsPS::allocPS(twinkleArrLen * (sizeof(uint16_t) + sizeof(CRGB)));
+        colorIndexArr = (CRGB *)(ledArray + twinkleArrLen);
     }
     reset();
 }
 
 //deletes the twinkle index and color arrays
 //used to prevent memory leaks
+//(the color array is part of the location array's allocation, so we only need to free the location array)
 void TwinkleSL::deleteTwinkleArrays() {
-    if( ledArray ) {
-        uint16_t twinkleArrSize = SIZE(ledArray);
-        for( uint16_t i = 0; i < twinkleArrSize; i++ ) {
-            free(ledArray[i]);
-            free(colorIndexArr[i]);
-        }
-        free(ledArray);
-        free(colorIndexArr);
-    }
+    memUtilsPS::freePS(ledArray);
+    ledArray = nullptr;
+    colorIndexArr = nullptr;
 }
 
 //resets the startup vars to their defaults
@@ -90,18 +84,19 @@ void TwinkleSL::deleteTwinkleArrays() {
 void TwinkleSL::reset() {
     startUpDone = false;
     totalSteps = 0;
+    ringHead = 0;
     segDrawUtils::fillSegSetColor(*segSet, *bgColor, bgColorMode);
 }
 
 //sets the number of fade in and out steps (min value of 1)
-//Will re-create the twinkle arrays if the new total number of steps (fadeInSteps + fadeOutSteps) is greater than the current number of steps
+//Will re-create the twinkle arrays if they are not large enough to hold the new total number of steps (fadeInSteps + fadeOutSteps)
 //This also resets the effect
 void TwinkleSL::setSteps(uint8_t newFadeInSteps, uint8_t newFadeOutSteps) {
 
     //set the number of fade in/out steps (min of 1 each)
     fadeInSteps = newFadeInSteps;
     if( fadeInSteps < 1 ) {
-        fadeOutSteps = 1;
+        fadeInSteps = 1;
     }
 
     fadeOutSteps = newFadeOutSteps;
@@ -112,42 +107,39 @@ void TwinkleSL::setSteps(uint8_t newFadeInSteps, uint8_t newFadeOutSteps) {
     //We only need to make new twinkle arrays if the current ones aren't large enough
     //This helps prevent memory fragmentation by limiting the number of heap allocations
     //but this may use up more memory overall.
-    totFadeSteps = fadeInSteps + fadeOutSteps;
-    if( totFadeSteps > totFadeStepsMax ) {
-        totFadeStepsMax = totFadeSteps;
-        initTwinkleArrays();
-    }
+    initTwinkleArrays();
 }
 
 //sets the number of random pixels
 //Will reset the effect if the new number of twinkles is different than the current number
 void TwinkleSL::setNumTwinkles(uint16_t newNumTwinkles) {
-
-    //We only need to make new twinkle arrays if the current ones aren't large enough
-    //This helps prevent memory fragmentation by limiting the number of heap allocations
-    //but this may use up more memory overall.
-    if( alwaysResizeObj_PS || (newNumTwinkles > numTwinklesMax) ) {
-        numTwinklesMax = newNumTwinkles;
-        numTwinkles = newNumTwinkles;
-        initTwinkleArrays();
-    } else if( numTwinkles != newNumTwinkles ) {
+    if( numTwinkles != newNumTwinkles || alwaysResizeObj_PS ) {
         //If the new number of twinkles is different than the current number,
         //we have to reset() to clear any that may no longer be updated
+        //(this also re-creates the twinkle arrays if they aren't large enough)
         numTwinkles = newNumTwinkles;
-        reset();
+        initTwinkleArrays();
     }
 }
 
+//Quality hook for the EffectSetPS frame governor
+//Lowering the quality reduces how many new twinkles are spawned each update (see update())
+void TwinkleSL::setQuality(uint8_t newQuality) {
+    quality = newQuality;
+}
+
 /* updates the effect
 How it works:
-    On each update cycle we spawn a new twinkle for each numTwinkles and put it at the start of the ledArray
+    On each update cycle we spawn a new twinkle for each numTwinkles and put it in the newest row of the ledArray
     while moving all the old twinkles one step forward in the ledArray
-    The twinkle's index in the ledArray indicates the fade step it's on, while the value is it's location
+    The twinkle's row in the ledArray indicates the fade step it's on, while the value is it's location
+    The rows form a ring, so rather than copying the twinkles to move them forward, 
+    we just move the ring's head (see incrementTwinkleArrays())
 
     We run through all the pixels in the array and set their color based on the fade level (the array column index)
     we run through the column's backwards, so that if there's overlapping pixels, we always put out the brightest level
     If we're on the zeroth column, we choose a new color and pixel location
-    after each cycle we shift the array entries over by one (no wrapping)
+    after each cycle we shift the ring head back by one
     so each led is picked, then shifted along the array, fading in and out as it goes
 
     Note that the effect is set to draw along segment lines, so one twinkle is actually a twinkle along 
@@ -156,7 +148,11 @@ How it works:
     
     For the first set of cycles, we don't have a full array of pixels in the ledArray
     We're in "startup mode", so we limit how much of the pixel arrays we read from
-    incrementing the amount as we fill the array in after each cycle, until we've covered the whole array */
+    incrementing the amount as we fill the array in after each cycle, until we've covered the whole array
+
+    If the quality has been lowered (see setQuality()), we only spawn new twinkles in the first numSpawn twinkle columns,
+    marking the rest as empty (65535), and skipping them when drawing. 
+    This way any existing twinkles still fade out, while cutting down on the drawing work. */
 void TwinkleSL::update() {
     currentTime = millis();
 
@@ -176,34 +172,62 @@ void TwinkleSL::update() {
             }
         }
 
+        //Work out how many twinkles we can spawn at the current quality (at least 1)
+        numSpawn = numTwinkles;
+        if( quality < 255 ) {
+            numSpawn = ((uint32_t)numTwinkles * quality) >> 8;
+            if( numSpawn < 1 ) {
+                numSpawn = 1;
+            }
+        }
+
         //by default, we only touch twinkles that are fading
         //but for rainbow or gradient backgrounds that a cycling
         //you want to redraw the whole thing
         if( fillBg ) {
-            segDrawUtils::fillSegSetColor(*segSet, *bgColor, bgColorMode);
+            if( cacheBg ) {
+                segDrawUtils::fillSegSetColorCached(*segSet, bgCache, *bgColor, bgColorMode);
+            } else {
+                segDrawUtils::fillSegSetColor(*segSet, *bgColor, bgColorMode);
+            }
         }
 
         //We run through all the twinkles in the array and set their color based on the fade level (the array column index)
         //we run through the column's (j) backwards, so that if there's overlapping twinkles, we always put out the brightest level
         //If we're on the zeroth column, we choose a new color and twinkle location
-        //after each cycle we shift the array entries over by one (no wrapping)
+        //after each cycle we shift the ring head back by one
         //write out a test array if you are confused
         for( uint16_t i = 0; i < numTwinkles; i++ ) {
             for( int16_t j = totalSteps - 1; j >= 0; j-- ) {
+                //Get the twinkle's location in the arrays, the row for the fade step (j) is offset from the ring head (wrapping)
+                ringRow = ringHead + j;
+                if( ringRow >= totFadeSteps ) {
+                    ringRow -= totFadeSteps;
+                }
+                twinkleIndex = (uint32_t)ringRow * numTwinkles + i;
+
                 if( j == 0 ) {  //first index, set a new line location and color for a new twinkle
-                    ledArray[i][0] = random16(numLines);
-                    colorIndexArr[i][0] = pickColor();
+                    if( i < numSpawn ) {
+                        ledArray[twinkleIndex] = randUtilsPS::rand16(randStream, numLines);
+                        colorIndexArr[twinkleIndex] = pickColor();
+                    } else {
+                        ledArray[twinkleIndex] = 65535;  //Mark the twinkle as empty (see setQuality())
+                    }
+                }
+                lineNum = ledArray[twinkleIndex];
+                //Skip any empty twinkles, (only happens if the quality has been lowered)
+                if( lineNum == 65535 ) {
+                    continue;
                 }
-                lineNum = ledArray[i][j];
                 //for each pixel in the segment line we output the cross-fade color based on the
-                //line color (colorIndexArr[i][j]) and the color mode
+                //line color (colorIndexArr[twinkleIndex]) and the color mode
                 for( uint16_t k = 0; k < numSegs; k++ ) {
                     //get the physical pixel location based on the line and seg numbers
                     pixelNum = segDrawUtils::getPixelNumFromLineNum(*segSet, k, lineNum);
                     //grab the background color, accounting for color modes
                     colorTarget = segDrawUtils::getPixelColor(*segSet, pixelNum, *bgColor, bgColorMode, k, lineNum);
                     //get the twinkle color, accounting for color modes
-                    twinkleColor = segDrawUtils::getPixelColor(*segSet, pixelNum, colorIndexArr[i][j], colorMode, k, lineNum);
+                    twinkleColor = segDrawUtils::getPixelColor(*segSet, pixelNum, colorIndexArr[twinkleIndex], colorMode, k, lineNum);
 
                     //we either fade in or out depending which index we're on (earlier fade in, later fade out)
                     //we don't want to double count the final step of the fade in and the initial step of the fade out
@@ -234,23 +258,21 @@ CRGB TwinkleSL::pickColor() {
     switch( randMode ) {
         case 0: //we're picking from a set of colors
         default:
-            twinkleColor = paletteUtilsPS::getPaletteColor(*palette, random8(paletteLength));
+            twinkleColor = paletteUtilsPS::getPaletteColor(*palette, randUtilsPS::rand8(randStream, paletteLength));
             break;
         case 1: //set colors at random
-            twinkleColor = colorUtilsPS::randColor();
+            twinkleColor = colorUtilsPS::randColor(randStream);
             break;
     }
     return twinkleColor;
 }
 
-//shift the columns of the pixel arrays to the left by one
-//we don't need to worry about the values of the final index,
-//since pixels in that location will be fully faded out
+//moves all the twinkles forward one fade step by moving the ring head back one row (wrapping)
+//The row that was the last fade step becomes the new head, and will be filled with new twinkles on the next update
+//we don't need to worry about the values in the last row, since pixels in it will be fully faded out
 void TwinkleSL::incrementTwinkleArrays() {
-    for( uint16_t i = 0; i < numTwinkles; i++ ) {
-        for( uint16_t j = totFadeSteps - 1; j > 0; j-- ) {
-            ledArray[i][j] = ledArray[i][j - 1];
-            colorIndexArr[i][j] = colorIndexArr[i][j - 1];
-        }
+    if( ringHead == 0 ) {
+        ringHead = totFadeSteps;
     }
+    ringHead--;
 }
\ No newline at end of file
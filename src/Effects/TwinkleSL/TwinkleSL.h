@@ -32,8 +32,8 @@ Note that adjusting most of the effect's settings will reset the effect.
         * 1 -- Picks colors totally at random.
 
 **Warning**, for the effect to work, it needs to keep track of all the active twinkles as they fade in/out. 
-To do this it uses a pair of _dynamically_ created 2D uint16_t and CRGB arrays of 
-size `numTwinkles * (fadeInSteps + fadeOutSteps`). 
+To do this it uses a _dynamically_ created uint16_t and CRGB array pair (held in a single allocation) of 
+size `numTwinkles * (fadeInSteps + fadeOutSteps)`, taking 5 bytes per entry. 
 This can take up a good amount of ram, so be aware of your available memory. 
 To avoid memory fragmentation, when you create the effect, 
 you should set set numTwinkles, fadeInSteps, and fadeOutSteps to the maximum value you expect to use. 
@@ -67,6 +67,10 @@ Other Settings:
     bgColorMode (default 0) -- sets the color mode for the background (see segDrawUtils::setPixelColor)
     randMode (default 0) -- (See randMode notes in intro)
     fillBg (default false) -- sets the background to be redrawn every cycle, useful for bgColorModes that are dynamic
+    cacheBg (default true, false on AVR chips) -- If true, the background colors are cached when the background is re-drawn each update,
+                                                 so they can be copied straight back to the pixels, rather than being re-calculated.
+                                                 The cache is re-built automatically whenever the background changes (see bgCachePS.h).
+                                                 It uses 5 bytes of memory per pixel, so it's turned off by default on AVR chips.
 
 Functions:
     setSingleColor(Color) -- Sets the effect to use a single color for the pixels. 
@@ -76,6 +80,9 @@ Functions:
                                                  (Will reset the effect if the new total number of steps (fadeInSteps + fadeOutSteps) 
                                                  is greater than the current total)
     reset() -- Restarts the effect. Clears any existing twinkles.
+    setQuality(newQuality) -- Quality hook for the EffectSetPS frame governor (see EffectSetPS.h).
+                              Below full quality (255), fewer new twinkles are spawned each update, 
+                              (down to a minimum of 1) while any existing twinkles fade out as normal.
     update() -- updates the effect
 
 reference Vars:
@@ -114,7 +121,8 @@ class TwinkleSL : public EffectBasePS {
             *bgColor = nullptr;  //bgColor is a pointer so it can be tied to an external variable if needed (such as a palette color)
 
         bool
-            fillBg = false;
+            fillBg = false,
+            cacheBg = BG_USE_CACHE_PS;
 
         palettePS
             *palette = nullptr,
@@ -127,6 +135,7 @@ class TwinkleSL : public EffectBasePS {
             setNumTwinkles(uint16_t newNumTwinkles),
             initTwinkleArrays(),
             deleteTwinkleArrays(),
+            setQuality(uint8_t newQuality),
             update(void);
 
     private:
@@ -136,28 +145,38 @@ class TwinkleSL : public EffectBasePS {
 
         uint8_t
             paletteLength,
-            step;
+            step,
+            quality = 255;
 
         uint16_t
             totalSteps = 0,
-            totFadeStepsMax = 0,  //used for tracking the memory size of the led and color index arrays
             totFadeSteps,
+            ringHead = 0,  //the row of the twinkle arrays holding the newest twinkles (fade step 0)
+            ringRow,
             numSegs,
             numLines,
+            numSpawn,
             lineNum,
             pixelNum,
-            numTwinklesMax = 0,  //used for tracking the memory size of the led and color index arrays
-            **ledArray = nullptr;
+            *ledArray = nullptr;
+
+        uint32_t
+            twinkleArrLen,
+            twinkleArrMaxLen = 0,  //used for tracking the memory size of the led and color index arrays
+            twinkleIndex;
 
         bool
             startUpDone = false;
 
         CRGB
-            **colorIndexArr = nullptr,
+            *colorIndexArr = nullptr,
             twinkleColor,
             colorTarget,
             pickColor();
 
+        bgCachePS
+            bgCache = {};  //Must init structs w/ pointers set to null for safety
+
         void
             init(uint8_t FadeInSteps, uint8_t FadeOutSteps, CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate),
             incrementTwinkleArrays();
@@ -19,8 +19,8 @@ XmasLightsSLSeg::XmasLightsSLSeg(SegmentSetPS &SegSet, patternPS &Pattern, palet
 
 //Destructor
 XmasLightsSLSeg::~XmasLightsSLSeg() {
-    free(patternTemp.patternArr);
-    free(twinkleArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
+    memUtilsPS::freePS(twinkleArr);
 }
 
 //Initializes core effect variables and setup the effect
@@ -92,8 +92,8 @@ void XmasLightsSLSeg::setupTwinkleArray() {
     if( alwaysResizeObj_PS || (twinkArrLenTemp > twinkArrLenMax) ) {
         twinkArrLenMax = twinkArrLenTemp;
         twinkArrLen = twinkArrLenTemp;
-        free(twinkleArr);
-        twinkleArr = (uint8_t *)malloc(twinkArrLen * sizeof(uint8_t));
+        memUtilsPS::freePS(twinkleArr);
+        twinkleArr = (uint8_t *)memUtilsPS::allocPS(twinkArrLen * sizeof(uint8_t));
     }
     twinkArrLen = twinkArrLenTemp;
 
@@ -130,12 +130,14 @@ void XmasLightsSLSeg::initialFill() {
 }
 
 //This effect is pretty simple in concept, with a lot of extra bits to handle different segModes, patterns, etc
-//The main idea is that with each update we roll a dice for each LED/line/whatever.
-//If we roll above a certain value we switch the state of the LED between on/off (background).
+//The main idea is that with each update each LED/line/whatever has a chance to switch states between on/off (background).
 //To help vary the effect, we allow different probability thresholds for turning on and off,
 //so we can make it more likely an off LED will turn on, etc.
 //To track the state of the LEDs we use a "compacted bit array" where we use the individual bits of
 //a set of uint8_t's represent individual LEDs. (1 is on, 0 is off)
+//Because the chances are usually small, rather than rolling for each LED, we draw the number of "on" and "off" LEDs
+//to skip before the next one toggles (see randUtilsPS::randGap()). We then read the bit array 32 LEDs at a time,
+//and only pick out the bits for the LEDs that toggle. 
 //The rest of the code is just picking the color to draw and how to draw it.
 //Note that by default the effect only draws an LED if it changed, and it pre-fills the pattern on the first update
 //(these settings are controlled with fillBg and bgPrefill)
@@ -149,47 +151,99 @@ void XmasLightsSLSeg::update() {
         //because we only draw pixels when their state changes, and we don't want to start with an empty segment set
         if( firstUpdate ) {
             initialFill();
+            updateGapScales();
             firstUpdate = false;
         }
 
-        //Cycle across all the segment lines/segments/pixels depending on segMode
-        //For each pixel, check the probability of it turning on/off
-        //If it triggers, toggle its bit state and color
-        for( uint16_t i = 0; i < numTwinkles; i++ ) {
-
-            //We only want to draw pixels that change states,
-            //drawNow flags if it changes
-            drawNow = false;
+        //Re-calculate the gap scales if any of the chances have changed
+        if( onChance != onChanceLast || offChance != offChanceLast || chanceBasis != chanceBasisLast ) {
+            updateGapScales();
+        }
 
-            //Find what number our current line/segment/pixel is in in the bit array
-            //and then find what bit it's on
-            twinkArrPos = i / 8;  //(integer math rounds down so this works)
-            bitPos = mod16PS(i, 8);
+        //Get the number of "on" and "off" lines/segments/pixels to skip before the next of each toggles
+        //("on" pixels turn off using offChance, and visa versa)
+        //(the gaps are memoryless, so we can draw fresh ones each update)
+        onSkip = randUtilsPS::randGap(randStream, offGapScale);
+        offSkip = randUtilsPS::randGap(randStream, onGapScale);
+
+        //Cycle across the bit array in 32 bit words (32 lines/segments/pixels at a time)
+        for( uint16_t i = 0; i < numTwinkles; i += 32 ) {
+
+            //Read up to 4 bytes of the bit array into a single word
+            //The last word may be partial, so we mask out any bits past the end of the twinkles
+            twinkArrPos = i / 8;
+            wordLen = minPS(numTwinkles - i, 32);
+            twinkWord = 0;
+            for( uint8_t j = 0; j * 8 < wordLen; j++ ) {
+                twinkWord |= (uint32_t)twinkleArr[twinkArrPos + j] << (j * 8);
+            }
+            validMask = (wordLen == 32) ? 0xFFFFFFFF : (((uint32_t)1 << wordLen) - 1);
+
+            //Pick out the "on" and "off" bits that will toggle
+            //Note that both are picked using the word's state at the start of the update, 
+            //so a pixel can't toggle twice in one update
+            toggleMask = pickToggles(twinkWord & validMask, onSkip, offGapScale);
+            toggleMask |= pickToggles(~twinkWord & validMask, offSkip, onGapScale);
+
+            //Toggle the bits and write them back into the bit array
+            if( toggleMask ) {
+                twinkWord ^= toggleMask;
+                for( uint8_t j = 0; j * 8 < wordLen; j++ ) {
+                    twinkleArr[twinkArrPos + j] = twinkWord >> (j * 8);
+                }
+            }
 
-            //Get the on/off state for the current pixel
-            bitState = bitRead(twinkleArr[twinkArrPos], bitPos);
+            //Draw any of the pixels that have changed state (or all of them if we're set to always re-draw the pixels)
+            drawMask = fillBg ? validMask : toggleMask;
+            for( uint8_t j = 0; drawMask; j++ ) {
+                if( drawMask & 1 ) {
+                    bitState = (twinkWord >> j) & 1;
+                    draw(i + j);
+                }
+                drawMask >>= 1;
+            }
+        }
 
-            //We allow different probability for turning on/off
-            chance = bitState ? offChance : onChance;
+        showCheckPS();
+    }
+}
 
-            //Roll the dice for turning on/off the pixel
-            //If we hit it, we swap the pixel's bit state and tell the effect to draw it (drawNow = true)
-            if( random16(chanceBasis) <= chance ) {
-                drawNow = true;
+//Re-calculates the gap scales for the on/off chances (see randUtilsPS::getGapScale())
+//An off pixel turns on if "random(chanceBasis) <= onChance", which has a (onChance + 1)/chanceBasis chance of happening
+//(and the same for offChance)
+void XmasLightsSLSeg::updateGapScales() {
+    onChanceLast = onChance;
+    offChanceLast = offChance;
+    chanceBasisLast = chanceBasis;
 
-                bitState = !bitState;
-                bitWrite(twinkleArr[twinkArrPos], bitPos, bitState);
-            }
+    onGapScale = randUtilsPS::getGapScale((uint32_t)onChance + 1, chanceBasis);
+    offGapScale = randUtilsPS::getGapScale((uint32_t)offChance + 1, chanceBasis);
+}
 
-            //If the pixel has changed state (or we're set to always re-draw the pixels),
-            //draw it!
-            if( drawNow || fillBg ) {
-                draw(i);
-            }
+//Returns a mask of the bits that toggle out of a population of bits (popMask), either all the "on" or "off" bits in a word
+//"skip" is the number of bits in the population to skip before the next toggle,
+//it is carried over from word to word, and a new gap is drawn after each toggle.
+uint32_t XmasLightsSLSeg::pickToggles(uint32_t popMask, uint32_t &skip, float gapScale) {
+    uint32_t toggles = 0, lowBit;
+    uint8_t popCount = countBits32PS(popMask);
+
+    //If the next toggle is past the end of the word, we can skip the whole word
+    while( skip < popCount ) {
+        //Clear the bits we're skipping (lowest first)
+        //The lowest bit left is the one that toggles
+        popCount -= skip + 1;
+        for( ; skip > 0; skip-- ) {
+            popMask &= popMask - 1;
         }
+        lowBit = popMask & (~popMask + 1);
+        toggles |= lowBit;
+        popMask ^= lowBit;
 
-        showCheckPS();
+        skip = randUtilsPS::randGap(randStream, gapScale);
     }
+
+    skip -= popCount;
+    return toggles;
 }
 
 //Draws the specific line/segment/pixel, "i" according to what bit state it's in (on/off)
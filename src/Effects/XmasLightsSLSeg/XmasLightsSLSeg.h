@@ -38,6 +38,11 @@ Inputs Guide and Notes:
     so if the effect starts as all background, the color pattern will slowly be filled in and visa versa. 
     To accommodate dynamic Color Modes, you can also set all the pixels to be re-drawn each update using `fillBg`.
 
+    Rather than rolling the on/off chance for every pixel each update, the effect draws how many "on" (or "off") 
+    pixels to skip before the next one toggles (see randUtilsPS::randGap()), and then jumps straight to it, 
+    scanning the pixel states 32 at a time. The odds are the same, but the effect only does work for the pixels 
+    that toggle, so it stays quick for long strips and low chances.
+
     segModes:
         0 -- The pattern and twinkles will be drawn using segment lines (each line will be a single color).
         1 -- The pattern and twinkles will be drawn using whole segments (each segment will be a single color).
@@ -159,17 +164,32 @@ class XmasLightsSLSeg : public EffectBasePS {
         uint8_t 
             *twinkleArr = nullptr,
             bitState,
-            bitPos,
+            wordLen,
             modeOut,
             paletteIndex;
         
         uint16_t
             numTwinkles,
-            chance,
             twinkArrLen,
             twinkArrLenMax = 0,
             twinkArrPos,
-            patternIndex;
+            patternIndex,
+            onChanceLast,
+            offChanceLast,
+            chanceBasisLast;
+        
+        uint32_t
+            twinkWord,
+            validMask,
+            toggleMask,
+            drawMask,
+            onSkip,
+            offSkip,
+            pickToggles(uint32_t popMask, uint32_t &skip, float gapScale);
+        
+        float
+            onGapScale,
+            offGapScale;
         
         bool
             firstUpdate = true,
@@ -181,6 +201,7 @@ class XmasLightsSLSeg : public EffectBasePS {
         void
             init(CRGB BgColor, SegmentSetPS &SegSet, uint16_t Rate),
             initialFill(),
+            updateGapScales(),
             draw(uint16_t i);
 };      
 
@@ -7,13 +7,13 @@ If the existing pattern isn't large enough a new array will be created for the p
 It will ONLY re-size the pattern array if needs to be larger, or if alwaysResizeObj_PS is true (see pixelSpork.h),
 Otherwise it will just adjust the pattern's "length" to be lower.
 If the pattern is re-sized, its new memory length will be recorded in the pattern's "maxLength" and "length" properties
-!!!!Make sure you free the array after you are done with the pattern by calling free(pattern.patternArr). */
+!!!!Make sure you free the array after you are done with the pattern by calling memUtilsPS::freePS(pattern.patternArr). */
 void generalUtilsPS::resizePattern(patternPS &pattern, uint16_t sizeNeeded) {
 
     //if the pattern array doesn't have enough memory, create a new pattern array dynamically
     if( alwaysResizeObj_PS || (sizeNeeded > pattern.maxLength) ) {
-        free(pattern.patternArr);
-        uint8_t *pattern_arr = (uint8_t *)malloc(sizeNeeded * sizeof(uint8_t));
+        memUtilsPS::freePS(pattern.patternArr);
+        uint8_t *pattern_arr = (uint8_t *)memUtilsPS::allocPS(sizeNeeded * sizeof(uint8_t));
         pattern.patternArr = pattern_arr;
         pattern.maxLength = sizeNeeded;
     }
@@ -27,7 +27,7 @@ void generalUtilsPS::resizePattern(patternPS &pattern, uint16_t sizeNeeded) {
 ex: for palette length 5, the output patternArr would be {0, 1, 2, 3, 4}
 ie all the colors in the palette in order
 Note, if the pattern is not large enough to store the palette pattern, it will be re-sized dynamically. (see resizePattern())
-!!!Because of this, make sure you free() the patternArr when you're done by calling free(pattern.patternArr). */
+!!!Because of this, make sure you free() the patternArr when you're done by calling memUtilsPS::freePS(pattern.patternArr). */
 void generalUtilsPS::setPaletteAsPattern(patternPS &pattern, palettePS &palette) {
     uint8_t patternLength = palette.length;
 
@@ -43,7 +43,7 @@ void generalUtilsPS::setPaletteAsPattern(patternPS &pattern, palettePS &palette)
 ex: for palette length 5, colorLength 2, the output patternArr would be {0, 0, 1, 1, 2, 2, 3, 3, 4, 4}
 ie all the colors in the palette in order, in colorLength lengths
 Note, if the pattern is not large enough to store the palette pattern, it will be re-sized dynamically. (see resizePattern())
-!!!Because of this, make sure you free() the patternArr when you're done by calling free(pattern.patternArr). */
+!!!Because of this, make sure you free() the patternArr when you're done by calling memUtilsPS::freePS(pattern.patternArr). */
 void generalUtilsPS::setPaletteAsPattern(patternPS &pattern, palettePS &palette, uint16_t colorLength) {
 
     uint16_t patternLength = palette.length * colorLength;
@@ -67,7 +67,7 @@ the final streamer pattern would be : {0, 0, 255, 1, 1, 255, 2, 2, 255}.
 where you'd want to use this sort of extended pattern anyway)
 Note, remember that the pattern length is limited to 65,025 (uint16_t max), so make sure your (colorLength + spacing) * <num palette colors> is less than the limit
 Note, if the pattern is not large enough to store the palette pattern, it will be re-sized dynamically. (see resizePattern())
-!!!Because of this, make sure you free() the patternArr when you're done by calling free(pattern.patternArr). */
+!!!Because of this, make sure you free() the patternArr when you're done by calling memUtilsPS::freePS(pattern.patternArr). */
 void generalUtilsPS::setPaletteAsPattern(patternPS &pattern, palettePS &palette, uint16_t colorLength, uint16_t spacing) {
 
     uint16_t repeatLength = (colorLength + spacing);
@@ -103,7 +103,7 @@ the streamer pattern would be: {1, 1, 255, 2, 2, 255, 4, 4, 255}.
 (Note that only a few effects actually recognize 255 as being background, but they're mostly the effects
 where you'd want to use this sort of extended pattern anyway)
 Note, if the pattern is not large enough to store the palette pattern, it will be re-sized dynamically. (see resizePattern())
-!!!Because of this, make sure you free() the patternArr when you're done by calling free(pattern.patternArr). */
+!!!Because of this, make sure you free() the patternArr when you're done by calling memUtilsPS::freePS(pattern.patternArr). */
 void generalUtilsPS::setPatternAsPattern(patternPS &outputPattern, patternPS &inputPattern, uint16_t colorLength, uint16_t spacing) {
 
     uint8_t patternIndex;
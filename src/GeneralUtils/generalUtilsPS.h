@@ -13,6 +13,7 @@
 #include "Include_Lists/PaletteFiles.h"
 #include "Include_Lists/PatternFiles.h"
 #include "ColorUtils/colorUtilsPS.h"
+#include "Memory_Stuff/memUtilsPS.h"
 
 //namespace for general functions that are used in multiple effects
 //but don't fit into color or math catagories
@@ -0,0 +1,86 @@
+#ifndef cellGridPS_h
+#define cellGridPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+Structs for grids of cells, used for running simulations (cellular automata, heat diffusion, blurs, etc) 
+over a segment set's matrix, see gridUtilsPS.h for the functions.
+
+A grid is a 2D field of uint8_t (cellGridPS) or uint16_t (cellGrid16PS) values, one for each point in the segment set's matrix, 
+with segment lines as the columns and segments as the rows (so a grid matching a segment set is numLines x numSegs).
+Grids are double buffered: each grid holds two copies of the field back to back, the "current" field, and the "next" field.
+Each simulation step reads the current field and writes the next, then the two are swapped.
+This means that every cell in a step sees its neighbors' values from before the step, no matter what order the cells are updated in.
+
+The grid's cells are stored row by row (segment by segment), so they are read in memory order when running a step.
+
+Example:
+    //<Before Arduino setup()>
+    cellGridPS grid = {nullptr}; //Must init structs w/ pointers set to null for safety
+
+    //<In Arduino setup()>
+    gridUtilsPS::resizeGridToSegSet(grid, mainSegments); //Creates a grid to match the segment set, with all cells 0
+
+    //<In your update>
+    gridUtilsPS::applyKernel(grid, gridUtilsPS::blurKernel, 0); //Runs one step of the blur kernel over the grid
+    gridUtilsPS::drawGrid(mainSegments, grid, colorLut); //Draws the grid using a 256 color LUT
+
+You shouldn't need to set any of the struct's variables yourself, they are managed by the gridUtilsPS functions.
+!!Grids are created dynamically, so make sure you free the cellArr when you're done by calling memUtilsPS::freePS(grid.cellArr). */
+struct cellGridPS {
+    uint8_t *cellArr;    //pointer to the cell array, holds both the current and next fields back to back
+    uint16_t numCols;    //the number of columns in the grid (segment lines)
+    uint16_t numRows;    //the number of rows in the grid (segments)
+    uint32_t maxLength;  //The total length of one field in the cellArr, used for memory management (see patternPS for more)
+    uint8_t curField;    //which half of the cellArr is the current field (0 or 1), the other is the next field
+};
+
+//A 16 bit version of cellGridPS, for simulations that need more precision (see above)
+struct cellGrid16PS {
+    uint16_t *cellArr;   //pointer to the cell array, holds both the current and next fields back to back
+    uint16_t numCols;    //the number of columns in the grid (segment lines)
+    uint16_t numRows;    //the number of rows in the grid (segments)
+    uint32_t maxLength;  //The total length of one field in the cellArr, used for memory management (see patternPS for more)
+    uint8_t curField;    //which half of the cellArr is the current field (0 or 1), the other is the next field
+};
+
+/* 
+Structs passed to grid kernels, holding a cell's 3x3 neighborhood from the current field.
+The cells are arranged row by row, so the center cell (the one being updated) is cells[4]:
+    cells[0] cells[1] cells[2]  <-- previous row (segment)
+    cells[3] cells[4] cells[5]  <-- the cell's row
+    cells[6] cells[7] cells[8]  <-- next row
+The left/right cells are the previous/next columns (segment lines).
+Cells outside the grid are filled in based on the edge mode (see gridUtilsPS::applyKernel()).
+The kernelData pointer is passed through from applyKernel(), so you can give your kernel extra settings or state.
+For kernels that need to reach past the 3x3 neighborhood (like the Fire2012SL heat drift, which reads two cells back),
+curField points to the grid's current field, so any cell can be read as curField[row * numCols + col].
+(Cells read this way don't use the edge mode, so make sure you stay inside the grid) */
+struct cellNbhdPS {
+    uint8_t cells[9];
+    uint16_t col;
+    uint16_t row;
+    uint8_t *curField;
+    uint16_t numCols;
+    uint16_t numRows;
+    void *kernelData;
+};
+
+struct cellNbhd16PS {
+    uint16_t cells[9];
+    uint16_t col;
+    uint16_t row;
+    uint16_t *curField;
+    uint16_t numCols;
+    uint16_t numRows;
+    void *kernelData;
+};
+
+#endif
@@ -0,0 +1,359 @@
+#include "gridUtilsPS.h"
+
+//Sets the grid to the passed in number of columns (segment lines) and rows (segments)
+//The grid is only re-allocated if it needs to be larger (or alwaysResizeObj_PS is true)
+//Both fields are cleared to 0 (the next field starts at maxLength, so we clear each field separately)
+void gridUtilsPS::resizeGrid(cellGridPS &grid, uint16_t numCols, uint16_t numRows) {
+    uint32_t length = (uint32_t)numCols * numRows;
+
+    if( alwaysResizeObj_PS || (length > grid.maxLength) ) {
+        grid.maxLength = length;
+        memUtilsPS::freePS(grid.cellArr);
+        grid.cellArr = (uint8_t *)memUtilsPS::allocPS(2 * length * sizeof(uint8_t));
+    }
+
+    grid.numCols = numCols;
+    grid.numRows = numRows;
+    grid.curField = 0;
+
+    //Clear both fields
+    for( uint32_t i = 0; i < length; i++ ) {
+        grid.cellArr[i] = 0;
+        grid.cellArr[grid.maxLength + i] = 0;
+    }
+}
+
+//Sets the grid to match the passed in segment set's matrix (numLines x numSegs)
+void gridUtilsPS::resizeGridToSegSet(cellGridPS &grid, SegmentSetPS &SegSet) {
+    resizeGrid(grid, SegSet.numLines, SegSet.numSegs);
+}
+
+//Sets all the cells in the grid's current field to the passed in value
+void gridUtilsPS::clearGrid(cellGridPS &grid, uint8_t val) {
+    uint8_t *curField = getCurField(grid);
+    uint32_t length = (uint32_t)grid.numCols * grid.numRows;
+    for( uint32_t i = 0; i < length; i++ ) {
+        curField[i] = val;
+    }
+}
+
+//Swaps the grid's current and next fields, so the next field becomes the current one
+//(applyKernel() does this for you)
+void gridUtilsPS::swapGrid(cellGridPS &grid) {
+    grid.curField = !grid.curField;
+}
+
+//Returns a pointer to the start of the grid's current field
+//(the cells are stored row by row, so a cell is at (row * numCols + col))
+uint8_t *gridUtilsPS::getCurField(cellGridPS &grid) {
+    return grid.cellArr + (grid.curField ? grid.maxLength : 0);
+}
+
+//Returns a pointer to the start of the grid's next field
+uint8_t *gridUtilsPS::getNextField(cellGridPS &grid) {
+    return grid.cellArr + (grid.curField ? 0 : grid.maxLength);
+}
+
+//Returns the value of the cell at the passed in column and row of the grid's current field
+uint8_t gridUtilsPS::getCell(cellGridPS &grid, uint16_t col, uint16_t row) {
+    return getCurField(grid)[(uint32_t)row * grid.numCols + col];
+}
+
+//Sets the value of the cell at the passed in column and row of the grid's current field
+void gridUtilsPS::setCell(cellGridPS &grid, uint16_t col, uint16_t row, uint8_t val) {
+    getCurField(grid)[(uint32_t)row * grid.numCols + col] = val;
+}
+
+//Returns the index of a row or column based on the edge mode, accounting for indexes outside the grid
+//(see applyKernel() for the edge modes)
+//Returns -1 if the index is outside the grid and should use the edge value
+int32_t gridUtilsPS::getEdgeIndex(int32_t index, uint16_t length, uint8_t edgeMode) {
+    if( index >= 0 && index < length ) {
+        return index;
+    }
+
+    switch( edgeMode ) {
+        case 0:  //use the edge value
+        default:
+            return -1;
+        case 1:  //wrap
+            return (index < 0) ? length - 1 : 0;
+        case 2:  //copy the nearest edge cell
+            return (index < 0) ? 0 : length - 1;
+    }
+}
+
+//Runs a step of the passed in kernel over the grid, using an edge value of 0 and no kernel data
+//(see the other applyKernel() below)
+void gridUtilsPS::applyKernel(cellGridPS &grid, uint8_t (*kernel)(cellNbhdPS &nbhd), uint8_t edgeMode) {
+    applyKernel(grid, kernel, edgeMode, 0, nullptr);
+}
+
+/* Runs a step of the passed in kernel over the grid
+For each cell, the kernel is passed the cell's 3x3 neighborhood from the current field, 
+and its output is written to the cell in the next field. Once all the cells are done, the fields are swapped.
+The edge mode sets how cells outside the grid are filled in:
+    0 -- They are set to the edgeVal.
+    1 -- The grid wraps, so they are taken from the opposite side of the grid.
+    2 -- They are copied from the nearest edge cell.
+The kernelData pointer is passed to the kernel in the neighborhood, so you can pass extra data to your kernel.
+
+The neighborhood slides along each row, so for each cell, we only read the three cells of the neighborhood's new right column
+from the grid, while the other six cells are shifted over from the previous cell. 
+The grid is swept row by row in memory order, calling the kernel once per cell. 
+This isn't blocked (tiled) traversal, the supported chips have little or no data cache, so tiling wouldn't gain anything. */
+void gridUtilsPS::applyKernel(cellGridPS &grid, uint8_t (*kernel)(cellNbhdPS &nbhd), uint8_t edgeMode, uint8_t edgeVal, void *kernelData) {
+    uint16_t numCols = grid.numCols,
+             numRows = grid.numRows;
+    uint8_t *curField = getCurField(grid),
+            *nextCell = getNextField(grid),
+            *rowPtrs[3];
+    int32_t edgeIndex;
+
+    nbhd.curField = curField;
+    nbhd.numCols = numCols;
+    nbhd.numRows = numRows;
+    nbhd.kernelData = kernelData;
+
+    for( uint16_t row = 0; row < numRows; row++ ) {
+        //Get the pointers to the previous, current, and next rows
+        //Rows outside the grid that use the edgeVal are set to null
+        for( uint8_t i = 0; i < 3; i++ ) {
+            edgeIndex = getEdgeIndex((int32_t)row + i - 1, numRows, edgeMode);
+            rowPtrs[i] = (edgeIndex < 0) ? nullptr : curField + edgeIndex * numCols;
+        }
+        nbhd.row = row;
+
+        //Fill in the neighborhood's middle and right columns with the cells left of the first cell and the first cell,
+        //these will be shifted over to the left and middle columns for the first cell
+        for( uint8_t j = 1; j < 3; j++ ) {
+            edgeIndex = getEdgeIndex(j - 2, numCols, edgeMode);
+            for( uint8_t i = 0; i < 3; i++ ) {
+                nbhd.cells[i * 3 + j] = (rowPtrs[i] && edgeIndex >= 0) ? rowPtrs[i][edgeIndex] : edgeVal;
+            }
+        }
+
+        for( uint16_t col = 0; col < numCols; col++ ) {
+            //Shift the neighborhood over by one column
+            for( uint8_t i = 0; i < 9; i += 3 ) {
+                nbhd.cells[i] = nbhd.cells[i + 1];
+                nbhd.cells[i + 1] = nbhd.cells[i + 2];
+            }
+
+            //Read in the new right column
+            edgeIndex = col + 1;
+            if( edgeIndex >= numCols ) {
+                edgeIndex = getEdgeIndex(edgeIndex, numCols, edgeMode);
+            }
+            for( uint8_t i = 0; i < 3; i++ ) {
+                nbhd.cells[i * 3 + 2] = (rowPtrs[i] && edgeIndex >= 0) ? rowPtrs[i][edgeIndex] : edgeVal;
+            }
+
+            nbhd.col = col;
+            *nextCell = kernel(nbhd);
+            nextCell++;
+        }
+    }
+    swapGrid(grid);
+}
+
+//Draws the grid's current field onto the segment set, using the passed in 256 color LUT to set each cell's color
+//(see the other drawGrid() below)
+void gridUtilsPS::drawGrid(SegmentSetPS &SegSet, cellGridPS &grid, CRGB *colorLut) {
+    drawGrid(SegSet, grid, colorLut, false);
+}
+
+//Draws the grid's current field onto the segment set, using the passed in 256 color LUT to set each cell's color
+//(each cell's value is its color's index in the LUT)
+//The grid's columns are the segment set's lines and its rows are the segments
+//If reverse is true, the rows are drawn in reverse, so the first row is drawn on the last segment, etc
+//Any cells outside the segment set are skipped
+void gridUtilsPS::drawGrid(SegmentSetPS &SegSet, cellGridPS &grid, CRGB *colorLut, bool reverse) {
+    uint8_t *curCell;
+    uint16_t numRows = min(grid.numRows, SegSet.numSegs),
+             numCols = min(grid.numCols, SegSet.numLines),
+             segNum;
+
+    for( uint16_t row = 0; row < numRows; row++ ) {
+        curCell = getCurField(grid) + (uint32_t)row * grid.numCols;
+        segNum = reverse ? (SegSet.numSegs - row - 1) : row;
+        for( uint16_t col = 0; col < numCols; col++ ) {
+            pixelNum = segDrawUtils::getPixelNumFromLineNum(SegSet, segNum, col);
+            segDrawUtils::setPixelColor(SegSet, pixelNum, colorLut[curCell[col]], 0, 0, 0);
+        }
+    }
+}
+
+//Fills the passed in 256 color LUT with a gradient of the palette's colors
+//If looped is true, the gradient will blend from the last palette color back to the first,
+//otherwise the gradient will end on the last palette color
+void gridUtilsPS::fillGridLut(CRGB *colorLut, palettePS &palette, bool looped) {
+    uint16_t gradStep;
+
+    for( uint16_t i = 0; i < 256; i++ ) {
+        if( looped || palette.length < 2 ) {
+            colorLut[i] = paletteUtilsPS::getPaletteGradColor(palette, i, 0, 256);
+        } else {
+            //Spread the palette colors across the LUT, so that the first is at index 0, and the last at 255
+            gradStep = i * (palette.length - 1);
+            colorLut[i] = colorUtilsPS::getCrossFadeColor(paletteUtilsPS::getPaletteColor(palette, gradStep / 255),
+                                                          paletteUtilsPS::getPaletteColor(palette, gradStep / 255 + 1),
+                                                          gradStep % 255);
+        }
+    }
+}
+
+//A kernel that sets a cell to a weighted average of its neighborhood, spreading values out like a blur
+//The cell itself has a weight of 4, its left/right/up/down neighbors 2, and its diagonal neighbors 1 (16 total)
+uint8_t gridUtilsPS::blurKernel(cellNbhdPS &nbhd) {
+    uint16_t sum = (nbhd.cells[4] << 2) +
+                   ((nbhd.cells[1] + nbhd.cells[3] + nbhd.cells[5] + nbhd.cells[7]) << 1) +
+                   nbhd.cells[0] + nbhd.cells[2] + nbhd.cells[6] + nbhd.cells[8];
+    return sum >> 4;
+}
+
+//A kernel that runs Conway's Game of Life, treating cells with values > 0 as alive
+//Live cells with 2 or 3 live neighbors stay alive, and dead cells with exactly 3 live neighbors come alive
+//Live cells are set to 255, and dead cells to 0
+uint8_t gridUtilsPS::lifeKernel(cellNbhdPS &nbhd) {
+    uint8_t liveCount = 0;
+    for( uint8_t i = 0; i < 9; i++ ) {
+        if( i != 4 && nbhd.cells[i] ) {
+            liveCount++;
+        }
+    }
+
+    if( liveCount == 3 || (liveCount == 2 && nbhd.cells[4]) ) {
+        return 255;
+    }
+    return 0;
+}
+
+//====================================================================
+//16 bit grid functions, these all work the same as the 8 bit versions
+//====================================================================
+
+//Sets the grid to the passed in number of columns (segment lines) and rows (segments), see resizeGrid()
+void gridUtilsPS::resizeGrid16(cellGrid16PS &grid, uint16_t numCols, uint16_t numRows) {
+    uint32_t length = (uint32_t)numCols * numRows;
+
+    if( alwaysResizeObj_PS || (length > grid.maxLength) ) {
+        grid.maxLength = length;
+        memUtilsPS::freePS(grid.cellArr);
+        grid.cellArr = (uint16_t *)memUtilsPS::allocPS(2 * length * sizeof(uint16_t));
+    }
+
+    grid.numCols = numCols;
+    grid.numRows = numRows;
+    grid.curField = 0;
+
+    //Clear both fields (the next field starts at maxLength)
+    for( uint32_t i = 0; i < length; i++ ) {
+        grid.cellArr[i] = 0;
+        grid.cellArr[grid.maxLength + i] = 0;
+    }
+}
+
+//Sets the grid to match the passed in segment set's matrix (numLines x numSegs)
+void gridUtilsPS::resizeGrid16ToSegSet(cellGrid16PS &grid, SegmentSetPS &SegSet) {
+    resizeGrid16(grid, SegSet.numLines, SegSet.numSegs);
+}
+
+//Sets all the cells in the grid's current field to the passed in value
+void gridUtilsPS::clearGrid16(cellGrid16PS &grid, uint16_t val) {
+    uint16_t *curField = getCurField16(grid);
+    uint32_t length = (uint32_t)grid.numCols * grid.numRows;
+    for( uint32_t i = 0; i < length; i++ ) {
+        curField[i] = val;
+    }
+}
+
+//Swaps the grid's current and next fields
+void gridUtilsPS::swapGrid16(cellGrid16PS &grid) {
+    grid.curField = !grid.curField;
+}
+
+//Returns a pointer to the start of the grid's current field
+uint16_t *gridUtilsPS::getCurField16(cellGrid16PS &grid) {
+    return grid.cellArr + (grid.curField ? grid.maxLength : 0);
+}
+
+//Returns a pointer to the start of the grid's next field
+uint16_t *gridUtilsPS::getNextField16(cellGrid16PS &grid) {
+    return grid.cellArr + (grid.curField ? 0 : grid.maxLength);
+}
+
+//Returns the value of the cell at the passed in column and row of the grid's current field
+uint16_t gridUtilsPS::getCell16(cellGrid16PS &grid, uint16_t col, uint16_t row) {
+    return getCurField16(grid)[(uint32_t)row * grid.numCols + col];
+}
+
+//Sets the value of the cell at the passed in column and row of the grid's current field
+void gridUtilsPS::setCell16(cellGrid16PS &grid, uint16_t col, uint16_t row, uint16_t val) {
+    getCurField16(grid)[(uint32_t)row * grid.numCols + col] = val;
+}
+
+//Runs a step of the passed in kernel over the grid (see applyKernel() for more)
+void gridUtilsPS::applyKernel16(cellGrid16PS &grid, uint16_t (*kernel)(cellNbhd16PS &nbhd), uint8_t edgeMode, uint16_t edgeVal, void *kernelData) {
+    uint16_t numCols = grid.numCols,
+             numRows = grid.numRows,
+             *curField = getCurField16(grid),
+             *nextCell = getNextField16(grid),
+             *rowPtrs[3];
+    int32_t edgeIndex;
+
+    nbhd16.curField = curField;
+    nbhd16.numCols = numCols;
+    nbhd16.numRows = numRows;
+    nbhd16.kernelData = kernelData;
+
+    for( uint16_t row = 0; row < numRows; row++ ) {
+        for( uint8_t i = 0; i < 3; i++ ) {
+            edgeIndex = getEdgeIndex((int32_t)row + i - 1, numRows, edgeMode);
+            rowPtrs[i] = (edgeIndex < 0) ? nullptr : curField + edgeIndex * numCols;
+        }
+        nbhd16.row = row;
+
+        for( uint8_t j = 1; j < 3; j++ ) {
+            edgeIndex = getEdgeIndex(j - 2, numCols, edgeMode);
+            for( uint8_t i = 0; i < 3; i++ ) {
+                nbhd16.cells[i * 3 + j] = (rowPtrs[i] && edgeIndex >= 0) ? rowPtrs[i][edgeIndex] : edgeVal;
+            }
+        }
+
+        for( uint16_t col = 0; col < numCols; col++ ) {
+            for( uint8_t i = 0; i < 9; i += 3 ) {
+                nbhd16.cells[i] = nbhd16.cells[i + 1];
+                nbhd16.cells[i + 1] = nbhd16.cells[i + 2];
+            }
+
+            edgeIndex = col + 1;
+            if( edgeIndex >= numCols ) {
+                edgeIndex = getEdgeIndex(edgeIndex, numCols, edgeMode);
+            }
+            for( uint8_t i = 0; i < 3; i++ ) {
+                nbhd16.cells[i * 3 + 2] = (rowPtrs[i] && edgeIndex >= 0) ? rowPtrs[i][edgeIndex] : edgeVal;
+            }
+
+            nbhd16.col = col;
+            *nextCell = kernel(nbhd16);
+            nextCell++;
+        }
+    }
+    swapGrid16(grid);
+}
+
+//Draws the grid's current field onto the segment set, using the top 8 bits of each cell as its color's index in the LUT
+void gridUtilsPS::drawGrid16(SegmentSetPS &SegSet, cellGrid16PS &grid, CRGB *colorLut) {
+    uint16_t *curCell;
+    uint16_t numRows = min(grid.numRows, SegSet.numSegs),
+             numCols = min(grid.numCols, SegSet.numLines);
+
+    for( uint16_t row = 0; row < numRows; row++ ) {
+        curCell = getCurField16(grid) + (uint32_t)row * grid.numCols;
+        for( uint16_t col = 0; col < numCols; col++ ) {
+            pixelNum = segDrawUtils::getPixelNumFromLineNum(SegSet, row, col);
+            segDrawUtils::setPixelColor(SegSet, pixelNum, colorLut[curCell[col] >> 8], 0, 0, 0);
+        }
+    }
+}
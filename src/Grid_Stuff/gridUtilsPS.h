@@ -0,0 +1,99 @@
+#ifndef gridUtilsPS_h
+#define gridUtilsPS_h
+
+#include "FastLED.h"
+#include "cellGridPS.h"
+#include "Segment_Stuff/SegmentSetPS.h"
+#include "Segment_Stuff/segDrawUtils.h"
+#include "Palette_Stuff/paletteUtilsPS.h"
+#include "Memory_Stuff/memUtilsPS.h"
+#include "./Include_Lists/GlobalVars/GlobalVars.h"  //need alwaysResizeObj_PS
+
+/*
+Functions for running simulations over grids of cells (see cellGridPS.h).
+Rather than each simulation effect looping over its segment set and managing its own buffers, 
+it can store its state in a grid, and use these functions to run it.
+
+Running a Simulation Step:
+A simulation step is run by applying a "kernel" to every cell in the grid using applyKernel().
+A kernel is a function you write that takes a cell's 3x3 neighborhood (see cellNbhdPS in cellGridPS.h), 
+and returns the cell's new value, ie:
+    uint8_t myKernel(cellNbhdPS &nbhd) {
+        return (nbhd.cells[3] + nbhd.cells[5]) / 2; //Sets the cell to the average of its left and right neighbors
+    }
+You then run it using gridUtilsPS::applyKernel(grid, myKernel, edgeMode).
+applyKernel() slides the neighborhood along each row of the grid, so each cell only needs three new reads from the grid.
+
+The edge mode sets how the cells outside the grid are filled in for the neighborhoods of the edge cells:
+    0 -- The cells are set to the "edgeVal" passed into applyKernel() (defaults to 0).
+    1 -- The grid wraps, so the cells are taken from the opposite side of the grid.
+    2 -- The cells are copied from the nearest edge cell.
+
+There are a few pre-made kernels: 
+    blurKernel() -- Sets each cell to a weighted average of its neighborhood, spreading values out.
+    lifeKernel() -- Runs Conway's Game of Life, where cells with a value > 0 are "alive".
+
+Drawing a Grid:
+Grids are drawn using drawGrid(), which uses a 256 color look up table (LUT) to turn cell values into colors.
+You can fill a LUT with a palette gradient using fillGridLut(), or use any other table of 256 colors.
+16 bit grids are drawn using the top 8 bits of each cell.
+
+Kernels can also read cells outside their 3x3 neighborhood using the neighborhood's curField pointer (see cellGridPS.h).
+For example, Fire2012SL runs its fire on a grid, with its heat drift as a kernel that reads two cells back along each fire
+(see fire2012SegUtilsPS::diffuseHeatKernel()). Fire2012Seg doesn't use a grid, because its fires follow segments
+of different lengths, which don't fit a grid.
+*/
+namespace gridUtilsPS {
+
+    void  //Functions for managing grids
+        resizeGrid(cellGridPS &grid, uint16_t numCols, uint16_t numRows),
+        resizeGridToSegSet(cellGridPS &grid, SegmentSetPS &SegSet),
+        clearGrid(cellGridPS &grid, uint8_t val),
+        swapGrid(cellGridPS &grid),
+        setCell(cellGridPS &grid, uint16_t col, uint16_t row, uint8_t val);
+
+    uint8_t
+        getCell(cellGridPS &grid, uint16_t col, uint16_t row),
+        *getCurField(cellGridPS &grid),
+        *getNextField(cellGridPS &grid);
+
+    void  //Functions for running and drawing grids
+        applyKernel(cellGridPS &grid, uint8_t (*kernel)(cellNbhdPS &nbhd), uint8_t edgeMode),
+        applyKernel(cellGridPS &grid, uint8_t (*kernel)(cellNbhdPS &nbhd), uint8_t edgeMode, uint8_t edgeVal, void *kernelData),
+        drawGrid(SegmentSetPS &SegSet, cellGridPS &grid, CRGB *colorLut),
+        drawGrid(SegmentSetPS &SegSet, cellGridPS &grid, CRGB *colorLut, bool reverse),
+        fillGridLut(CRGB *colorLut, palettePS &palette, bool looped);
+
+    uint8_t  //Pre-made kernels
+        blurKernel(cellNbhdPS &nbhd),
+        lifeKernel(cellNbhdPS &nbhd);
+
+    void  //16 bit grid versions of the above functions
+        resizeGrid16(cellGrid16PS &grid, uint16_t numCols, uint16_t numRows),
+        resizeGrid16ToSegSet(cellGrid16PS &grid, SegmentSetPS &SegSet),
+        clearGrid16(cellGrid16PS &grid, uint16_t val),
+        swapGrid16(cellGrid16PS &grid),
+        setCell16(cellGrid16PS &grid, uint16_t col, uint16_t row, uint16_t val),
+        applyKernel16(cellGrid16PS &grid, uint16_t (*kernel)(cellNbhd16PS &nbhd), uint8_t edgeMode, uint16_t edgeVal, void *kernelData),
+        drawGrid16(SegmentSetPS &SegSet, cellGrid16PS &grid, CRGB *colorLut);
+
+    uint16_t
+        getCell16(cellGrid16PS &grid, uint16_t col, uint16_t row),
+        *getCurField16(cellGrid16PS &grid),
+        *getNextField16(cellGrid16PS &grid);
+
+    int32_t  //Helper function for applyKernel() (you shouldn't need to call this)
+        getEdgeIndex(int32_t index, uint16_t length, uint8_t edgeMode);
+
+    //pre-allocated space for function variables
+    static cellNbhdPS
+        nbhd;
+
+    static cellNbhd16PS
+        nbhd16;
+
+    static uint16_t
+        pixelNum;
+};
+
+#endif
@@ -0,0 +1,4 @@
+#include "./Audio_Stuff/audioSourcePS.h"
+#include "./Audio_Stuff/audioFFTPS.h"
+#include "./Audio_Stuff/audioSlotPS.h"
+#include "./Audio_Stuff/audioUtilsPS.h"
\ No newline at end of file
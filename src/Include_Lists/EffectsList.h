@@ -54,4 +54,5 @@
 #include "Effects/ColorWipeSeg/ColorWipeSeg.h"
 #include "Effects/ColorModeFill/ColorModeFillPS.h"
 #include "Effects/DrawPatternSLSeg/DrawPatternSLSeg.h"
-#include "Effects/XmasLightsSLSeg/XmasLightsSLSeg.h"
\ No newline at end of file
+#include "Effects/XmasLightsSLSeg/XmasLightsSLSeg.h"
+#include "Effects/FramePlayerPS/FramePlayerPS.h"
\ No newline at end of file
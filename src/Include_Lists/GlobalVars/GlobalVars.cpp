@@ -1,3 +1,8 @@
 #include "GlobalVars.h"
+#include "../../Memory_Stuff/memStatsPS.h"
 
-bool alwaysResizeObj_PS = false;
\ No newline at end of file
+bool alwaysResizeObj_PS = false;
+
+memArenaPS *arena_PS = nullptr;
+
+memStatsPS memStats_PS = {0};
\ No newline at end of file
@@ -46,4 +46,21 @@ Changing alwaysResizeObj_PS will effect:
     this includes things like patterns, particleSets, etc
 */
 
+struct memArenaPS;
+extern memArenaPS *arena_PS;  //defaulted to nullptr in GlobalVars.cpp
+/*
+A pointer to the library's memory arena (see memArenaPS.h in Memory_Stuff).
+If set, and the arena is active, effects will allocate their buffers (and themselves, if created using new)
+from the arena instead of the heap, avoiding heap fragmentation.
+You set it using memUtilsPS::setupArena().
+By default it is null, so all effects use the heap like normal.
+*/
+
+struct memStatsPS;
+extern memStatsPS memStats_PS;  //zeroed in GlobalVars.cpp
+/*
+The library's heap memory usage stats, updated whenever the library allocates or frees memory
+(see memStatsPS.h in Memory_Stuff). Tracking is off by default, so the stats will stay at 0 unless you turn it on.
+*/
+
 #endif
\ No newline at end of file
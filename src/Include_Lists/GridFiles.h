@@ -0,0 +1,2 @@
+#include "./Grid_Stuff/cellGridPS.h"
+#include "./Grid_Stuff/gridUtilsPS.h"
@@ -0,0 +1,2 @@
+#include "./Mailbox_Stuff/paramMailboxPS.h"
+#include "./Mailbox_Stuff/mailboxUtilsPS.h"
\ No newline at end of file
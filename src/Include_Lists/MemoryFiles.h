@@ -0,0 +1,3 @@
+#include "./Memory_Stuff/memArenaPS.h"
+#include "./Memory_Stuff/memStatsPS.h"
+#include "./Memory_Stuff/memUtilsPS.h"
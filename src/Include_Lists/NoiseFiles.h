@@ -0,0 +1,4 @@
+#include "./Noise_Stuff/noiseRowPS.h"
+#include "./Noise_Stuff/noiseFieldPS.h"
+#include "./Noise_Stuff/noiseKeyframesPS.h"
+#include "./Noise_Stuff/noiseUtilsPS.h"
\ No newline at end of file
@@ -0,0 +1,3 @@
+#include "./Random_Stuff/randStreamPS.h"
+#include "./Random_Stuff/randPermPS.h"
+#include "./Random_Stuff/randUtilsPS.h"
\ No newline at end of file
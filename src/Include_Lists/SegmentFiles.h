@@ -2,4 +2,7 @@
 #include "./Segment_Stuff/SegmentPS.h"
 #include "./Segment_Stuff/SegmentSetPS.h"
 #include "./Segment_Stuff/segDrawUtils.h"
-#include "./Segment_Stuff/pixelInfoPS.h"
\ No newline at end of file
+#include "./Segment_Stuff/pixelInfoPS.h"
+#include "./Segment_Stuff/lineColorsPS.h"
+#include "./Segment_Stuff/segLayoutPS.h"
+#include "./Segment_Stuff/bgCachePS.h"
\ No newline at end of file
@@ -15,4 +15,6 @@
 #include "UtilEffects/AddGlitter/addGlitterPS.h"
 #include "UtilEffects/PaletteSlider/PaletteSliderPS.h"
 #include "UtilEffects/PaletteNoise/PaletteNoisePS.h"
-#include "UtilEffects/RateNoise/RateNoisePS.h"
\ No newline at end of file
+#include "UtilEffects/RateNoise/RateNoisePS.h"
+#include "UtilEffects/AudioAnalyzer/AudioAnalyzerPS.h"
+#include "UtilEffects/Playlist/PlaylistPS.h"
\ No newline at end of file
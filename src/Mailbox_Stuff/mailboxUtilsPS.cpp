@@ -0,0 +1,85 @@
+#include "mailboxUtilsPS.h"
+
+using namespace mailboxUtilsPS;
+
+//Writes a parameter to the mailbox, but doesn't post it (see postParams())
+//dest is the address of the parameter, and value is the address of its new value, which is copied into the mailbox
+//Returns false if the mailbox is full (or the parameter is too large), in which case the parameter is dropped
+//and the group it's part of has failed, so the rest of the group is also dropped (see postParams())
+bool mailboxUtilsPS::writeParam(paramMailboxPS &mailbox, void *dest, const void *value, uint8_t size) {
+    uint8_t nextPos = addmod8(mailbox.writePos, 1, mailbox.length);
+    //If the next position is the tail, then the mailbox is full
+    if( mailbox.groupFailed || size > PARAM_MSG_MAX_SIZE_PS || nextPos == mailbox.tail ) {
+        mailbox.dropped++;
+        mailbox.groupFailed = true;
+        return false;
+    }
+
+    paramMsgPS &msg = mailbox.msgArr[mailbox.writePos];
+    msg.dest = dest;
+    msg.size = size;
+    memcpy(msg.data, value, size);
+
+    mailbox.writePos = nextPos;
+    return true;
+}
+
+//Writes a parameter to the mailbox and posts it right away
+//(along with any other written parameters)
+//Returns false if the parameter (or any of the other written parameters) was dropped, in which case nothing is posted
+bool mailboxUtilsPS::setParam(paramMailboxPS &mailbox, void *dest, const void *value, uint8_t size) {
+    writeParam(mailbox, dest, value, size);
+    return postParams(mailbox);
+}
+
+//Posts all the written parameters, so they will be applied by the reader
+//The barrier makes sure the messages are fully written before the reader can see them
+//If any of the parameters were dropped, the group has failed, so we throw it out instead of posting part of it
+//Returns true if the group was posted, or false if it was thrown out
+bool mailboxUtilsPS::postParams(paramMailboxPS &mailbox) {
+    if( mailbox.groupFailed ) {
+        cancelParams(mailbox);
+        return false;
+    }
+
+    MAILBOX_BARRIER_PS();
+    mailbox.head = mailbox.writePos;
+    return true;
+}
+
+//Throws out any parameters that have been written, but not posted, and starts a new group
+void mailboxUtilsPS::cancelParams(paramMailboxPS &mailbox) {
+    mailbox.writePos = mailbox.head;
+    mailbox.groupFailed = false;
+}
+
+//Applies all the posted parameters, copying their values into place, returns how many were applied
+//We only apply the messages posted when we start, so a busy writer can't hold up the reader
+//The messages are only freed (by moving the tail) once they've been applied
+uint8_t mailboxUtilsPS::applyParams(paramMailboxPS &mailbox) {
+    uint8_t head = mailbox.head;
+    uint8_t tail = mailbox.tail;
+    uint8_t count = 0;
+    MAILBOX_BARRIER_PS();
+
+    while( tail != head ) {
+        paramMsgPS &msg = mailbox.msgArr[tail];
+        memcpy(msg.dest, msg.data, msg.size);
+        tail = addmod8(tail, 1, mailbox.length);
+        count++;
+    }
+
+    MAILBOX_BARRIER_PS();
+    mailbox.tail = tail;
+    return count;
+}
+
+//Returns the number of posted messages waiting to be applied
+uint8_t mailboxUtilsPS::getNumPosted(paramMailboxPS &mailbox) {
+    uint8_t head = mailbox.head;
+    uint8_t tail = mailbox.tail;
+    if( head >= tail ) {
+        return head - tail;
+    }
+    return mailbox.length - tail + head;
+}
@@ -0,0 +1,69 @@
+#ifndef mailboxUtilsPS_h
+#define mailboxUtilsPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "FastLED.h"
+#include "paramMailboxPS.h"
+
+//Memory barrier between writing the messages and posting/freeing them
+//AVR chips only have one core, so we only need to stop the compiler from re-ordering things
+#ifdef __AVR__
+    #define MAILBOX_BARRIER_PS() asm volatile("" ::: "memory")
+#else
+    #define MAILBOX_BARRIER_PS() __sync_synchronize()
+#endif
+
+//Writes a new value for a parameter to a mailbox, copying the value using the parameter's own type
+//ie writeParamPS(mailbox, twinkle->bgColorOrig, CRGB::Blue);
+//or for pointer-bound settings, writeParamPS(mailbox, *twinkle->rate, 40);
+#define writeParamPS(mailbox, param, value) ({                                                    \
+    __typeof__(param) paramTemp_PS = (value);                                                      \
+    (mailboxUtilsPS::writeParam((mailbox), (void *)&(param), &paramTemp_PS, sizeof(paramTemp_PS))); \
+})
+
+/*
+Functions for writing to, and applying parameter mailboxes (see paramMailboxPS.h).
+
+Changes are sent in two steps: first you write one or more parameters, then you post them.
+Posted changes are applied together, so if you have a group of settings that should change at once,
+write them all before posting:
+    //<On the other thread/core>
+    writeParamPS(mailbox, *twinkle->rate, 40);
+    writeParamPS(mailbox, twinkle->bgColorOrig, CRGB::Blue);
+    mailboxUtilsPS::postParams(mailbox);
+
+    //<On the effect thread/core>
+    effectSet.mailbox = &mailbox; //The effect set will apply the changes at the start of its update()
+
+If the mailbox is full, writeParam() returns false, and the parameter is dropped.
+Once a parameter in a group has been dropped, the whole group has failed, so any more writes to it are also dropped,
+and postParams() throws out the group instead of posting it, returning false. So the effects never see part of a group.
+You can then write the group again later (once the reader has made space).
+You can also call cancelParams() to throw out an un-posted group yourself.
+Note that when writing to a pointer-bound setting (like *rate) the pointer is read when you write the parameter,
+so if you change what the pointer is bound to, do it through the mailbox as well.
+*/
+namespace mailboxUtilsPS {
+
+    bool  //Functions for the writer
+        writeParam(paramMailboxPS &mailbox, void *dest, const void *value, uint8_t size),
+        setParam(paramMailboxPS &mailbox, void *dest, const void *value, uint8_t size),
+        postParams(paramMailboxPS &mailbox);
+
+    void
+        cancelParams(paramMailboxPS &mailbox);
+
+    uint8_t  //Functions for the reader
+        applyParams(paramMailboxPS &mailbox),
+        getNumPosted(paramMailboxPS &mailbox);
+
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef paramMailboxPS_h
+#define paramMailboxPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+//The largest parameter (in bytes) that can be sent through a mailbox
+//8 bytes covers all the effect settings, colors, and pointers (even on 64 bit systems)
+#ifndef PARAM_MSG_MAX_SIZE_PS
+    #define PARAM_MSG_MAX_SIZE_PS 8
+#endif
+
+/*
+Structs for a parameter "mailbox", used to safely change effect settings from another thread, core, or interrupt.
+
+If you're receiving settings from somewhere else (like over WiFi on a second ESP32 core) and write them
+straight into an effect, the effect may be in the middle of drawing, so it may see a half-written value
+(like a CRGB color with a new red, but an old green and blue), or see some of a group of changes, but not others.
+Instead, you can post the changes to a mailbox, which an EffectSetPS will apply between updates,
+so the effects always see a complete set of changes (see EffectSetPS.h).
+
+The mailbox is a ring buffer of parameter messages, each holding where a parameter lives, and its new value.
+It is "lock-free" with a single writer (producer) and a single reader (consumer),
+so the writer never has to wait on the effects, and vice versa.
+!!Only one thread/core should write to a mailbox, and only one should apply it (usually the EffectSetPS).
+
+You make a mailbox by giving it an array of messages, which sets how many changes can be waiting at once:
+    paramMsgPS msgArr[16];
+    paramMailboxPS mailbox = {msgArr, SIZE(msgArr)}; //the other struct vars will be set to 0
+
+One slot in the array is always left free, so the mailbox above holds up to 15 messages.
+See mailboxUtilsPS.h for writing to, and applying the mailbox.
+*/
+struct paramMsgPS {
+    void *dest;                            //the address of the parameter
+    uint8_t size;                          //the size of the parameter (bytes)
+    uint8_t data[PARAM_MSG_MAX_SIZE_PS];  //the parameter's new value
+};
+
+struct paramMailboxPS {
+    paramMsgPS *msgArr;      //the message array
+    uint8_t length;          //the length of the message array
+    volatile uint8_t head;   //the end of the posted messages, only changed by the writer
+    volatile uint8_t tail;   //the start of the messages waiting to be applied, only changed by the reader
+    uint8_t writePos;        //the end of the written, but not yet posted messages, only used by the writer
+    uint16_t dropped;        //the number of messages that didn't fit in the mailbox, for reference
+    bool groupFailed;        //true if a message in the written (un-posted) group was dropped, only used by the writer
+};
+
+#endif
@@ -39,4 +39,12 @@ uint16_t qSubD_PS(uint16_t x, uint16_t y) {
 //See note in .h file
 uint16_t qSubA_PS(uint16_t x, uint16_t y) {
     return ((x > y) ? x - y : 0);
+}
+
+//See note in .h file
+uint8_t countBits32PS(uint32_t num) {
+    num = num - ((num >> 1) & 0x55555555);
+    num = (num & 0x33333333) + ((num >> 2) & 0x33333333);
+    num = (num + (num >> 4)) & 0x0F0F0F0F;
+    return (num * 0x01010101) >> 24;
 }
\ No newline at end of file
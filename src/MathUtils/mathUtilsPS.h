@@ -51,4 +51,8 @@ uint16_t qSubD_PS(uint16_t x, uint16_t y);
 //For unsigned 8 or 16 bit numbers.
 uint16_t qSubA_PS(uint16_t x, uint16_t y);
 
+//Returns the number of set bits (1's) in a 32 bit number
+//Counts the bits in parallel (no looping), so it's quick for bit arrays
+uint8_t countBits32PS(uint32_t num);
+
 #endif
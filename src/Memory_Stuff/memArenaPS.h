@@ -0,0 +1,83 @@
+#ifndef memArenaPS_h
+#define memArenaPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+//The byte alignment of arena allocations.
+//AVR chips have no alignment requirements, so we don't waste any space on them
+#ifdef __AVR__
+    #define ARENA_ALIGN_PS 1
+#else
+    #define ARENA_ALIGN_PS 8
+#endif
+
+/*
+A struct for a memory arena, a single block of memory that effects can allocate their buffers from.
+Normally, effects allocate their buffers (heat arrays, particle sets, etc) on the heap using malloc().
+If you're creating and destroying effects over a long period of time (like cycling through effects for weeks),
+the heap can become fragmented, leaving lots of small gaps that are too small to use, and eventually causing a crash.
+alwaysResizeObj_PS helps with this, but doesn't fully prevent it.
+
+An arena avoids fragmentation completely. Allocations are taken one after another from the front of the arena ("bump allocation"),
+and are never freed individually. Instead, you record a "mark" of where the arena is filled to before creating a group of effects,
+and then release the arena back to the mark once you're done with the effects. This frees all of the effects' memory at once,
+leaving the arena exactly as it was before, with no gaps.
+
+Using an arena (see memUtilsPS.h for the functions):
+    //<Before Arduino setup()>
+    uint8_t arenaBuffer[4000]; //the memory for the arena, you can also malloc() it once at the start of your code
+    memArenaPS arena = {nullptr}; //Must init structs w/ pointers set to null for safety
+
+    //<In Arduino setup()>
+    memUtilsPS::setupArena(arena, arenaBuffer, SIZE(arenaBuffer)); //Sets up the arena, and sets it as the library arena
+
+    //<When creating a group of effects>
+    uint32_t mark = memUtilsPS::getArenaMark(arena);
+    arena.active = true; //Effect memory will now come from the arena
+    StreamerSL *strem = new StreamerSL(...);
+    arena.active = false; //Stop using the arena, so other allocations go back on the heap
+
+    //<When you're done with the effects>
+    delete strem;
+    memUtilsPS::releaseArena(arena, mark); //All the memory allocated since the mark is freed
+
+Effect sets have functions for opening and releasing arena "scopes" that do the above for you,
+see EffectSetPS.h for more.
+
+Only effects created using `new` (and their buffers) are placed in the arena.
+Effects that are created as normal variables still allocate their buffers from the arena if it's active,
+but are not themselves in the arena.
+
+Notes:
+    * If the arena runs out of space, allocations fall back to the heap (using malloc()), so nothing will break,
+      but you should make the arena large enough for your largest group of effects.
+    * Palettes and patterns made by the library (ie using paletteUtilsPS::makeRandomPalette()) also use allocPS(),
+      so if you make them while the arena is active they are placed in the arena. 
+      Always free them using memUtilsPS::freePS(), never free(), since free() can't be used on arena memory.
+    * Arena memory is only freed when the arena is released, with one exception: 
+      freeing the most recent arena allocation returns its space to the arena straight away.
+      So if an effect re-sizes its newest buffer (ie changing the number of drops in RainSL) the space is re-used,
+      but re-sizing any older buffer leaves the old buffer's memory unused until the arena is released.
+    * The arena should only be active while you're creating effects. 
+      Any object that allocates memory while the arena is active will have it placed in the arena, 
+      even if the object was created before the mark, so its memory would be freed early when the arena is released.
+      (Effect sets suspend the arena while updating their effects for this reason, see EffectSetPS.h)
+    * !!Make sure you've destructed all effects using the arena memory past a mark before releasing it,
+      otherwise they'll be using memory that will be given to other effects.
+*/
+struct memArenaPS {
+    uint8_t *buffer;  //pointer to the arena memory
+    uint32_t size;    //the total size of the arena (bytes)
+    uint32_t used;    //how much of the arena has been allocated (bytes), this is also the "mark" of the arena's current fill
+    uint32_t peak;    //the most the arena has been filled (bytes), useful for working out how large the arena needs to be
+    uint32_t lastStart; //the start of the most recent allocation, so that it can be returned to the arena if it is freed
+    bool active;      //If true, effects will allocate their memory from the arena (see memUtilsPS::allocPS())
+};
+
+#endif
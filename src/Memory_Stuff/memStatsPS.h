@@ -0,0 +1,71 @@
+#ifndef memStatsPS_h
+#define memStatsPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+The maximum number of live heap allocations the memory tracker can follow (see memStatsPS below).
+Setting this to 0 (the default) turns tracking off completely, so allocPS() and freePS() have no extra overhead.
+Each tracked allocation takes a pointer and a size_t of memory (4 bytes on AVR, 8 on most 32 bit chips), 
+so only turn it on while you're budgeting your memory.
+
+To turn tracking on, the value must be set when the library is compiled, 
+so a "#define MEM_TRACK_SIZE_PS 64" in your sketch WON'T work (the library's .cpp files are compiled separately).
+Instead, either:
+    * Change the value below directly (in the library's copy of this file).
+    * Add it as a build flag:
+        Arduino IDE: Create a "platform.local.txt" file next to your board core's "platform.txt" containing:
+                     compiler.cpp.extra_flags=-DMEM_TRACK_SIZE_PS=64
+                     (delete it, or the line, when you're done, since it applies to every sketch using the core)
+        Arduino CLI: arduino-cli compile --build-property "compiler.cpp.extra_flags=-DMEM_TRACK_SIZE_PS=64" ...
+        PlatformIO:  build_flags = -DMEM_TRACK_SIZE_PS=64 (in platformio.ini) */
+#ifndef MEM_TRACK_SIZE_PS
+    #define MEM_TRACK_SIZE_PS 0
+#endif
+
+/*
+A struct for tracking the library's heap memory usage.
+The library keeps one instance of the struct, memStats_PS, which is updated by memUtilsPS::allocPS() and freePS().
+All of the library's dynamic memory (effect buffers, particle sets, palettes, patterns, noise keyframes, etc) 
+goes through allocPS() and freePS(), so it is all counted.
+Memory taken from a memory arena isn't counted here, use the arena's "used" and "peak" instead (see memArenaPS.h).
+
+!!Tracking is off by default, see MEM_TRACK_SIZE_PS above to turn it on. 
+If it's off, all the stats will stay at 0.
+
+Measuring an Effect's Memory:
+You can measure how much memory an effect (or utility) uses by checking the library's memory use before and after creating it:
+    uint32_t memBefore = memUtilsPS::getMemUsed();
+    StreamerSL *strem = new StreamerSL(...);
+    uint32_t stremMem = memUtilsPS::getMemUsed() - memBefore; //The memory used by the effect (including itself)
+This includes any palettes/patterns the effect creates for itself, but not ones you've passed into it.
+Note that it only covers the memory the effect uses when it's created. Some effects re-size their buffers later 
+(ie if you change their segment set, or their number of particles), which you can measure in the same way.
+The stats can't tell you an effect's memory use before you create it, or which effect owns which allocation, 
+so to budget memory, measure each effect once with your inputs (on a test board, or with the same segment set).
+
+Checking Fragmentation:
+The stats only cover the library's memory. To see how much memory is actually free on your board, 
+and how fragmented it is, use memUtilsPS::getFreeHeap(), getLargestFreeBlock() and getHeapFragmentation().
+
+Notes:
+    * If you have more live allocations than MEM_TRACK_SIZE_PS, the extra allocations are counted in "untracked", 
+      and their bytes are not included in the byte counts. Increase MEM_TRACK_SIZE_PS if this happens.
+    * Memory allocated outside of allocPS() (ie using malloc() yourself) is ignored, even if it is freed using freePS(). */
+struct memStatsPS {
+    uint32_t curBytes;   //The bytes currently allocated on the heap by the library
+    uint32_t peakBytes;  //The largest curBytes has been since the stats were reset (see memUtilsPS::resetMemStats())
+    uint32_t numAllocs;  //The total number of heap allocations made
+    uint32_t numFrees;   //The total number of tracked heap allocations freed
+    uint16_t numLive;    //The number of tracked heap allocations that have not yet been freed
+    uint16_t untracked;  //The number of allocations that couldn't be tracked because the tracking table was full
+    uint16_t failed;     //The number of allocations that failed (malloc() returned null, ie out of memory)
+};
+
+#endif
@@ -0,0 +1,242 @@
+#include "memUtilsPS.h"
+
+#if MEM_TRACK_SIZE_PS > 0
+//The table of live tracked heap allocations, used to look up an allocation's size when it is freed
+//Empty slots have a null pointer
+static void *trackPtrs[MEM_TRACK_SIZE_PS];
+static size_t trackSizes[MEM_TRACK_SIZE_PS];
+#endif
+
+#ifdef __AVR__
+//avr-libc's heap variables, used to walk the heap's free list
+struct __freelist {
+    size_t sz;
+    struct __freelist *nx;
+};
+extern char *__brkval;
+extern char __heap_start;
+extern struct __freelist *__flp;
+#endif
+
+//Sets up an arena using the passed in buffer and size (bytes), and sets it as the library arena (arena_PS)
+//The arena starts empty and inactive (see memArenaPS.h)
+void memUtilsPS::setupArena(memArenaPS &arena, uint8_t *buffer, uint32_t size) {
+    arena.buffer = buffer;
+    arena.size = size;
+    arena.active = false;
+    arena.peak = 0;
+    resetArena(arena);
+    arena_PS = &arena;
+}
+
+//Frees all the memory in the arena
+//!!Make sure nothing is using the arena memory before calling
+void memUtilsPS::resetArena(memArenaPS &arena) {
+    arena.used = 0;
+    arena.lastStart = 0;
+}
+
+//Frees all the arena memory allocated after the passed in mark (see getArenaMark())
+//!!Make sure nothing is using the arena memory past the mark before calling
+void memUtilsPS::releaseArena(memArenaPS &arena, uint32_t mark) {
+    if( mark < arena.used ) {
+        arena.used = mark;
+        //The most recent allocation may have been released, so we can no longer return it (see freePS())
+        arena.lastStart = mark;
+    }
+}
+
+//Returns the current fill point of the arena, so that anything allocated after it can be released using releaseArena()
+uint32_t memUtilsPS::getArenaMark(memArenaPS &arena) {
+    return arena.used;
+}
+
+//Returns how many bytes are left in the arena
+uint32_t memUtilsPS::getArenaFree(memArenaPS &arena) {
+    return arena.size - arena.used;
+}
+
+//Returns true if the passed in pointer is within the arena's memory
+bool memUtilsPS::inArena(memArenaPS &arena, void *ptr) {
+    return arena.buffer && (uint8_t *)ptr >= arena.buffer && (uint8_t *)ptr < (arena.buffer + arena.size);
+}
+
+//Allocates memory of the passed in size (bytes) from the front of the arena, returning a pointer to it
+//The allocation is aligned to ARENA_ALIGN_PS bytes
+//Returns nullptr if there isn't enough space left in the arena
+void *memUtilsPS::arenaAlloc(memArenaPS &arena, size_t size) {
+    //Align the allocation start, we align the actual memory address in case the buffer itself isn't aligned
+    uint32_t start = arena.used;
+    uint8_t misalign = ((uintptr_t)(arena.buffer + start)) % ARENA_ALIGN_PS;
+    if( misalign ) {
+        start += ARENA_ALIGN_PS - misalign;
+    }
+
+    if( start > arena.size || size > (arena.size - start) ) {
+        return nullptr;
+    }
+
+    arena.lastStart = start;
+    arena.used = start + size;
+    if( arena.used > arena.peak ) {
+        arena.peak = arena.used;
+    }
+    return arena.buffer + start;
+}
+
+//Allocates memory for an effect of the passed in size (bytes)
+//If the library arena (arena_PS) is set and active, the memory is taken from the arena,
+//otherwise (or if the arena is full), it is allocated using malloc()
+//!!Memory from allocPS() must be freed using freePS()
+void *memUtilsPS::allocPS(size_t size) {
+    if( arena_PS && arena_PS->active ) {
+        void *ptr = arenaAlloc(*arena_PS, size);
+        if( ptr ) {
+            return ptr;
+        }
+    }
+    void *ptr = malloc(size);
+#if MEM_TRACK_SIZE_PS > 0
+    trackAlloc(ptr, size);
+#endif
+    return ptr;
+}
+
+//Frees memory allocated using allocPS()
+//Memory in the library arena is only freed when the arena is released, so we only free() memory that isn't in the arena
+//The exception is the most recent arena allocation, which we can return to the arena by moving the fill point back to its start
+//(so freeing and then re-allocating the newest buffer, like when an effect re-sizes it, re-uses its arena space)
+void memUtilsPS::freePS(void *ptr) {
+    if( arena_PS && inArena(*arena_PS, ptr) ) {
+        uint32_t start = (uint8_t *)ptr - arena_PS->buffer;
+        if( start == arena_PS->lastStart && start < arena_PS->used ) {
+            arena_PS->used = start;
+        }
+        return;
+    }
+#if MEM_TRACK_SIZE_PS > 0
+    trackFree(ptr);
+#endif
+    free(ptr);
+}
+
+#if MEM_TRACK_SIZE_PS > 0
+//Records a heap allocation in memStats_PS, adding it to the tracking table so its size can be found when it's freed
+//If the table is full, the allocation is counted as "untracked"
+void memUtilsPS::trackAlloc(void *ptr, size_t size) {
+    if( !ptr ) {
+        memStats_PS.failed++;
+        return;
+    }
+
+    memStats_PS.numAllocs++;
+    for( uint16_t i = 0; i < MEM_TRACK_SIZE_PS; i++ ) {
+        if( !trackPtrs[i] ) {
+            trackPtrs[i] = ptr;
+            trackSizes[i] = size;
+            memStats_PS.numLive++;
+            memStats_PS.curBytes += size;
+            if( memStats_PS.curBytes > memStats_PS.peakBytes ) {
+                memStats_PS.peakBytes = memStats_PS.curBytes;
+            }
+            return;
+        }
+    }
+    memStats_PS.untracked++;
+}
+
+//Removes a heap allocation from the tracking table, recording it in memStats_PS
+//Pointers that aren't in the table (untracked or allocated outside the library) are ignored
+void memUtilsPS::trackFree(void *ptr) {
+    if( !ptr ) {
+        return;
+    }
+
+    for( uint16_t i = 0; i < MEM_TRACK_SIZE_PS; i++ ) {
+        if( trackPtrs[i] == ptr ) {
+            trackPtrs[i] = nullptr;
+            memStats_PS.numLive--;
+            memStats_PS.numFrees++;
+            memStats_PS.curBytes -= trackSizes[i];
+            return;
+        }
+    }
+}
+#endif
+
+//Resets the memory stats counts, and sets the peak bytes to the current bytes
+//Live allocations are still tracked, so curBytes and numLive are not changed
+void memUtilsPS::resetMemStats(void) {
+    memStats_PS.peakBytes = memStats_PS.curBytes;
+    memStats_PS.numAllocs = 0;
+    memStats_PS.numFrees = 0;
+    memStats_PS.untracked = 0;
+    memStats_PS.failed = 0;
+}
+
+//Returns the total bytes of memory currently used by the library,
+//ie the tracked heap bytes plus the used bytes of the library arena (if it has been setup)
+//Note that the heap bytes will be 0 if tracking is turned off (see memStatsPS.h)
+uint32_t memUtilsPS::getMemUsed(void) {
+    uint32_t used = memStats_PS.curBytes;
+    if( arena_PS ) {
+        used += arena_PS->used;
+    }
+    return used;
+}
+
+//Returns the total free heap memory of the board (bytes)
+//This includes memory in the gaps between allocations, which may not be usable (see getLargestFreeBlock())
+//Only works on AVR, ESP8266, and ESP32 chips, returns 0 on others
+uint32_t memUtilsPS::getFreeHeap(void) {
+#if defined(__AVR__)
+    //The gap between the top of the heap and the stack, plus all the freed chunks in the heap
+    char stackTop;
+    char *heapEnd = __brkval ? __brkval : &__heap_start;
+    uint32_t freeMem = &stackTop - heapEnd;
+    for( struct __freelist *chunk = __flp; chunk; chunk = chunk->nx ) {
+        freeMem += chunk->sz;
+    }
+    return freeMem;
+#elif defined(ESP32) || defined(ESP8266)
+    return ESP.getFreeHeap();
+#else
+    return 0;
+#endif
+}
+
+//Returns the size of the largest single block of free heap memory (bytes),
+//ie the largest allocation that can currently be made
+//Only works on AVR, ESP8266, and ESP32 chips, returns 0 on others
+uint32_t memUtilsPS::getLargestFreeBlock(void) {
+#if defined(__AVR__)
+    //The largest block is either the gap between the heap and the stack, or the largest freed chunk in the heap
+    char stackTop;
+    char *heapEnd = __brkval ? __brkval : &__heap_start;
+    uint32_t largest = &stackTop - heapEnd;
+    for( struct __freelist *chunk = __flp; chunk; chunk = chunk->nx ) {
+        if( chunk->sz > largest ) {
+            largest = chunk->sz;
+        }
+    }
+    return largest;
+#elif defined(ESP32)
+    return ESP.getMaxAllocHeap();
+#elif defined(ESP8266)
+    return ESP.getMaxFreeBlockSize();
+#else
+    return 0;
+#endif
+}
+
+//Returns how fragmented the heap is, as a percent (0 - 100)
+//0 means all the free memory is in one block, while values near 100 mean the free memory is spread across many small gaps,
+//so large allocations may fail even if there's enough total free memory
+//Returns 0 on chips where the heap can't be read (see getFreeHeap())
+uint8_t memUtilsPS::getHeapFragmentation(void) {
+    uint32_t freeMem = getFreeHeap();
+    if( freeMem == 0 ) {
+        return 0;
+    }
+    return 100 - (getLargestFreeBlock() * 100) / freeMem;
+}
@@ -0,0 +1,65 @@
+#ifndef memUtilsPS_h
+#define memUtilsPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "memArenaPS.h"
+#include "memStatsPS.h"
+#include "./Include_Lists/GlobalVars/GlobalVars.h"  //need arena_PS and memStats_PS
+
+/*
+Functions for allocating effect memory, and for working with memory arenas (see memArenaPS.h).
+Effects use allocPS() and freePS() in place of malloc() and free() for their buffers.
+If the library arena (arena_PS, set using setupArena()) is active, allocPS() takes memory from the arena,
+otherwise it uses malloc() like normal. freePS() only calls free() if the memory isn't in the arena.
+
+There are also functions for reporting memory use. allocPS() and freePS() record the library's heap use in memStats_PS
+(if tracking is turned on, see memStatsPS.h), and getFreeHeap(), getLargestFreeBlock(), and getHeapFragmentation()
+report on the board's heap as a whole (on AVR, ESP8266, and ESP32 chips only, they return 0 on other chips).
+*/
+namespace memUtilsPS {
+
+    void  //Functions for memory arenas
+        setupArena(memArenaPS &arena, uint8_t *buffer, uint32_t size),
+        resetArena(memArenaPS &arena),
+        releaseArena(memArenaPS &arena, uint32_t mark);
+
+    void
+        *arenaAlloc(memArenaPS &arena, size_t size);
+
+    uint32_t
+        getArenaMark(memArenaPS &arena),
+        getArenaFree(memArenaPS &arena);
+
+    bool
+        inArena(memArenaPS &arena, void *ptr);
+
+    void  //Functions for effect memory
+        *allocPS(size_t size),
+        freePS(void *ptr);
+
+    void  //Functions for memory reporting
+        resetMemStats(void);
+
+    uint32_t
+        getMemUsed(void),
+        getFreeHeap(void),
+        getLargestFreeBlock(void);
+
+    uint8_t
+        getHeapFragmentation(void);
+
+#if MEM_TRACK_SIZE_PS > 0
+    void  //Functions for the memory tracker (you shouldn't need to call these)
+        trackAlloc(void *ptr, size_t size),
+        trackFree(void *ptr);
+#endif
+};
+
+#endif
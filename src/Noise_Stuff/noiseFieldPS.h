@@ -0,0 +1,52 @@
+#ifndef noiseFieldPS_h
+#define noiseFieldPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for holding a 1D or 2D buffer of 8 bit noise values, so that multiple effects can share the same noise.
+Like patterns, the buffer is a pointer to an array, with a maxLength for memory management.
+The buffer is laid out row by row, ie for a field with 10 columns, the first 10 entries are row 0, the next 10 are row 1, etc.
+A 1D field is just a field with one row.
+
+Noise fields are filled in one pass using noiseUtilsPS::fillNoiseField8(), which walks each row
+using a noiseRowPS, reusing the noise lattice across the row (see noiseRowPS.h).
+The noise is the same as inoise8(x + col * xStep, y + row * yStep, z) for each column and row.
+
+The field also records the inputs of its last fill.
+If fillNoiseField8() is called again with the same inputs, the field is not re-calculated.
+This lets multiple effects share a single noise field each update cycle,
+with only the first effect to update paying for the noise.
+(For example, NoiseSL has a noiseField setting, see NoiseSL.h)
+
+Example field:
+    noiseFieldPS noiseField = {}; //Must init structs w/ pointers set to null for safety
+    noiseUtilsPS::resizeNoiseField(noiseField, 60, 4); //Creates a field with 60 columns and 4 rows
+    //Fill the field starting at (0, 0), with 30 steps between each row and column sample, at time millis()/10
+    noiseUtilsPS::fillNoiseField8(noiseField, 0, 30, 0, 30, millis() / 10);
+    uint8_t noiseVal = noiseField.getNoise(5, 2); //get the noise value at column 5, row 2
+
+!!Fields are created dynamically, so make sure you free the noiseArr when you're done by calling memUtilsPS::freePS(noiseField.noiseArr). */
+struct noiseFieldPS {
+    uint8_t *noiseArr;   //pointer to the noise array
+    uint16_t numCols;    //the number of noise samples in each row (the x direction)
+    uint16_t numRows;    //the number of rows (the y direction)
+    uint16_t maxLength;  //The total length of the noiseArr, used for memory management (see patternPS for more)
+
+    //The inputs of the last fill, so the field can be shared (set automatically)
+    uint16_t x, xStep, y, yStep, z;
+    bool filled;  //false if the field needs to be re-filled no matter what
+
+    //Returns the noise value at the passed in column and row
+    uint8_t getNoise(uint16_t col, uint16_t row) {
+        return noiseArr[row * numCols + col];
+    };
+};
+
+#endif
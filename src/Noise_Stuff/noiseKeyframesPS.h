@@ -0,0 +1,45 @@
+#ifndef noiseKeyframesPS_h
+#define noiseKeyframesPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for storing two "keyframe" slices of noise, so that noise effects can blend between them
+rather than calculating the full noise every update.
+Most noise effects move slowly through the noise's z/time axis, so the noise changes very little from one update to the next.
+Instead of re-calculating the noise for each pixel every update, we can calculate a full slice of noise
+only once every so often (a keyframe), and then linearly blend each pixel's value from the last slice to the next one
+for the updates in between. This trades a bit of noise detail for a large cut in processing.
+
+Keyframes can either be spaced by a number of updates ("keyFrames"), or a time in ms ("keyTime"),
+see noiseUtilsPS::updateKeyframes() for more. The effects that support keyframes have
+keyFrames and keyTime settings that you can set directly, ie noiseSL.keyFrames = 4;
+Setting both to 0 turns keyframes off (the default).
+
+Note that using keyframes needs two extra bytes of memory for each pixel (per noise value) in the effect.
+
+You shouldn't need to set any of the struct's variables yourself, they are managed by the noiseUtilsPS keyframe functions.
+Like with other structs, it must be initialized with its pointers set to null:
+    noiseKeyframesPS noiseKeys = {nullptr, 0, 0}; //Must init structs w/ pointers set to null for safety
+!!Keyframe slices are created dynamically, so make sure you free the keyArr when you're done by calling memUtilsPS::freePS(noiseKeys.keyArr). */
+struct noiseKeyframesPS {
+    uint8_t *keyArr;     //pointer to the slice array, holds both the start and end slices back to back
+    uint16_t length;     //the length of a single slice
+    uint16_t maxLength;  //The total length of the keyArr, used for memory management (see patternPS for more)
+
+    //the below variables are used to track the keyframes, and are set automatically
+    uint8_t startSlice;           //which half of the keyArr is the start slice (0 or 1), the other is the end slice
+    uint8_t blendAmount;          //how far we've blended from the start slice to the end slice (0 - 255)
+    uint16_t frameCount;          //the number of updates since the last keyframe
+    unsigned long keyStartTime;   //the time of the last keyframe (ms)
+    bool primed;                  //true once both slices have been filled
+    bool fillStart;               //set by noiseUtilsPS::updateKeyframes() if the start slice also needs to be filled
+};
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef noiseRowPS_h
+#define noiseRowPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for tracking a walk along a line of Perlin noise samples.
+Noise is normally sampled point by point, with each sample needing to look up the lattice corners
+(the "cell") surrounding the point. But effects almost always sample noise in rows,
+stepping a fixed amount along a segment line or segment each time.
+Neighboring samples usually fall in the same lattice cell, so by caching the cell's corner hashes
+we only need to look them up again when a sample crosses into a new cell.
+For 3D noise the z axis (usually time) is also fixed along a row, so its parts of the calculation are only done once.
+
+The samples are the same as FastLED's inoise8(x, y) (2D) and inoise8(x, y, z) (3D) for the same inputs.
+
+You shouldn't need to set any of the struct's variables yourself.
+Start a row using noiseUtilsPS::startNoiseRow8(), and then fetch each sample using noiseUtilsPS::nextNoise8().
+For 16 bit noise use noiseRow16PS, noiseUtilsPS::startNoiseRow16(), and noiseUtilsPS::nextNoise16().
+
+Example:
+    noiseRowPS noiseRow;
+    //Start a 2D row at x = 100, y = millis()/10 stepping by 30 in the x direction for each sample
+    noiseUtilsPS::startNoiseRow8(noiseRow, 100, millis() / 10, 30, 0);
+    for( uint16_t i = 0; i < numLines; i++ ) {
+        noiseVal = noiseUtilsPS::nextNoise8(noiseRow); //same as inoise8(100 + i * 30, millis() / 10)
+    }
+See noiseUtilsPS.h for more. */
+struct noiseRowPS {
+    uint16_t x;      //x coordinate of the next sample
+    uint16_t y;      //y coordinate of the next sample
+    uint16_t xStep;  //amount x is changed by for each sample
+    uint16_t yStep;  //amount y is changed by for each sample
+
+    //the below variables are used to track the noise lattice, and are set automatically
+    bool is3D;         //true for 3D noise (inoise8(x, y, z)), false for 2D (inoise8(x, y))
+    uint8_t cellX;     //x lattice coordinate of the cached cell
+    uint8_t cellY;     //y lattice coordinate of the cached cell
+    bool cellValid;    //false if the cell hashes need to be looked up for the next sample
+    uint8_t cellZ;     //z lattice coordinate (fixed along the row, 3D only)
+    int8_t zz;         //z offset within the cell (fixed along the row, 3D only)
+    uint8_t w;         //eased z offset (fixed along the row, 3D only)
+    uint8_t hash[8];   //the hash values of the corners of the cached cell (2D only uses the first 4)
+};
+
+//Same as noiseRowPS, but for 16 bit 3D noise (uses 32 bit coordinates like inoise16(x, y, z))
+struct noiseRow16PS {
+    uint32_t x;
+    uint32_t y;
+    uint32_t xStep;
+    uint32_t yStep;
+
+    uint8_t cellX;
+    uint8_t cellY;
+    bool cellValid;
+    uint8_t cellZ;
+    int16_t zz;
+    uint16_t w;
+    uint8_t hash[8];
+};
+
+#endif
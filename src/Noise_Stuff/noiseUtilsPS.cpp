@@ -0,0 +1,425 @@
+#include "noiseUtilsPS.h"
+
+using namespace noiseUtilsPS;
+
+//Ken Perlin's reference permutation table, used to hash the noise lattice corners
+//Stored in PROGMEM to save ram on smaller boards
+static const uint8_t noisePerm_PS[256] PROGMEM = {
+    151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225,
+    140, 36, 103, 30, 69, 142, 8, 99, 37, 240, 21, 10, 23, 190, 6, 148,
+    247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203, 117, 35, 11, 32,
+    57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175,
+    74, 165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122,
+    60, 211, 133, 230, 220, 105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54,
+    65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132, 187, 208, 89, 18, 169,
+    200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3, 64,
+    52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212,
+    207, 206, 59, 227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213,
+    119, 248, 152, 2, 44, 154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9,
+    129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232, 178, 185, 112, 104,
+    218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12, 191, 179, 162, 241,
+    81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157,
+    184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93,
+    222, 114, 67, 29, 24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180};
+
+//Returns the permutation table entry for the input (wrapping at 256)
+static inline uint8_t noisePerm(uint8_t i) {
+    return pgm_read_byte(&noisePerm_PS[i]);
+}
+
+/* Fills in the hashes for the 8 corners of the 3D noise lattice cell at (X, Y, Z)
+The corners are ordered as:
+    0: (0, 0, 0), 1: (1, 0, 0), 2: (0, 1, 0), 3: (1, 1, 0),
+    4: (0, 0, 1), 5: (1, 0, 1), 6: (0, 1, 1), 7: (1, 1, 1) */
+static void setCellHashes(uint8_t *hash, uint8_t X, uint8_t Y, uint8_t Z) {
+    uint8_t A = noisePerm(X) + Y;
+    uint8_t AA = noisePerm(A) + Z;
+    uint8_t AB = noisePerm(A + 1) + Z;
+    uint8_t B = noisePerm(X + 1) + Y;
+    uint8_t BA = noisePerm(B) + Z;
+    uint8_t BB = noisePerm(B + 1) + Z;
+
+    hash[0] = noisePerm(AA);
+    hash[1] = noisePerm(BA);
+    hash[2] = noisePerm(AB);
+    hash[3] = noisePerm(BB);
+    hash[4] = noisePerm(AA + 1);
+    hash[5] = noisePerm(BA + 1);
+    hash[6] = noisePerm(AB + 1);
+    hash[7] = noisePerm(BB + 1);
+}
+
+/* Fills in the hashes for the 4 corners of the 2D noise lattice cell at (X, Y)
+The corners are ordered as: 0: (0, 0), 1: (1, 0), 2: (0, 1), 3: (1, 1) */
+static void setCellHashes2D(uint8_t *hash, uint8_t X, uint8_t Y) {
+    uint8_t A = noisePerm(X) + Y;
+    uint8_t B = noisePerm(X + 1) + Y;
+
+    hash[0] = noisePerm(noisePerm(A));
+    hash[1] = noisePerm(noisePerm(B));
+    hash[2] = noisePerm(noisePerm(A + 1));
+    hash[3] = noisePerm(noisePerm(B + 1));
+}
+
+//Returns the dot product of one of Perlin's 12 gradient vectors (picked by the hash) with the input offset
+//Matches FastLED's 3D grad8(), so the output is averaged (halved) using avg7() to keep it in range of an int8_t
+static inline int8_t grad8(uint8_t hash, int8_t x, int8_t y, int8_t z) {
+    hash &= 0x0F;
+    int8_t u = hash < 8 ? x : y;
+    int8_t v = hash < 4 ? y : (hash == 12 || hash == 14 ? x : z);
+    if( hash & 1 ) {
+        u = -u;
+    }
+    if( hash & 2 ) {
+        v = -v;
+    }
+    return avg7(u, v);
+}
+
+//2D version of grad8(), matches FastLED's 2D grad8()
+static inline int8_t grad8(uint8_t hash, int8_t x, int8_t y) {
+    int8_t u, v;
+    if( hash & 4 ) {
+        u = y;
+        v = x;
+    } else {
+        u = x;
+        v = y;
+    }
+    if( hash & 1 ) {
+        u = -u;
+    }
+    if( hash & 2 ) {
+        v = -v;
+    }
+    return avg7(u, v);
+}
+
+//16 bit version of grad8(), matches FastLED's 3D grad16()
+static inline int16_t grad16(uint8_t hash, int16_t x, int16_t y, int16_t z) {
+    hash &= 0x0F;
+    int16_t u = hash < 8 ? x : y;
+    int16_t v = hash < 4 ? y : (hash == 12 || hash == 14 ? x : z);
+    if( hash & 1 ) {
+        u = -u;
+    }
+    if( hash & 2 ) {
+        v = -v;
+    }
+    return avg15(u, v);
+}
+
+/* Starts a new row of 3D 8 bit noise at (x, y, z)
+Each call to nextNoise8() will return the noise at the row's current position,
+and then step x and y by xStep and yStep.
+The noise is the same as inoise8(x, y, z), with every 256 of x, y, or z being one noise lattice cell.
+So smaller steps produce more "zoomed-in" noise, and get more use out of each lattice cell.
+Note that the z position is fixed for the whole row (it's usually the time). */
+void noiseUtilsPS::startNoiseRow8(noiseRowPS &noiseRow, uint16_t x, uint16_t y, uint16_t z, uint16_t xStep, uint16_t yStep) {
+    startNoiseRow8(noiseRow, x, y, xStep, yStep);
+
+    //The z position doesn't change along the row, so we can pre-calculate its values
+    noiseRow.is3D = true;
+    noiseRow.cellZ = z >> 8;
+    noiseRow.zz = ((uint8_t)z >> 1) & 0x7F;
+    noiseRow.w = ease8InOutQuad((uint8_t)z);
+}
+
+/* Starts a new row of 2D 8 bit noise at (x, y)
+Works the same as the 3D version, but the noise is the same as inoise8(x, y). */
+void noiseUtilsPS::startNoiseRow8(noiseRowPS &noiseRow, uint16_t x, uint16_t y, uint16_t xStep, uint16_t yStep) {
+    noiseRow.x = x;
+    noiseRow.y = y;
+    noiseRow.xStep = xStep;
+    noiseRow.yStep = yStep;
+    noiseRow.is3D = false;
+
+    //Force the first sample to look up its lattice cell
+    noiseRow.cellValid = false;
+}
+
+/* Returns the 8 bit noise value at the noise row's current position, and steps the row to the next position.
+The output is the same as inoise8(), including its range (roughly 16 - 238).
+The lattice cell hashes are only looked up if we've moved into a new cell since the last sample.
+The calculation follows FastLED's inoise8_raw() step for step, so the results are bit-for-bit identical to inoise8(). */
+uint8_t noiseUtilsPS::nextNoise8(noiseRowPS &noiseRow) {
+    uint8_t X = noiseRow.x >> 8;
+    uint8_t Y = noiseRow.y >> 8;
+
+    //If we've crossed into a new lattice cell, we need to get its corner hashes
+    if( !noiseRow.cellValid || X != noiseRow.cellX || Y != noiseRow.cellY ) {
+        if( noiseRow.is3D ) {
+            setCellHashes(noiseRow.hash, X, Y, noiseRow.cellZ);
+        } else {
+            setCellHashes2D(noiseRow.hash, X, Y);
+        }
+        noiseRow.cellX = X;
+        noiseRow.cellY = Y;
+        noiseRow.cellValid = true;
+    }
+
+    //Get the position within the cell, and the eased interpolation fractions
+    //The offsets are halved so that the far corners (offset - 128) stay within an int8_t
+    int8_t xx = ((uint8_t)noiseRow.x >> 1) & 0x7F;
+    int8_t yy = ((uint8_t)noiseRow.y >> 1) & 0x7F;
+    uint8_t u = ease8InOutQuad((uint8_t)noiseRow.x);
+    uint8_t v = ease8InOutQuad((uint8_t)noiseRow.y);
+    uint8_t *hash = noiseRow.hash;
+    int8_t noise;
+
+    //Blend the gradients of the cell corners together
+    if( noiseRow.is3D ) {
+        int8_t zz = noiseRow.zz;
+        int8_t x1 = lerp7by8(grad8(hash[0], xx, yy, zz), grad8(hash[1], xx - 0x80, yy, zz), u);
+        int8_t x2 = lerp7by8(grad8(hash[2], xx, yy - 0x80, zz), grad8(hash[3], xx - 0x80, yy - 0x80, zz), u);
+        int8_t x3 = lerp7by8(grad8(hash[4], xx, yy, zz - 0x80), grad8(hash[5], xx - 0x80, yy, zz - 0x80), u);
+        int8_t x4 = lerp7by8(grad8(hash[6], xx, yy - 0x80, zz - 0x80), grad8(hash[7], xx - 0x80, yy - 0x80, zz - 0x80), u);
+
+        noise = lerp7by8(lerp7by8(x1, x2, v), lerp7by8(x3, x4, v), noiseRow.w);
+    } else {
+        int8_t x1 = lerp7by8(grad8(hash[0], xx, yy), grad8(hash[1], xx - 0x80, yy), u);
+        int8_t x2 = lerp7by8(grad8(hash[2], xx, yy - 0x80), grad8(hash[3], xx - 0x80, yy - 0x80), u);
+
+        noise = lerp7by8(x1, x2, v);
+    }
+
+    //step to the next sample position
+    noiseRow.x += noiseRow.xStep;
+    noiseRow.y += noiseRow.yStep;
+
+    //The raw noise is roughly -64 to 64, so we shift and double it to fill the 0 - 255 range (same as inoise8())
+    noise += 64;
+    return qadd8(noise, noise);
+}
+
+/* Starts a new row of 3D 16 bit noise at (x, y, z)
+Works the same as startNoiseRow8(), but the noise is the same as inoise16(x, y, z), 
+so every 65536 of x, y, or z is one noise lattice cell. */
+void noiseUtilsPS::startNoiseRow16(noiseRow16PS &noiseRow, uint32_t x, uint32_t y, uint32_t z, uint32_t xStep, uint32_t yStep) {
+    noiseRow.x = x;
+    noiseRow.y = y;
+    noiseRow.xStep = xStep;
+    noiseRow.yStep = yStep;
+
+    noiseRow.cellZ = z >> 16;
+    noiseRow.zz = ((uint16_t)z >> 1) & 0x7FFF;
+    noiseRow.w = ease16InOutQuad((uint16_t)z);
+
+    noiseRow.cellValid = false;
+}
+
+/* Returns the 16 bit noise value at the noise row's current position, and steps the row to the next position.
+Works the same as nextNoise8(), but the output is the same as inoise16(x, y, z). */
+uint16_t noiseUtilsPS::nextNoise16(noiseRow16PS &noiseRow) {
+    uint8_t X = noiseRow.x >> 16;
+    uint8_t Y = noiseRow.y >> 16;
+
+    if( !noiseRow.cellValid || X != noiseRow.cellX || Y != noiseRow.cellY ) {
+        setCellHashes(noiseRow.hash, X, Y, noiseRow.cellZ);
+        noiseRow.cellX = X;
+        noiseRow.cellY = Y;
+        noiseRow.cellValid = true;
+    }
+
+    int16_t xx = ((uint16_t)noiseRow.x >> 1) & 0x7FFF;
+    int16_t yy = ((uint16_t)noiseRow.y >> 1) & 0x7FFF;
+    int16_t zz = noiseRow.zz;
+    uint16_t u = ease16InOutQuad((uint16_t)noiseRow.x);
+    uint16_t v = ease16InOutQuad((uint16_t)noiseRow.y);
+    uint8_t *hash = noiseRow.hash;
+
+    int16_t x1 = lerp15by16(grad16(hash[0], xx, yy, zz), grad16(hash[1], xx - 0x8000, yy, zz), u);
+    int16_t x2 = lerp15by16(grad16(hash[2], xx, yy - 0x8000, zz), grad16(hash[3], xx - 0x8000, yy - 0x8000, zz), u);
+    int16_t x3 = lerp15by16(grad16(hash[4], xx, yy, zz - 0x8000), grad16(hash[5], xx - 0x8000, yy, zz - 0x8000), u);
+    int16_t x4 = lerp15by16(grad16(hash[6], xx, yy - 0x8000, zz - 0x8000), grad16(hash[7], xx - 0x8000, yy - 0x8000, zz - 0x8000), u);
+
+    int16_t noise = lerp15by16(lerp15by16(x1, x2, v), lerp15by16(x3, x4, v), noiseRow.w);
+
+    noiseRow.x += noiseRow.xStep;
+    noiseRow.y += noiseRow.yStep;
+
+    //Shift and scale the raw noise to fill the 0 - 65535 range (same as inoise16())
+    uint32_t noiseOut = (int32_t)noise + 19052;
+    return (noiseOut * 440) >> 8;
+}
+
+/* Fills the passed in array with a row of 3D 8 bit noise values
+The row starts at (x, y, z), stepping by xStep and yStep for each sample
+(see startNoiseRow8() for more on the inputs)
+Note that the array must be at least "length" long. */
+void noiseUtilsPS::fillNoiseRow8(uint8_t *noiseArr, uint16_t length, uint16_t x, uint16_t y, uint16_t z, uint16_t xStep, uint16_t yStep) {
+    startNoiseRow8(fillRow, x, y, z, xStep, yStep);
+    for( uint16_t i = 0; i < length; i++ ) {
+        noiseArr[i] = nextNoise8(fillRow);
+    }
+}
+
+//2D version of fillNoiseRow8(), the noise is the same as inoise8(x, y)
+void noiseUtilsPS::fillNoiseRow8(uint8_t *noiseArr, uint16_t length, uint16_t x, uint16_t y, uint16_t xStep, uint16_t yStep) {
+    startNoiseRow8(fillRow, x, y, xStep, yStep);
+    for( uint16_t i = 0; i < length; i++ ) {
+        noiseArr[i] = nextNoise8(fillRow);
+    }
+}
+
+/* Adjusts the passed in noise field's dimensions, re-allocating its memory if needed
+Like generalUtilsPS::resizePattern(), the noise array is only re-sized if it needs to be larger, or if alwaysResizeObj_PS is true.
+If the dimensions change, the field will be re-filled the next time fillNoiseField8() is called.
+If the field already has the passed in dimensions, nothing is changed, so it's fine to call this before each fill
+(this keeps the field's noise, so it can be shared between effects).
+!!!!Make sure you free the array after you are done with the field by calling memUtilsPS::freePS(noiseField.noiseArr). */
+void noiseUtilsPS::resizeNoiseField(noiseFieldPS &noiseField, uint16_t numCols, uint16_t numRows) {
+    if( noiseField.noiseArr && numCols == noiseField.numCols && numRows == noiseField.numRows ) {
+        return;
+    }
+
+    uint16_t sizeNeeded = numCols * numRows;
+    if( alwaysResizeObj_PS || (sizeNeeded > noiseField.maxLength) ) {
+        memUtilsPS::freePS(noiseField.noiseArr);
+        noiseField.noiseArr = (uint8_t *)memUtilsPS::allocPS(sizeNeeded * sizeof(uint8_t));
+        noiseField.maxLength = sizeNeeded;
+    }
+
+    noiseField.numCols = numCols;
+    noiseField.numRows = numRows;
+    noiseField.filled = false;
+}
+
+/* Fills the passed in noise field with 8 bit 3D noise, one row at a time (see noiseFieldPS.h)
+Each field value is the same as inoise8(x + col * xStep, y + row * yStep, z).
+If the field was last filled using the same inputs it already holds the noise, so it isn't re-filled.
+Returns true if the field was filled, or false if it was already up to date. */
+bool noiseUtilsPS::fillNoiseField8(noiseFieldPS &noiseField, uint16_t x, uint16_t xStep, uint16_t y, uint16_t yStep, uint16_t z) {
+
+    //If the field already contains the noise we want, we don't need to do anything
+    if( noiseField.filled && noiseField.x == x && noiseField.xStep == xStep &&
+        noiseField.y == y && noiseField.yStep == yStep && noiseField.z == z ) {
+        return false;
+    }
+
+    //Fill in each row of the field
+    for( uint16_t i = 0; i < noiseField.numRows; i++ ) {
+        fillNoiseRow8(&noiseField.noiseArr[i * noiseField.numCols], noiseField.numCols, x, y + i * yStep, z, xStep, 0);
+    }
+
+    //record the inputs so the field can be shared
+    noiseField.x = x;
+    noiseField.xStep = xStep;
+    noiseField.y = y;
+    noiseField.yStep = yStep;
+    noiseField.z = z;
+    noiseField.filled = true;
+
+    return true;
+}
+
+//Returns true if the keyframe settings have keyframes turned on
+//(either keyFrames is more than 1, or keyTime is more than 0)
+bool noiseUtilsPS::keyframesOn(uint16_t keyFrames, uint16_t keyTime) {
+    return (keyFrames > 1) || (keyTime > 0);
+}
+
+/* Adjusts the passed in keyframe struct's slice length, re-allocating its memory if needed
+Like generalUtilsPS::resizePattern(), the slice array is only re-sized if it needs to be larger, or if alwaysResizeObj_PS is true.
+If the slice length changes, both slices will be re-filled at the next keyframe update.
+Note that the struct stores two slices, so the memory used is twice the length.
+!!!!Make sure you free the array after you are done with the keyframes by calling memUtilsPS::freePS(noiseKeys.keyArr). */
+void noiseUtilsPS::resizeNoiseKeyframes(noiseKeyframesPS &noiseKeys, uint16_t length) {
+    uint16_t sizeNeeded = length * 2;
+
+    if( alwaysResizeObj_PS || (sizeNeeded > noiseKeys.maxLength) ) {
+        memUtilsPS::freePS(noiseKeys.keyArr);
+        noiseKeys.keyArr = (uint8_t *)memUtilsPS::allocPS(sizeNeeded * sizeof(uint8_t));
+        noiseKeys.maxLength = sizeNeeded;
+        noiseKeys.primed = false;
+    }
+
+    if( length != noiseKeys.length ) {
+        noiseKeys.length = length;
+        noiseKeys.primed = false;
+    }
+}
+
+//Resets the keyframes, so that both slices will be re-filled at the next keyframe update
+//Call this when keyframes are turned back on after being off (see keyframesOn()),
+//otherwise the old slices (from when the keyframes were last on) would be blended from, causing the noise to jump
+void noiseUtilsPS::resetKeyframes(noiseKeyframesPS &noiseKeys) {
+    noiseKeys.primed = false;
+}
+
+/* Steps the keyframes forward by one effect update, should be called once each update, before getting any noise.
+Keyframes can be spaced in one of two ways:
+    keyTime > 0: A new keyframe happens every keyTime ms, with the blending between slices based on the time.
+    Otherwise: A new keyframe happens every keyFrames updates, with the blending based on the number of updates.
+Returns true if a new keyframe has been reached, and the effect needs to fill in the end slice (see getKeyEndSlice()).
+The end slice should be filled with the noise as it will be one keyframe span ahead (see getKeySpanTime() and getKeySpanFrames()).
+If the keyframes have just been started (or re-sized), the start slice also needs to be filled with the current noise,
+in which case noiseKeys.fillStart will be set true. */
+bool noiseUtilsPS::updateKeyframes(noiseKeyframesPS &noiseKeys, uint16_t keyFrames, uint16_t keyTime, unsigned long currentTime) {
+    bool newKey;
+    unsigned long keyElapsed = currentTime - noiseKeys.keyStartTime;
+
+    if( keyTime > 0 ) {
+        newKey = !noiseKeys.primed || keyElapsed >= keyTime;
+    } else {
+        newKey = !noiseKeys.primed || noiseKeys.frameCount >= keyFrames;
+    }
+
+    noiseKeys.fillStart = false;
+    if( newKey ) {
+        //If we already have slices, the old end slice becomes the new start slice
+        //We just flip which half of the array is the start, so nothing needs to be copied
+        if( noiseKeys.primed ) {
+            noiseKeys.startSlice = !noiseKeys.startSlice;
+        } else {
+            noiseKeys.fillStart = true;
+            noiseKeys.primed = true;
+        }
+        noiseKeys.keyStartTime = currentTime;
+        noiseKeys.frameCount = 0;
+        keyElapsed = 0;
+    }
+
+    //Work out how far we are between the keyframes
+    if( keyTime > 0 ) {
+        noiseKeys.blendAmount = minPS((keyElapsed * 256) / keyTime, 255);
+    } else {
+        noiseKeys.blendAmount = ((uint32_t)noiseKeys.frameCount * 256) / keyFrames;
+    }
+    noiseKeys.frameCount++;
+
+    return newKey;
+}
+
+//Returns a pointer to the start of the keyframe start slice
+uint8_t *noiseUtilsPS::getKeyStartSlice(noiseKeyframesPS &noiseKeys) {
+    return &noiseKeys.keyArr[noiseKeys.startSlice * noiseKeys.length];
+}
+
+//Returns a pointer to the start of the keyframe end slice
+uint8_t *noiseUtilsPS::getKeyEndSlice(noiseKeyframesPS &noiseKeys) {
+    return &noiseKeys.keyArr[!noiseKeys.startSlice * noiseKeys.length];
+}
+
+//Returns the noise value at the index, blended between the start and end slices for the current update
+uint8_t noiseUtilsPS::getKeyframeNoise(noiseKeyframesPS &noiseKeys, uint16_t index) {
+    return lerp8by8(getKeyStartSlice(noiseKeys)[index], getKeyEndSlice(noiseKeys)[index], noiseKeys.blendAmount);
+}
+
+//Returns the time between keyframes (ms) for an effect updating at "rate"
+//If keyTime is set, it's used directly, otherwise the time is the keyFrames * rate.
+uint16_t noiseUtilsPS::getKeySpanTime(uint16_t keyFrames, uint16_t keyTime, uint16_t rate) {
+    if( keyTime > 0 ) {
+        return keyTime;
+    }
+    return keyFrames * rate;
+}
+
+//Returns the number of updates between keyframes for an effect updating at "rate"
+//If keyTime is set, the number of updates is however many fit in keyTime (minimum 1), otherwise it's keyFrames.
+uint16_t noiseUtilsPS::getKeySpanFrames(uint16_t keyFrames, uint16_t keyTime, uint16_t rate) {
+    if( keyTime > 0 ) {
+        return maxPS(keyTime / maxPS(rate, 1), 1);
+    }
+    return keyFrames;
+}
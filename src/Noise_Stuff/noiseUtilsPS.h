@@ -0,0 +1,73 @@
+#ifndef noiseUtilsPS_h
+#define noiseUtilsPS_h
+
+#include "FastLED.h"
+#include "noiseRowPS.h"
+#include "noiseFieldPS.h"
+#include "noiseKeyframesPS.h"
+#include "MathUtils/mathUtilsPS.h"
+#include "Memory_Stuff/memUtilsPS.h"
+#include "./Include_Lists/GlobalVars/GlobalVars.h"  //need alwaysResizeObj_PS
+
+/*
+Functions for generating Perlin noise in batches.
+FastLED's inoise8() and inoise16() calculate each noise sample from scratch.
+Noise effects call them for every pixel, making them some of the most expensive effects in the library.
+Instead, these functions walk along rows of noise, only looking up the noise lattice when a row crosses into a new lattice cell
+(see noiseRowPS.h for more).
+
+The calculations follow FastLED's own noise functions step for step, 
+so the noise is bit-for-bit identical to inoise8(x, y), inoise8(x, y, z), and inoise16(x, y, z).
+Switching an effect from inoise8() to a noise row doesn't change how it looks.
+
+You can get noise by walking a row yourself using startNoiseRow8() and nextNoise8() (or the 16 bit versions),
+or fill an array with a row of noise using fillNoiseRow8().
+To share noise between effects, you can fill a whole noise field at once using fillNoiseField8() (see noiseFieldPS.h).
+
+There are also functions for managing noise keyframes, where an effect only calculates full slices of noise
+every so often, and blends between them for the updates in between (see noiseKeyframesPS.h).
+*/
+namespace noiseUtilsPS {
+
+    void  //Functions for walking rows of noise
+        startNoiseRow8(noiseRowPS &noiseRow, uint16_t x, uint16_t y, uint16_t z, uint16_t xStep, uint16_t yStep),
+        startNoiseRow8(noiseRowPS &noiseRow, uint16_t x, uint16_t y, uint16_t xStep, uint16_t yStep),
+        startNoiseRow16(noiseRow16PS &noiseRow, uint32_t x, uint32_t y, uint32_t z, uint32_t xStep, uint32_t yStep);
+
+    uint8_t
+        nextNoise8(noiseRowPS &noiseRow);
+
+    uint16_t
+        nextNoise16(noiseRow16PS &noiseRow);
+
+    void  //Functions for filling arrays with noise
+        fillNoiseRow8(uint8_t *noiseArr, uint16_t length, uint16_t x, uint16_t y, uint16_t z, uint16_t xStep, uint16_t yStep),
+        fillNoiseRow8(uint8_t *noiseArr, uint16_t length, uint16_t x, uint16_t y, uint16_t xStep, uint16_t yStep),
+        resizeNoiseField(noiseFieldPS &noiseField, uint16_t numCols, uint16_t numRows);
+
+    bool
+        fillNoiseField8(noiseFieldPS &noiseField, uint16_t x, uint16_t xStep, uint16_t y, uint16_t yStep, uint16_t z);
+
+    void  //Functions for noise keyframes
+        resizeNoiseKeyframes(noiseKeyframesPS &noiseKeys, uint16_t length),
+        resetKeyframes(noiseKeyframesPS &noiseKeys);
+
+    bool
+        keyframesOn(uint16_t keyFrames, uint16_t keyTime),
+        updateKeyframes(noiseKeyframesPS &noiseKeys, uint16_t keyFrames, uint16_t keyTime, unsigned long currentTime);
+
+    uint8_t
+        *getKeyStartSlice(noiseKeyframesPS &noiseKeys),
+        *getKeyEndSlice(noiseKeyframesPS &noiseKeys),
+        getKeyframeNoise(noiseKeyframesPS &noiseKeys, uint16_t index);
+
+    uint16_t
+        getKeySpanTime(uint16_t keyFrames, uint16_t keyTime, uint16_t rate),
+        getKeySpanFrames(uint16_t keyFrames, uint16_t keyTime, uint16_t rate);
+
+    //pre-allocated space for function variables
+    static noiseRowPS
+        fillRow;
+};
+
+#endif
@@ -213,10 +213,10 @@ CRGB paletteUtilsPS::getPaletteGradColor(palettePS &palette, uint16_t step, uint
 }
 
 //returns a palette of length 1 containing the passed in color
-//!!Make sure you delete the paletteArr when you're done with the palette since it is created with new
+//!!Make sure you free the paletteArr when you're done with the palette by calling memUtilsPS::freePS(palette.paletteArr)
 palettePS paletteUtilsPS::makeSingleColorPalette(CRGB Color) {
     palettePS newPalette;
-    CRGB *newPalette_arr = (CRGB *)malloc(1 * sizeof(CRGB));
+    CRGB *newPalette_arr = (CRGB *)memUtilsPS::allocPS(1 * sizeof(CRGB));
     //CRGB *newPalette_arr = new CRGB[1];
     newPalette_arr[0] = Color;
     newPalette = {newPalette_arr, 1};
@@ -226,10 +226,10 @@ palettePS paletteUtilsPS::makeSingleColorPalette(CRGB Color) {
 //returns a palette of the specified length full of random colors
 //Colors can either be fully random, or made to be complementary with a random base hue (colors evenly spaced across the HSV spectrum)
 //The default is for fully random colors
-//!!Make sure you delete the paletteArr when you're done with the palette since it is created with new
+//!!Make sure you free the paletteArr when you're done with the palette by calling memUtilsPS::freePS(palette.paletteArr)
 palettePS paletteUtilsPS::makeRandomPalette(uint8_t length, bool comp) {
     palettePS newPalette;
-    CRGB *newPalette_arr = (CRGB *)malloc(length * sizeof(CRGB));
+    CRGB *newPalette_arr = (CRGB *)memUtilsPS::allocPS(length * sizeof(CRGB));
     newPalette = {newPalette_arr, length};
     randomize(newPalette, comp);
     return newPalette;
@@ -238,10 +238,10 @@ palettePS paletteUtilsPS::makeRandomPalette(uint8_t length, bool comp) {
 //Returns a palette with a set of complimentary colors, starting from a base hue value.
 //Allows you to easily make split, tri, and tetrad palettes. 
 //Note that the colors are HSV based. sat and val adjust the saturation and value of the resulting palette colors. 
-//!!Make sure you delete the paletteArr when you're done with the palette since it is created with new
+//!!Make sure you free the paletteArr when you're done with the palette by calling memUtilsPS::freePS(palette.paletteArr)
 palettePS paletteUtilsPS::makeCompPalette(uint8_t length, uint8_t baseHue, uint8_t sat, uint8_t val) {
     palettePS newPalette;
-    CRGB *newPalette_arr = (CRGB *)malloc(length * sizeof(CRGB));
+    CRGB *newPalette_arr = (CRGB *)memUtilsPS::allocPS(length * sizeof(CRGB));
     newPalette = {newPalette_arr, length};
 
     //Fill the palette with complimentary colors
@@ -279,3 +279,37 @@ palettePS paletteUtilsPS::splitPalettePtr(palettePS &inputPalette, uint8_t start
 
     return newPalette;
 }
+
+//Returns a simple hash of the palette's colors
+//Each color is packed into the hash without its r, g, and b overlapping, so a single color change always changes the hash
+//But different palettes can still share a hash, so if you need to catch every color change (ie for look up tables),
+//keep a copy of the colors instead (see copyPaletteColors() and paletteColorsMatch())
+uint32_t paletteUtilsPS::getPaletteHash(palettePS &palette) {
+    uint32_t hash = palette.length;
+    for( uint8_t i = 0; i < palette.length; i++ ) {
+        hash = (hash << 7) | (hash >> 25);  //rotate the hash so the color order matters
+        hash ^= ((uint32_t)palette.paletteArr[i].r << 16) | ((uint16_t)palette.paletteArr[i].g << 8) | palette.paletteArr[i].b;
+    }
+    return hash;
+}
+
+//Copies the palette's colors into the passed in color array (which must be at least the palette's length)
+//Use with paletteColorsMatch() to check if the palette's colors have changed
+//(ie for look up tables built using the palette)
+void paletteUtilsPS::copyPaletteColors(palettePS &palette, CRGB *colorArr) {
+    for( uint8_t i = 0; i < palette.length; i++ ) {
+        colorArr[i] = palette.paletteArr[i];
+    }
+}
+
+//Returns true if the palette's colors exactly match the colors in the passed in color array
+//The color array should be a copy of the palette's colors, made using copyPaletteColors()
+//(you must check that the palette's length hasn't changed before calling this)
+bool paletteUtilsPS::paletteColorsMatch(palettePS &palette, CRGB *colorArr) {
+    for( uint8_t i = 0; i < palette.length; i++ ) {
+        if( colorArr[i] != palette.paletteArr[i] ) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -4,6 +4,7 @@
 #include "palettePS.h"
 #include "ColorUtils/colorUtilsPS.h"
 #include "MathUtils/mathUtilsPS.h"
+#include "Memory_Stuff/memUtilsPS.h"
 
 //series of utility functions for interacting with palettes
 //use these to change palettes
@@ -31,6 +32,15 @@ namespace paletteUtilsPS {
         makeCompPalette(uint8_t length, uint8_t baseHue, uint8_t sat, uint8_t val),
         splitPalettePtr(palettePS &inputPalette, uint8_t startIndex, uint8_t splitLength);
 
+    uint32_t  //Other functions
+        getPaletteHash(palettePS &palette);
+
+    void  //Functions for tracking palette color changes
+        copyPaletteColors(palettePS &palette, CRGB *colorArr);
+
+    bool
+        paletteColorsMatch(palettePS &palette, CRGB *colorArr);
+
     //Pre-allocated variables
     static uint8_t
         uint8One,
@@ -30,12 +30,24 @@
 
 #include "./Include_Lists/GlobalVars/GlobalVars.h"
 
+#include "./Include_Lists/MemoryFiles.h"
+
+#include "./Include_Lists/MailboxFiles.h"
+
 #include "./Include_Lists/SegmentFiles.h"
 
 #include "./Include_Lists/PaletteFiles.h"
 
 #include "./Include_Lists/PatternFiles.h"
 
+#include "./Include_Lists/NoiseFiles.h"
+
+#include "./Include_Lists/RandomFiles.h"
+
+#include "./Include_Lists/AudioFiles.h"
+
+#include "./Include_Lists/GridFiles.h"
+
 #include "./Include_Lists/UtilsList.h"
 
 #include "./Include_Lists/EffectsList.h"
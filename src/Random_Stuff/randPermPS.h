@@ -0,0 +1,37 @@
+#ifndef randPermPS_h
+#define randPermPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for a random permutation (shuffled order) of the numbers 0 to length - 1, without storing the order itself.
+This is useful for effects that need to visit every pixel/line once in a random order, without repeats, 
+such as dissolving one color into another. 
+Normally you'd shuffle an array of indexes, but that needs 2 bytes for every pixel,
+instead the permutation is worked out on the fly using a small "Feistel network".
+
+The network splits an index into two halves of bits, and repeatedly mixes one half into the other using a set of random keys.
+Every step can be undone, so each index maps to a unique output (no repeats), but the outputs are scrambled.
+The network works on a power of 4 range of numbers, so any outputs past the length are passed through the network again
+until they land in range ("cycle walking"). This takes less than 4 passes on average.
+
+To use the permutation, set it up with randUtilsPS::setupPerm(), which picks new random keys,
+and then get the shuffled value for each index from 0 to length - 1 using randUtilsPS::getPermVal().
+Calling setupPerm() again gives a new random order.
+
+You shouldn't need to set any of the struct's variables yourself, they are managed by the randUtilsPS functions.
+    randPermPS randPerm = {};
+*/
+struct randPermPS {
+    uint16_t length;   //the number of values in the permutation (0 to length - 1)
+    uint8_t halfBits;  //the number of bits in each half of an index
+    uint8_t keys[4];   //the random keys for each round of the network
+};
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef randStreamPS_h
+#define randStreamPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+/*
+A struct for a stream of pseudo-random numbers, used by effects in place of FastLED's random8() and random16().
+FastLED's random functions share a single global generator, so one effect's random numbers depend on what every other effect
+has drawn, and you can't replay an effect's output by seeding it on its own. 
+Instead, each effect has its own random stream (its "randStream", see EffectBasePS.h), which you can seed individually.
+This makes an effect's output repeatable, ie for comparing output frames or timing effects with the same work each run.
+
+The stream uses a 32 bit xorshift generator, which produces 4 random bytes per step.
+The bytes are handed out one at a time by randUtilsPS::rand8() (so only one step is needed for every 4 calls), 
+or can be filled into an array in bulk using randUtilsPS::fillRand8(). See randUtilsPS.h for all the functions.
+
+A stream with a state of 0 is "unseeded", and will seed itself from FastLED's random16() the first time it is used.
+So, by default, effects still get different random numbers each time (as long as you've added entropy to FastLED's random),
+but once you seed a stream it will always produce the same numbers:
+    randUtilsPS::seedStream(twinkleSL.randStream, 1234);
+
+You shouldn't need to set any of the struct's variables yourself, they are managed by the randUtilsPS functions.
+To create your own stream:
+    randStreamPS randStream = {}; //unseeded
+*/
+struct randStreamPS {
+    uint32_t state;      //the current generator state, 0 for unseeded
+    uint32_t byteBuf;    //the remaining random bytes from the last generator step
+    uint8_t bytesLeft;   //the number of bytes left in the byteBuf
+};
+
+#endif
@@ -0,0 +1,200 @@
+#include "randUtilsPS.h"
+
+//Seeds a random stream, so that it will always produce the same numbers for the same seed
+//The seed is mixed up first, so that similar seeds (ie 1, 2, 3...) give very different streams
+//(the stream's state can never be 0, since 0 is used to mark an unseeded stream, and xorshift gets stuck at 0)
+void randUtilsPS::seedStream(randStreamPS &randStream, uint32_t seed) {
+    seed ^= seed >> 16;
+    seed *= 0x45D9F3B;
+    seed ^= seed >> 16;
+    seed *= 0x45D9F3B;
+    seed ^= seed >> 16;
+
+    if( seed == 0 ) {
+        seed = 0x9E3779B9;
+    }
+
+    randStream.state = seed;
+    randStream.bytesLeft = 0;
+}
+
+//Steps the stream's generator forward, returning a random 32 bit number
+//Uses a 32 bit xorshift generator (shifts of 13, 17, 5)
+//If the stream hasn't been seeded, it is seeded using FastLED's random16()
+uint32_t randUtilsPS::rand32(randStreamPS &randStream) {
+    if( randStream.state == 0 ) {
+        seedStream(randStream, ((uint32_t)random16() << 16) | random16());
+    }
+
+    randStream.state ^= randStream.state << 13;
+    randStream.state ^= randStream.state >> 17;
+    randStream.state ^= randStream.state << 5;
+    return randStream.state;
+}
+
+//Returns a random 8 bit number
+//Each generator step gives 4 random bytes, which are handed out one at a time
+uint8_t randUtilsPS::rand8(randStreamPS &randStream) {
+    if( randStream.bytesLeft == 0 ) {
+        randStream.byteBuf = rand32(randStream);
+        randStream.bytesLeft = 4;
+    }
+
+    uint8_t out = randStream.byteBuf;
+    randStream.byteBuf >>= 8;
+    randStream.bytesLeft--;
+    return out;
+}
+
+//Returns a random 8 bit number from 0 up to (but not including) lim (same as FastLED's random8(lim))
+uint8_t randUtilsPS::rand8(randStreamPS &randStream, uint8_t lim) {
+    return (rand8(randStream) * lim) >> 8;
+}
+
+//Returns a random 8 bit number from min up to (but not including) lim (same as FastLED's random8(min, lim))
+uint8_t randUtilsPS::rand8(randStreamPS &randStream, uint8_t min, uint8_t lim) {
+    return rand8(randStream, lim - min) + min;
+}
+
+//Returns a random 16 bit number
+//Uses two bytes from the last generator step if there's enough left
+uint16_t randUtilsPS::rand16(randStreamPS &randStream) {
+    if( randStream.bytesLeft < 2 ) {
+        randStream.byteBuf = rand32(randStream);
+        randStream.bytesLeft = 4;
+    }
+
+    uint16_t out = randStream.byteBuf;
+    randStream.byteBuf >>= 16;
+    randStream.bytesLeft -= 2;
+    return out;
+}
+
+//Returns a random 16 bit number from 0 up to (but not including) lim (same as FastLED's random16(lim))
+uint16_t randUtilsPS::rand16(randStreamPS &randStream, uint16_t lim) {
+    return ((uint32_t)rand16(randStream) * lim) >> 16;
+}
+
+//Returns a random 16 bit number from min up to (but not including) lim (same as FastLED's random16(min, lim))
+uint16_t randUtilsPS::rand16(randStreamPS &randStream, uint16_t min, uint16_t lim) {
+    return rand16(randStream, lim - min) + min;
+}
+
+//Fills an array with random bytes
+//Each generator step fills 4 bytes at once
+void randUtilsPS::fillRand8(randStreamPS &randStream, uint8_t *arr, uint16_t length) {
+    uint32_t randWord;
+    uint16_t i = 0;
+    for( ; i + 4 <= length; i += 4 ) {
+        randWord = rand32(randStream);
+        arr[i] = randWord;
+        arr[i + 1] = randWord >> 8;
+        arr[i + 2] = randWord >> 16;
+        arr[i + 3] = randWord >> 24;
+    }
+
+    //Fill any left over bytes one at a time
+    for( ; i < length; i++ ) {
+        arr[i] = rand8(randStream);
+    }
+}
+
+//Fills an array with random bytes from 0 up to (but not including) lim (like rand8(randStream, lim))
+void randUtilsPS::fillRand8(randStreamPS &randStream, uint8_t *arr, uint16_t length, uint8_t lim) {
+    fillRand8(randStream, arr, length);
+    for( uint16_t i = 0; i < length; i++ ) {
+        arr[i] = (arr[i] * lim) >> 8;
+    }
+}
+
+//Fills an array with random bytes from min up to (but not including) lim (like rand8(randStream, min, lim))
+void randUtilsPS::fillRand8(randStreamPS &randStream, uint8_t *arr, uint16_t length, uint8_t min, uint8_t lim) {
+    fillRand8(randStream, arr, length, lim - min);
+    for( uint16_t i = 0; i < length; i++ ) {
+        arr[i] += min;
+    }
+}
+
+
+//Returns the scale used by randGap() for a trigger chance of hits/basis (ie 5/1000 would be a 0.5% chance)
+//The scale is -1/ln(1 - chance), so that we only need to work out the log once for each chance.
+//A chance of 0 gives an infinite scale (never triggers), while a chance of 1 or more gives 0 (always triggers).
+float randUtilsPS::getGapScale(uint32_t hits, uint32_t basis) {
+    if( hits >= basis ) {
+        return 0;
+    } else if( hits == 0 ) {
+        return INFINITY;
+    }
+    return -1.0 / log(1.0 - (double)hits / basis);
+}
+
+//Returns a random number of things to skip before the next one triggers, using a scale from getGapScale()
+//ie with a gap of 3, the next 3 things don't trigger, but the fourth one does
+//The gap follows a geometric distribution, found by inverting a uniform random number: floor(-ln(u) * gapScale)
+//Gaps too large to fit in 32 bits (including gaps that never trigger) are capped at 0xFFFFFFFF
+uint32_t randUtilsPS::randGap(randStreamPS &randStream, float gapScale) {
+    if( gapScale == 0 ) {
+        return 0;
+    }
+
+    //A 24 bit uniform random number from (0, 1], (a float's mantissa is 24 bits)
+    float uniform = ((rand32(randStream) >> 8) + 1) / 16777216.0;
+    float gap = -log(uniform) * gapScale;
+
+    //(also catches NaN's, which fail every comparison)
+    if( !(gap < 4294967040.0) ) {
+        return 0xFFFFFFFF;
+    }
+    return gap;
+}
+
+//Sets up a random permutation of the numbers 0 to length - 1 (see randPermPS.h)
+//The network's range is the smallest power of 4 that fits the length (with a min of 4),
+//with each half of an index having halfBits bits
+//Each of the 4 rounds gets a random 8 bit key, all drawn from a single generator step
+void randUtilsPS::setupPerm(randStreamPS &randStream, randPermPS &randPerm, uint16_t length) {
+    randPerm.length = length;
+
+    randPerm.halfBits = 1;
+    while( ((uint32_t)1 << (randPerm.halfBits * 2)) < length ) {
+        randPerm.halfBits++;
+    }
+
+    uint32_t randWord = rand32(randStream);
+    for( uint8_t i = 0; i < 4; i++ ) {
+        randPerm.keys[i] = randWord >> (i * 8);
+    }
+}
+
+//Returns the shuffled value for an index in a permutation (the index should be from 0 to length - 1)
+//Any output outside the length is passed through the network again until it is in range (cycle walking)
+//Because the network has no repeats, this always lands on a value that no other index maps to
+uint16_t randUtilsPS::getPermVal(randPermPS &randPerm, uint16_t index) {
+    do {
+        index = permRound(randPerm, index);
+    } while( index >= randPerm.length );
+
+    return index;
+}
+
+//Passes a value through the permutation's Feistel network once
+//For each round, the right half is scrambled with the round's key and mixed into the left half,
+//then the halves are swapped. Since the right half is passed through unchanged, each round can be undone,
+//so the network never maps two values to the same output.
+uint16_t randUtilsPS::permRound(randPermPS &randPerm, uint16_t val) {
+    uint8_t halfMask = (1 << randPerm.halfBits) - 1;
+    uint8_t left = val >> randPerm.halfBits;
+    uint8_t right = val & halfMask;
+    uint8_t mix, temp;
+
+    for( uint8_t i = 0; i < 4; i++ ) {
+        mix = (right ^ randPerm.keys[i]) * 167 + 13;
+        mix ^= mix >> 4;
+        mix *= 73;
+        temp = right;
+        right = (left ^ mix) & halfMask;
+        left = temp;
+    }
+
+    return ((uint16_t)left << randPerm.halfBits) | right;
+}
\ No newline at end of file
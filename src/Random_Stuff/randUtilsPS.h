@@ -0,0 +1,58 @@
+#ifndef randUtilsPS_h
+#define randUtilsPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "FastLED.h"
+#include "randStreamPS.h"
+#include "randPermPS.h"
+
+/*
+Functions for drawing random numbers from a randStreamPS (see randStreamPS.h).
+The ranged functions work the same way as FastLED's, 
+ie rand8(randStream, lim) is the same as random8(lim), returning a number from 0 up to (but not including) lim,
+and rand8(randStream, min, lim) is the same as random8(min, lim), returning a number from min up to lim. 
+The fill functions fill whole arrays of random bytes at once, 4 bytes per generator step.
+
+The gap functions are for effects that give a large set of things (pixels, lines, etc) the same small chance of triggering each update.
+Rather than rolling for every thing, you can draw the number of things to skip before the next one triggers (a geometric distribution).
+Get a gap scale for the trigger chance using getGapScale(), and then draw the gaps using randGap(). 
+The skipped things have the same odds as if you'd rolled for each of them, but you only need one roll per trigger.
+
+The permutation functions are for visiting a set of things in a random order without repeats (see randPermPS.h). */
+namespace randUtilsPS {
+
+    void
+        seedStream(randStreamPS &randStream, uint32_t seed),
+        fillRand8(randStreamPS &randStream, uint8_t *arr, uint16_t length),
+        fillRand8(randStreamPS &randStream, uint8_t *arr, uint16_t length, uint8_t lim),
+        fillRand8(randStreamPS &randStream, uint8_t *arr, uint16_t length, uint8_t min, uint8_t lim),
+        setupPerm(randStreamPS &randStream, randPermPS &randPerm, uint16_t length);
+
+    uint8_t
+        rand8(randStreamPS &randStream),
+        rand8(randStreamPS &randStream, uint8_t lim),
+        rand8(randStreamPS &randStream, uint8_t min, uint8_t lim);
+
+    uint16_t
+        rand16(randStreamPS &randStream),
+        rand16(randStreamPS &randStream, uint16_t lim),
+        rand16(randStreamPS &randStream, uint16_t min, uint16_t lim),
+        getPermVal(randPermPS &randPerm, uint16_t index),
+        permRound(randPermPS &randPerm, uint16_t val);
+
+    uint32_t
+        rand32(randStreamPS &randStream),
+        randGap(randStreamPS &randStream, float gapScale);
+
+    float
+        getGapScale(uint32_t hits, uint32_t basis);
+};
+
+#endif
@@ -16,7 +16,7 @@ SegmentSetPS::SegmentSetPS(struct CRGB *Leds, uint16_t LedArrSize, SegmentPS **S
 
 //destructor
 SegmentSetPS::~SegmentSetPS(){
-    free(segProgLengths);
+    memUtilsPS::freePS(segProgLengths);
 }
 
 //Changes a segment in the set 
@@ -72,8 +72,8 @@ void SegmentSetPS::setNumLeds(void) {
 void SegmentSetPS::setProgLengthArr(){
     if( alwaysResizeObj_PS || (numSegs > maxNumSegs) ) {
         maxNumSegs = numSegs;
-        free(segProgLengths);
-        segProgLengths = (uint16_t *)malloc((maxNumSegs) * sizeof(uint16_t));
+        memUtilsPS::freePS(segProgLengths);
+        segProgLengths = (uint16_t *)memUtilsPS::allocPS((maxNumSegs) * sizeof(uint16_t));
     }
 
     uint16_t lengthSoFar = 0;
@@ -6,6 +6,7 @@
 #include "SegmentPS.h"
 #include "Palette_Stuff/PaletteList/paletteListPS.h"
 #include "MathUtils/mathUtilsPS.h"
+#include "Memory_Stuff/memUtilsPS.h"
 #include "./Include_Lists/GlobalVars/GlobalVars.h"  //need alwaysResizeObj_PS
 
 //TODO:
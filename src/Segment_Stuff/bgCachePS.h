@@ -0,0 +1,75 @@
+#ifndef bgCachePS_h
+#define bgCachePS_h
+
+//need to include arduino here to get it to compile
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+    #include "WConstants.h"
+#endif
+
+#include "FastLED.h"
+#include "SegmentSetPS.h"
+#include "segLayoutPS.h"
+
+//Effects use a background cache by default, except on AVR chips, where the cache's 5 bytes per pixel are a large chunk of memory
+//You can override this for all effects by defining BG_USE_CACHE_PS in a build flag
+#ifndef BG_USE_CACHE_PS
+    #ifdef __AVR__
+        #define BG_USE_CACHE_PS false
+    #else
+        #define BG_USE_CACHE_PS true
+    #endif
+#endif
+
+/*
+A struct for caching an effect's background, so that effects that re-fill their background every update
+(ie with "fillBg" or "blend" turned on) don't need to work out the background color for every pixel each time.
+Filling a segment set with segDrawUtils::fillSegSetColor() looks up each pixel's physical address, and works out its color
+according to the background color mode. For most updates, none of this has changed since the last update,
+so instead, the background colors are cached alongside their physical pixel addresses, and copied straight back to the leds.
+
+The cache is re-built automatically by segDrawUtils::fillSegSetColorCached() whenever the background color, color mode,
+segment set brightness, or any of the segment set's gradient settings change (including its gradOffset and gradient palette colors).
+So color modes that shift over time (ie with the segment set's runOffset on, or color modes 4, 5, 9, and 10)
+will still be re-drawn whenever their colors change.
+Everything is checked exactly: the segment set's layout is stored in a segLayoutPS (see segLayoutPS.h),
+the gradient settings used by the color mode are stored in the cache, and the gradient palette's colors are copied after the cached colors.
+So the cache is never left with an old background.
+
+The cache uses 5 bytes of memory for each pixel in the segment set (2 for the pixel address and 3 for its color),
+plus 3 bytes per gradient palette color (for gradient color modes), so effects turn it off by default on AVR chips.
+
+You shouldn't need to set any of the struct's variables yourself, they are managed by segDrawUtils::fillSegSetColorCached().
+Like with other structs, it must be initialized with its pointers set to null:
+    bgCachePS bgCache = {}; //Must init structs w/ pointers set to null for safety
+!!The cache is created dynamically, so make sure you free it when you're done by calling 
+memUtilsPS::freePS(bgCache.pixelArr) and memUtilsPS::freePS(bgCache.segLayout.segPtrArr).
+(the colorArr and paletteColors share their memory with the pixelArr, so they do not need to be freed) */
+struct bgCachePS {
+    uint16_t *pixelArr;        //the physical address of each pixel in the segment set (in segment set order)
+    CRGB *colorArr;            //the cached background color for each pixel (stored in the same memory block as the pixelArr)
+    CRGB *paletteColors;       //a copy of the gradient palette's colors (stored after the colorArr, only used for gradient color modes)
+    uint16_t length;           //the number of cached pixels
+    uint16_t maxLength;        //The total length of the pixel and color arrays, used for memory management (see patternPS for more)
+    uint8_t maxPaletteLength;  //The total length of the paletteColors array, used for memory management
+    segLayoutPS segLayout;     //the segment set layout the cache was built for (see segLayoutPS.h)
+    palettePS *gradPalette;    //the segment set's gradient palette when the cache was built (only used for gradient color modes)
+    uint8_t paletteLength;     //the length of the gradient palette when the cache was built (only used for gradient color modes)
+    uint16_t gradLenVal;       //the segment set's gradient settings when the cache was built (only used for color modes other than 0)
+    uint16_t gradSegVal;
+    uint16_t gradLineVal;
+    uint16_t gradOffsetMax;    //only used for gradient color modes
+    uint16_t gradOffset;       //the segment set's gradOffset when the cache was built
+    uint8_t sat;               //the segment set's rainbow sat and val when the cache was built (only used for rainbow color modes)
+    uint8_t val;
+    uint8_t gradStep;          //the time step when the cache was built (only used for color modes 4, 5, 9, and 10)
+    uint8_t brightness;        //the segment set's brightness when the cache was built
+    uint8_t colorMode;         //the background color mode the cache was built with
+    CRGB bgColor;              //the background color the cache was built with
+    bool valid;                //true once the cache has been built
+};
+
+#endif
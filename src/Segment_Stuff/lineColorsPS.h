@@ -0,0 +1,33 @@
+#ifndef lineColorsPS_h
+#define lineColorsPS_h
+
+//need to include arduino here to get it to compile
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+    #include "WConstants.h"
+#endif
+
+#include "FastLED.h"
+
+/*
+A struct for storing one color per segment line, so that the colors can be broadcast to the segment set in one pass
+using segDrawUtils::drawLineColors().
+Many segment line effects pick a single color for each line, and then color every pixel on the line
+using getPixelNumFromLineNum(). This looks up every pixel from scratch, walking through the segment's sections each time.
+Instead, an effect can fill in a lineColorsPS with its line colors, and then have drawLineColors() walk
+each segment's sections once, coloring each pixel with its line's color.
+
+The colorArr is sized using segDrawUtils::resizeLineColors(), usually to the segment set's numLines.
+Like with other structs, it must be initialized with its pointers set to null:
+    lineColorsPS lineColors = {nullptr, 0, 0}; //Must init structs w/ pointers set to null for safety
+!!The colorArr is created dynamically, so make sure you free() it when you're done by calling memUtilsPS::freePS(lineColors.colorArr). */
+struct lineColorsPS {
+    CRGB *colorArr;      //pointer to the color array, one color per line
+    uint16_t length;     //the number of lines
+    uint16_t maxLength;  //The total length of the colorArr, used for memory management (see patternPS for more)
+};
+
+#endif
@@ -168,6 +168,179 @@ void segDrawUtils::fillSegLengthColor(SegmentSetPS &SegSet, uint16_t segNum, uin
     }
 }
 
+//Fills an entire segment set with a color like fillSegSetColor(), but using a background cache (see bgCachePS.h)
+//If the color, colorMode, and segment set settings are the same as the last time the cache was built,
+//the cached colors are copied straight to their pixels, skipping the pixel look up and color mode calculations.
+//Otherwise the segment set is filled normally, and the resulting colors are stored in the cache.
+//The cache's pixel addresses are re-built if the segment set's layout changes (or if you switch segment sets).
+//All the settings are compared exactly (see bgCachePS.h), so the cache is never left with an old background.
+//Note that the segment set's gradOffset is still updated as usual.
+void segDrawUtils::fillSegSetColorCached(SegmentSetPS &SegSet, bgCachePS &bgCache, const CRGB &color, uint8_t colorMode) {
+    uint16_t totalLength = 0,
+             segLength;
+    uint8_t gradStep = 0,
+            paletteLength = 0;
+    bool layoutChanged;
+
+    //getPixelColor() treats any color mode over 10 as mode 0
+    if( colorMode > 10 ) {
+        colorMode = 0;
+    }
+
+    //Gradient color modes (6 - 10) use the segment set's gradient palette, 
+    //so we need room to store a copy of its colors
+    if( colorMode > 5 ) {
+        paletteLength = SegSet.gradPalette->length;
+    }
+
+    layoutChanged = updateSegLayout(SegSet, bgCache.segLayout);
+
+    //Re-build the pixel address list if the segment set or its layout has changed,
+    //or if we need more room for the palette colors
+    if( layoutChanged || !bgCache.pixelArr || paletteLength > bgCache.maxPaletteLength ) {
+        //The total number of pixels in the segment set (including all the pixels of single segments)
+        for( uint16_t i = 0; i < SegSet.numSegs; i++ ) {
+            totalLength += SegSet.getTotalSegLength(i);
+        }
+
+        //The pixel addresses, colors, and palette colors are stored in the same memory block,
+        //with the colors after the addresses, and the palette colors after the colors
+        if( alwaysResizeObj_PS || (totalLength > bgCache.maxLength) || (paletteLength > bgCache.maxPaletteLength) ) {
+            memUtilsPS::freePS(bgCache.pixelArr);
+            if( alwaysResizeObj_PS || (totalLength > bgCache.maxLength) ) {
+                bgCache.maxLength = totalLength;
+            }
+            if( alwaysResizeObj_PS || (paletteLength > bgCache.maxPaletteLength) ) {
+                bgCache.maxPaletteLength = paletteLength;
+            }
+            bgCache.pixelArr = (uint16_t *)memUtilsPS::allocPS(bgCache.maxLength * (sizeof(uint16_t) + sizeof(CRGB)) +
+                                                                bgCache.maxPaletteLength * sizeof(CRGB));
+        }
+        bgCache.colorArr = (CRGB *)(bgCache.pixelArr + bgCache.maxLength);
+        bgCache.paletteColors = bgCache.colorArr + bgCache.maxLength;
+
+        //Get the physical address of each pixel, skipping any dummy pixels
+        bgCache.length = 0;
+        for( uint16_t i = 0; i < SegSet.numSegs; i++ ) {
+            segLength = SegSet.getTotalSegLength(i);
+            for( uint16_t j = 0; j < segLength; j++ ) {
+                pixelNum = getSegmentPixel(SegSet, i, j);
+                if( pixelNum != D_LED_PS ) {
+                    bgCache.pixelArr[bgCache.length] = pixelNum;
+                    bgCache.length++;
+                }
+            }
+        }
+
+        bgCache.valid = false;
+    }
+
+    //For any color mode other than 0, the colors depend on the segment set's gradient settings
+    //We also need to keep the gradOffset updating, which would normally happen in getPixelColor(),
+    //and for color modes 4, 5, 9, and 10, get the current time step (see getPixelColor())
+    if( colorMode != 0 ) {
+        setGradOffset(SegSet, (colorMode < 6) ? 256 : SegSet.gradOffsetMax);
+        if( colorMode == 4 || colorMode == 5 || colorMode == 9 || colorMode == 10 ) {
+            gradStep = mod16PS(millis() / (*SegSet.offsetRate), 256);
+        }
+    }
+
+    //If nothing has changed, we can just copy the cached colors to the pixels
+    if( bgCache.valid && bgCache.colorMode == colorMode && bgCache.bgColor == color &&
+        bgCache.brightness == SegSet.brightness && bgCache.gradOffset == SegSet.gradOffset &&
+        bgCache.gradStep == gradStep && bgCacheGradMatches(SegSet, bgCache, colorMode) ) {
+        for( uint16_t i = 0; i < bgCache.length; i++ ) {
+            SegSet.leds[bgCache.pixelArr[i]] = bgCache.colorArr[i];
+        }
+        return;
+    }
+
+    //Otherwise, fill the segment set normally and then store the colors in the cache
+    //(the colors already have the segment set's brightness applied)
+    fillSegSetColor(SegSet, color, colorMode);
+    for( uint16_t i = 0; i < bgCache.length; i++ ) {
+        bgCache.colorArr[i] = SegSet.leds[bgCache.pixelArr[i]];
+    }
+
+    bgCache.colorMode = colorMode;
+    bgCache.bgColor = color;
+    bgCache.brightness = SegSet.brightness;
+    bgCache.gradOffset = SegSet.gradOffset;
+    bgCache.gradStep = gradStep;
+    bgCache.gradLenVal = SegSet.gradLenVal;
+    bgCache.gradSegVal = SegSet.gradSegVal;
+    bgCache.gradLineVal = SegSet.gradLineVal;
+    bgCache.gradOffsetMax = SegSet.gradOffsetMax;
+    bgCache.sat = SegSet.sat;
+    bgCache.val = SegSet.val;
+    bgCache.gradPalette = SegSet.gradPalette;
+    bgCache.paletteLength = paletteLength;
+    if( paletteLength > 0 ) {
+        paletteUtilsPS::copyPaletteColors(*SegSet.gradPalette, bgCache.paletteColors);
+    }
+    bgCache.valid = true;
+}
+
+//Returns true if the segment set's gradient settings used by the passed in color mode
+//match the settings stored in the background cache (see fillSegSetColorCached())
+//Color mode 0 doesn't use any gradient settings, rainbow modes (1 - 5) use the segment set's sat and val,
+//while gradient modes (6 - 10) use its gradient palette
+//(the gradOffset is checked separately in fillSegSetColorCached())
+bool segDrawUtils::bgCacheGradMatches(SegmentSetPS &SegSet, bgCachePS &bgCache, uint8_t colorMode) {
+    if( colorMode == 0 ) {
+        return true;
+    }
+
+    if( bgCache.gradLenVal != SegSet.gradLenVal || bgCache.gradSegVal != SegSet.gradSegVal ||
+        bgCache.gradLineVal != SegSet.gradLineVal ) {
+        return false;
+    }
+
+    if( colorMode < 6 ) {
+        return bgCache.sat == SegSet.sat && bgCache.val == SegSet.val;
+    }
+
+    return bgCache.gradOffsetMax == SegSet.gradOffsetMax && bgCache.gradPalette == SegSet.gradPalette &&
+           bgCache.paletteLength == SegSet.gradPalette->length &&
+           paletteUtilsPS::paletteColorsMatch(*SegSet.gradPalette, bgCache.paletteColors);
+}
+
+//Checks if the segment set's layout (its segments and their directions) matches the passed in segLayoutPS (see segLayoutPS.h)
+//If it doesn't, the segment set's layout is saved to the segLayoutPS, and we return true
+//The layout arrays are only re-allocated if they need to grow, unless alwaysResizeObj_PS is true
+bool segDrawUtils::updateSegLayout(SegmentSetPS &SegSet, segLayoutPS &segLayout) {
+    uint16_t numSegs = SegSet.numSegs;
+
+    //Check the layout segment by segment, stopping at the first difference
+    if( segLayout.segPtrArr && segLayout.segSet == &SegSet && segLayout.numSegs == numSegs ) {
+        uint16_t i = 0;
+        for( ; i < numSegs; i++ ) {
+            if( segLayout.segPtrArr[i] != SegSet.getSegPtr(i) || segLayout.directArr[i] != SegSet.getSegDirection(i) ) {
+                break;
+            }
+        }
+        if( i == numSegs ) {
+            return false;
+        }
+    }
+
+    //The segment pointers and directions are stored in the same memory block, with the directions after the pointers
+    if( alwaysResizeObj_PS || !segLayout.segPtrArr || (numSegs > segLayout.maxNumSegs) ) {
+        memUtilsPS::freePS(segLayout.segPtrArr);
+        segLayout.segPtrArr = (SegmentPS **)memUtilsPS::allocPS(numSegs * (sizeof(SegmentPS *) + sizeof(bool)));
+        segLayout.maxNumSegs = numSegs;
+    }
+    segLayout.directArr = (bool *)(segLayout.segPtrArr + segLayout.maxNumSegs);
+
+    for( uint16_t i = 0; i < numSegs; i++ ) {
+        segLayout.segPtrArr[i] = SegSet.getSegPtr(i);
+        segLayout.directArr[i] = SegSet.getSegDirection(i);
+    }
+    segLayout.segSet = &SegSet;
+    segLayout.numSegs = numSegs;
+    return true;
+}
+
 //Fills in a length of a segment set in a color, using a start and end pixel
 //pixel numbers are local to the segment set, not the global pixel numbers. Ie 5th through 8th pixel in the segment set
 //(starting from 0)
@@ -255,6 +428,100 @@ void segDrawUtils::drawSegLineSection(SegmentSetPS &SegSet, uint16_t startSeg, u
     }
 }
 
+//Sizes the colorArr of a lineColorsPS to hold a color for "numLines" lines (usually the segment set's numLines)
+//Like other library objects, the colorArr is only re-allocated if it needs to grow, unless alwaysResizeObj_PS is true
+void segDrawUtils::resizeLineColors(lineColorsPS &lineColors, uint16_t numLines) {
+    if( alwaysResizeObj_PS || (numLines > lineColors.maxLength) ) {
+        memUtilsPS::freePS(lineColors.colorArr);
+        lineColors.colorArr = (CRGB *)memUtilsPS::allocPS(numLines * sizeof(CRGB));
+        lineColors.maxLength = numLines;
+    }
+    lineColors.length = numLines;
+}
+
+//Draws the line colors from a lineColorsPS onto the whole segment set (see blended version below)
+void segDrawUtils::drawLineColors(SegmentSetPS &SegSet, lineColorsPS &lineColors, uint16_t lineOffset, bool reverse) {
+    drawLineColors(SegSet, lineColors, lineOffset, reverse, 255);
+}
+
+//Draws the line colors from a lineColorsPS onto the whole segment set, coloring each pixel with the color of its line.
+//The color at lineColors.colorArr[i] is drawn on line (i + lineOffset) % numLines,
+//or, if "reverse" is true, on line (numLines - i - 1 + lineOffset) % numLines.
+//If "blendAmount" is less than 255, the line colors are blended into the existing pixel colors by that amount (using nblend).
+//The segment set's brightness is also applied, like with setPixelColor().
+//Instead of looking up every pixel with getPixelNumFromLineNum(), we walk through each segment's sections once,
+//working out each pixel's line as we go, which makes this much faster than drawing each line separately.
+//For segments shorter than the number of lines, a pixel may be on multiple lines,
+//in which case it will take the color of the highest line (the same one getLineNumFromPixelNum() would give).
+void segDrawUtils::drawLineColors(SegmentSetPS &SegSet, lineColorsPS &lineColors, uint16_t lineOffset, bool reverse, uint8_t blendAmount) {
+    uint16_t numLinesCol = lineColors.length;
+    if( numLinesCol == 0 || !lineColors.colorArr ) {
+        return;
+    }
+
+    //we subtract the offset from each pixel's line to get the color's index,
+    //so we pre-calculate the inverse of the offset to use with addMod16PS()
+    uint16_t offsetInv = numLinesCol - (lineOffset % numLinesCol);
+    uint16_t segLength, segPixelNum, colorIndex;
+    uint8_t secNum;
+    bool contSec;
+
+    for( uint16_t i = 0; i < SegSet.numSegs; i++ ) {
+        segLength = SegSet.getTotalSegLength(i);
+        numSec = SegSet.getTotalNumSec(i);
+        segDirection = SegSet.getSegDirection(i);
+        contSec = SegSet.getSecContArrPtr(i);
+        segPixelNum = 0;
+
+        //Walk through the sections in the same order as getSegmentPixel() does,
+        //so that segPixelNum always matches the pixel's location in the segment
+        for( uint8_t j = 0; j < numSec; j++ ) {
+            secNum = segDirection ? j : numSec - j - 1;
+            secLength = SegSet.getSecLength(i, secNum);         //sec length can be negative
+            secLengthSign = (secLength > 0) - (secLength < 0);  //either 1 or -1
+            secLength = secLength * secLengthSign;              //get the positive version of secLength
+            if( contSec ) {
+                secStartPixel = SegSet.getSecStartPixel(i, secNum);
+            }
+
+            for( int16_t k = 0; k < secLength; k++ ) {
+                //For reversed segments, we count from the end of the section
+                pixelLocNum = segDirection ? k : secLength - k - 1;
+                if( contSec ) {
+                    pixelNum = secStartPixel + secLengthSign * pixelLocNum;
+                } else {
+                    pixelNum = SegSet.getSecMixPixel(i, secNum, pixelLocNum);
+                }
+
+                //Get the highest line that maps to the pixel
+                //(this is the inverse of the getPixelNumFromLineNum() formula)
+                if( segLength == numLinesCol ) {
+                    lineNum = segPixelNum;
+                } else {
+                    lineNum = ((uint32_t)(segPixelNum + 1) * numLinesCol - 1) / segLength;
+                }
+                segPixelNum++;
+
+                if( pixelNum == D_LED_PS ) {
+                    continue;  //if we are given a dummy pixel don't try to color it
+                }
+
+                colorIndex = addMod16PS(lineNum, offsetInv, numLinesCol);
+                if( reverse ) {
+                    colorIndex = numLinesCol - colorIndex - 1;
+                }
+
+                if( blendAmount == 255 ) {
+                    SegSet.leds[pixelNum] = lineColors.colorArr[colorIndex];
+                } else {
+                    nblend(SegSet.leds[pixelNum], lineColors.colorArr[colorIndex], blendAmount);
+                }
+                handleBri(SegSet, pixelNum);
+            }
+        }
+    }
+}
+
 //This function is the basis for 2D segment sets.
 //Will return a pixel such that you can draw a "straight" line across all segments, using the longest segment as the basis.
 //The pixels are mapped to the closest line, so some pixels may exist in multiple lines.
@@ -11,6 +11,9 @@
 #include "SegmentPS.h"
 #include "SegmentSetPS.h"
 #include "pixelInfoPS.h"
+#include "lineColorsPS.h"
+#include "segLayoutPS.h"
+#include "bgCachePS.h"
 #include "ColorUtils/colorUtilsPS.h"
 #include "Include_Lists/PaletteFiles.h"
 #include "MathUtils/mathUtilsPS.h"
@@ -36,10 +39,21 @@ namespace segDrawUtils {
         fillSegLengthColor(SegmentSetPS &SegSet, uint16_t segNum, uint16_t startSegPixel, uint16_t endPixel, const CRGB &color, uint8_t colorMode),
         fillSegSetLengthColor(SegmentSetPS &SegSet, uint16_t startSegPixel, uint16_t endPixel, const CRGB &color, uint8_t colorMode);
 
+    void  //Functions for filling a segment set's background using a cache (see bgCachePS.h)
+        fillSegSetColorCached(SegmentSetPS &SegSet, bgCachePS &bgCache, const CRGB &color, uint8_t colorMode);
+    bool
+        bgCacheGradMatches(SegmentSetPS &SegSet, bgCachePS &bgCache, uint8_t colorMode),
+        updateSegLayout(SegmentSetPS &SegSet, segLayoutPS &segLayout);
+
     void  //Functions for drawing segment lines
         drawSegLine(SegmentSetPS &SegSet, uint16_t lineNum, const CRGB &color, uint8_t colorMode),
         drawSegLineSection(SegmentSetPS &SegSet, uint16_t startSeg, uint16_t endSeg, uint16_t lineNum, const CRGB &color, uint8_t colorMode);
 
+    void  //Functions for broadcasting a color per line to the whole segment set (see lineColorsPS.h)
+        resizeLineColors(lineColorsPS &lineColors, uint16_t numLines),
+        drawLineColors(SegmentSetPS &SegSet, lineColorsPS &lineColors, uint16_t lineOffset, bool reverse),
+        drawLineColors(SegmentSetPS &SegSet, lineColorsPS &lineColors, uint16_t lineOffset, bool reverse, uint8_t blendAmount);
+
     void  //Functions for setting the color of single pixels, for different levels of knowledge about where your pixel is
         setPixelColor(SegmentSetPS &SegSet, uint16_t segSetPixelNum, const CRGB &color, uint8_t colorMode),
         setPixelColor(SegmentSetPS &SegSet, uint16_t segPixelNum, const CRGB &color, uint8_t colorMode, uint16_t segNum),
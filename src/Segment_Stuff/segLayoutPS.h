@@ -0,0 +1,40 @@
+#ifndef segLayoutPS_h
+#define segLayoutPS_h
+
+//need to include arduino here to get it to compile
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+    #include "WConstants.h"
+#endif
+
+#include "SegmentPS.h"
+#include "SegmentSetPS.h"
+
+/*
+A struct for storing a copy of a segment set's layout (its segments and their directions),
+so that things built from the layout (like a background cache or a line map) can tell if it has changed.
+The layout is compared exactly, segment by segment, so any change is always caught, including:
+    * Swapping a segment in the set (ie with setSegment()).
+    * Changing a segment's direction, even if it's done through another segment set that shares the segment,
+      or by setting the segment's "direct" directly.
+    * Switching to a different segment set, or changing the number of segments.
+Since the segments' sections are stored in PROGMEM they can't change, so the segment pointers cover them.
+Checking the layout takes one comparison per segment, which is much less than re-building per-pixel data.
+
+Use segDrawUtils::updateSegLayout() to check the layout, it returns true if the layout has changed (and saves the new one).
+Like with other structs, it must be initialized with its pointers set to null:
+    segLayoutPS segLayout = {}; //Must init structs w/ pointers set to null for safety
+!!The layout is stored dynamically, so make sure you free it when you're done by calling memUtilsPS::freePS(segLayout.segPtrArr).
+(the directArr shares its memory with the segPtrArr, so it does not need to be freed) */
+struct segLayoutPS {
+    SegmentPS **segPtrArr;  //the segment set's segment pointers
+    bool *directArr;        //the direction of each segment (stored in the same memory block as the segPtrArr)
+    SegmentSetPS *segSet;   //the segment set the layout was saved from
+    uint16_t numSegs;       //the number of segments in the layout
+    uint16_t maxNumSegs;    //The total length of the layout arrays, used for memory management (see patternPS for more)
+};
+
+#endif
@@ -20,7 +20,7 @@ AddGlitterPS::AddGlitterPS(SegmentSetPS &SegSet, CRGB GlitterColor, uint16_t Gli
 }
 
 AddGlitterPS::~AddGlitterPS() {
-    free(glitterLocs);
+    memUtilsPS::freePS(glitterLocs);
 }
 
 //creates an array of glitter locations of length newNum
@@ -32,8 +32,8 @@ void AddGlitterPS::setGlitterNum(uint16_t newGlitterNum) {
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || (newGlitterNum > glitterNumMax) ) {
         glitterNumMax = newGlitterNum;
-        free(glitterLocs);
-        glitterLocs = (uint16_t *)malloc(glitterNumMax * sizeof(uint16_t));
+        memUtilsPS::freePS(glitterLocs);
+        glitterLocs = (uint16_t *)memUtilsPS::allocPS(glitterNumMax * sizeof(uint16_t));
     }
 
     fillGlitterArr();
@@ -0,0 +1,182 @@
+#include "AudioAnalyzerPS.h"
+
+AudioAnalyzerPS::AudioAnalyzerPS(audioSourcePS &AudioSource, uint16_t FFTLength, uint8_t NumBands, uint8_t NumSlots, uint16_t Rate)
+    : audioSource(&AudioSource)  //
+{
+    bindClassRatesPS();
+    audioUtilsPS::resizeFFT(audioFFT, FFTLength);
+    setNumBands(NumBands);
+    setNumSlots(NumSlots);
+}
+
+AudioAnalyzerPS::~AudioAnalyzerPS() {
+    memUtilsPS::freePS(audioFFT.sampleArr);
+    memUtilsPS::freePS(slotArr);
+    memUtilsPS::freePS(bandLevelArr);
+    memUtilsPS::freePS(bandEdgeArr);
+    memUtilsPS::freePS(bandEnvArr);
+}
+
+//Sets the audio source for the utility (see audioSourcePS.h)
+void AudioAnalyzerPS::setAudioSource(audioSourcePS &newSource) {
+    audioSource = &newSource;
+}
+
+//Sets the FFT length (rounded down to a power of 2, see audioFFTPS.h)
+//Since the bands are spread across the FFT's bins, we also need to re-set up the bands
+void AudioAnalyzerPS::setFFTLength(uint16_t newLength) {
+    audioUtilsPS::resizeFFT(audioFFT, newLength);
+    setNumBands(numBands);
+}
+
+//Sets the number of frequency bands, re-calculating the band edges and resetting the band levels
+//The number of bands is capped so that each band has at least one FFT bin
+//Also sets the number of beat bands to 1/4 of the bands (min of 1)
+//The band arrays are only re-sized if they need to be larger (to help prevent memory fragmentation)
+void AudioAnalyzerPS::setNumBands(uint8_t newNumBands) {
+    numBands = constrain(newNumBands, 1, audioFFT.length / 2 - 1);
+
+    if( alwaysResizeObj_PS || (numBands > maxNumBands) ) {
+        maxNumBands = numBands;
+
+        memUtilsPS::freePS(bandLevelArr);
+        memUtilsPS::freePS(bandEdgeArr);
+        memUtilsPS::freePS(bandEnvArr);
+
+        bandLevelArr = (uint8_t *)memUtilsPS::allocPS(numBands * sizeof(uint8_t));
+        bandEdgeArr = (uint16_t *)memUtilsPS::allocPS((numBands + 1) * sizeof(uint16_t));
+        bandEnvArr = (uint16_t *)memUtilsPS::allocPS(numBands * sizeof(uint16_t));
+    }
+
+    audioUtilsPS::setupBands(bandEdgeArr, numBands, audioFFT.length);
+
+    for( uint8_t i = 0; i < numBands; i++ ) {
+        bandLevelArr[i] = 0;
+        bandEnvArr[i] = 0;
+    }
+
+    beatBands = maxPS(numBands / 4, 1);
+    beatLevel = 0;
+    avgRise = 0;
+}
+
+//Sets the number of parameter slots (see audioSlotPS.h)
+//Any existing slots are kept, while new slots are set to follow the overall level from 0 to 255
+//The slot array is only re-sized if it needs to be larger (to help prevent memory fragmentation)
+//!!If the slot array is re-sized, any settings bound to the slots must be re-bound
+void AudioAnalyzerPS::setNumSlots(uint8_t newNumSlots) {
+    if( alwaysResizeObj_PS || (newNumSlots > maxNumSlots) ) {
+        audioSlotPS *newSlotArr = (audioSlotPS *)memUtilsPS::allocPS(newNumSlots * sizeof(audioSlotPS));
+        for( uint8_t i = 0; i < minPS(numSlots, newNumSlots); i++ ) {
+            newSlotArr[i] = slotArr[i];
+        }
+        memUtilsPS::freePS(slotArr);
+        slotArr = newSlotArr;
+        maxNumSlots = newNumSlots;
+    }
+
+    for( uint8_t i = numSlots; i < newNumSlots; i++ ) {
+        slotArr[i] = {0, 0, 0, 255, 0, 0};
+    }
+    numSlots = newNumSlots;
+}
+
+//Sets up a parameter slot, see audioSlotPS.h for the source types
+//The slot's value is updated right away, using the current outputs
+void AudioAnalyzerPS::setSlot(uint8_t slotNum, uint8_t sourceType, uint8_t sourceIndex, uint16_t outMin, uint16_t outMax) {
+    if( slotNum >= numSlots ) {
+        return;
+    }
+
+    slotArr[slotNum].sourceType = sourceType;
+    slotArr[slotNum].sourceIndex = sourceIndex;
+    slotArr[slotNum].outMin = outMin;
+    slotArr[slotNum].outMax = outMax;
+    updateSlots();
+}
+
+//Updates the utility
+//How it works:
+//Each update we read any new samples from the audio source into the FFT's sample buffer,
+//then run the FFT on the most recent samples (see audioUtilsPS::runFFT()).
+//For each band, we add up the magnitudes of its FFT bins, and convert the total into a 0 - 255 level
+//using a log scale (so each doubling of the audio is the same step up).
+//These "raw" levels jump around a lot, so we smooth them using envelope followers,
+//which rise at the "attack" speed, and fall at the "release" speed.
+//The overall level is worked out the same way, using the total magnitude of all the bands.
+//We also work out a raw level for the lowest "beatBands" bands together, which is used to detect beats (see detectBeat()).
+//Finally, the results are mapped to the parameter slots.
+//If there are no new samples, we skip the update, since nothing has changed
+void AudioAnalyzerPS::update() {
+    currentTime = millis();
+
+    if( active && (currentTime - prevTime) >= *rate ) {
+        prevTime = currentTime;
+
+        if( audioUtilsPS::pushSamples(*audioSource, audioFFT) == 0 ) {
+            return;
+        }
+
+        audioUtilsPS::runFFT(audioFFT);
+
+        totalMag = 0;
+        for( uint8_t i = 0; i < numBands; i++ ) {
+            bandMag = audioUtilsPS::getBandMag(audioFFT, bandEdgeArr[i], bandEdgeArr[i + 1]);
+            totalMag += bandMag;
+
+            //Once we've passed the beat bands, the total is the beat bands' magnitude
+            if( i + 1 == beatBands ) {
+                rawLevel = audioUtilsPS::getLogLevel(audioUtilsPS::getLog2(totalMag), noiseFloor, dynRange);
+                beatRise = qSubA_PS(rawLevel, beatLevel);
+                beatLevel = rawLevel;
+            }
+
+            rawLevel = audioUtilsPS::getLogLevel(audioUtilsPS::getLog2(bandMag), noiseFloor, dynRange);
+            bandLevelArr[i] = audioUtilsPS::followEnv(bandEnvArr[i], rawLevel, attack, release);
+        }
+
+        rawLevel = audioUtilsPS::getLogLevel(audioUtilsPS::getLog2(totalMag), noiseFloor, dynRange);
+        level = audioUtilsPS::followEnv(levelEnv, rawLevel, attack, release);
+
+        detectBeat();
+        updateSlots();
+    }
+}
+
+//Checks if the latest rise in the beat bands' level (beatRise) is a beat
+//A beat is a rise that is beatThresh/16 times larger than the average rise, and at least beatMinRise
+//Beats must also be at least beatMinTime apart.
+//The average rise is tracked with 8 bits of fraction, and moves 1/16 of the way to each new rise
+void AudioAnalyzerPS::detectBeat() {
+    beat = ( beatRise >= beatMinRise ) && 
+           ( ((uint32_t)beatRise << 12) > (uint32_t)avgRise * beatThresh ) &&
+           ( (currentTime - prevBeatTime) >= beatMinTime );
+
+    avgRise += (((int32_t)beatRise << 8) - avgRise) / 16;
+
+    if( beat ) {
+        prevBeatTime = currentTime;
+        beatCount++;
+        beatPulse = 255;
+    } else {
+        beatPulse = qsub8(beatPulse, beatDecay);
+    }
+}
+
+//Maps the outputs to each of the parameter slots, based on the slot's source type (see audioSlotPS.h)
+void AudioAnalyzerPS::updateSlots() {
+    for( uint8_t i = 0; i < numSlots; i++ ) {
+        switch( slotArr[i].sourceType ) {
+            case 0: default:
+                sourceVal = level;
+                break;
+            case 1:
+                sourceVal = (slotArr[i].sourceIndex < numBands) ? bandLevelArr[slotArr[i].sourceIndex] : 0;
+                break;
+            case 2:
+                sourceVal = beatPulse;
+                break;
+        }
+        audioUtilsPS::getSlotVal(slotArr[i], sourceVal);
+    }
+}
@@ -0,0 +1,188 @@
+#ifndef AudioAnalyzerPS_h
+#define AudioAnalyzerPS_h
+
+#include "Effects/EffectBasePS.h"
+#include "Audio_Stuff/audioUtilsPS.h"
+
+/*
+A utility for making effects react to audio. 
+The utility reads audio samples from a source (see audioSourcePS.h), and splits them into frequency bands using an FFT.
+It then tracks the level of each band (using envelope followers, so the levels rise and fall smoothly), 
+the overall level of the audio, and detects beats.
+The results are published to a set of "parameter slots" (see audioSlotPS.h), which each map one of the results 
+to a range of values. Because effect settings like "rate" are pointers, you can bind them straight to a slot's value,
+so the effect reacts to the audio without any extra code:
+    yourEffect.rate = &audioAnalyzer.slotArr[0].value;
+    //The line above binds an effect's "rate" setting to the value of the utility's first slot
+    //Because the effect's update "rate" is a pointer, we use "&" to bind it by address.
+    //For uint8_t pointer settings, like BreathPS's breathFreq, use the slot's value8 instead.
+Note that only pointer settings can be bound this way, for other settings you'll need to copy the slot value yourself.
+
+You can also read the results directly, using bandLevelArr[], level, beat, and beatPulse (see Outputs below).
+
+The utility does all its work in update(), so you should call it as often as the audio changes,
+ie every 10 - 20ms. Each update it reads any new samples from the source, and analyzes the most recent "fftLength" samples.
+If there are no new samples, the update is skipped.
+Everything uses integer math, so it's quick even without a floating point unit.
+On an ESP32 a 256 sample FFT with 8 bands takes well under 1ms, so it fits easily into a frame.
+(Make sure your source's readFn doesn't wait for samples, see audioSourcePS.h)
+
+Inputs Guide & Notes:
+    FFT Length:
+        The FFT length is the number of samples analyzed each update, it must be a power of 2 (8 - 1024).
+        A longer FFT gives finer frequency bands, but uses more memory (6 bytes per sample)
+        and reacts more slowly, since each update covers a longer stretch of audio.
+        For a sample rate of ~22kHz, a length of 256 (~12ms of audio) works well.
+    
+    Bands:
+        The FFT's frequencies are grouped into "numBands" bands, spaced logarithmically (see audioUtilsPS::setupBands()).
+        Band 0 is the lowest frequencies (bass), with the highest band being the treble.
+        The number of bands must be less than half the FFT length.
+
+    Levels:
+        Levels are measured logarithmically (each doubling of the audio is the same step up), 
+        and mapped from 0 to 255 between the "noiseFloor" and "noiseFloor + dynRange" (see Other Settings).
+        Both are in log2 units with 8 bits of fraction, ie 256 per doubling (~6dB).
+        If your levels are always low, lower the noise floor, if they're always maxed out, raise it.
+
+    Beats:
+        Beats are detected from sudden rises in the level of the lowest "beatBands" bands (the "onset" of a note or drum).
+        A beat is detected when the rise is more than "beatThresh" times the average rise (out of 16),
+        and at least "beatMinTime" has passed since the last beat.
+        On each beat, the beat flag is set, beatCount is increased, and beatPulse jumps to 255, fading out by beatDecay each update.
+        Make sure the noiseFloor is above any background noise (ie hiss from your microphone), 
+        otherwise random flickers in the noise can be detected as beats.
+
+Example calls: 
+    audioSourcePS audioSource = {nullptr, 0, 0, readI2S, nullptr}; //see audioSourcePS.h
+    AudioAnalyzerPS audioAnalyzer(audioSource, 256, 8, 2, 15);
+    Analyzes audio from an I2S microphone, using a 256 sample FFT, with 8 frequency bands, and 2 output slots.
+    The utility updates every 15ms.
+
+    audioAnalyzer.setSlot(0, 1, 0, 80, 10);
+    twinkleSL.rate = &audioAnalyzer.slotArr[0].value;
+    Sets the first slot to follow band 0 (the bass), with a value of 80 for silence, and 10 for full bass.
+    A twinkle effect's rate is bound to the slot, so it speeds up with the bass.
+
+    audioAnalyzer.setSlot(1, 2, 0, 60, 10);
+    breath.breathFreq = &audioAnalyzer.slotArr[1].value8;
+    Sets the second slot to follow the beat pulse, so a breath effect speeds up on each beat.
+
+Constructor Inputs:
+    audioSource -- The source of audio samples (see audioSourcePS.h). Can be changed later using setAudioSource().
+    fftLength -- The number of samples analyzed each update, must be a power of 2 (see Inputs Guide above).
+                 Can be changed later using setFFTLength().
+    numBands -- The number of frequency bands (see Inputs Guide above). Can be changed later using setNumBands().
+    numSlots -- The number of parameter slots (see audioSlotPS.h). Can be changed later using setNumSlots().
+    rate -- The update rate of the utility (ms).
+
+Outputs:
+    bandLevelArr -- The smoothed level of each band (0 - 255), numBands long.
+    level -- The smoothed overall level of the audio (0 - 255).
+    beat -- Set true for the update where a beat is detected, false otherwise.
+    beatCount -- The number of beats detected (does not reset automatically).
+    beatPulse -- Jumps to 255 on each beat, then fades by beatDecay each update.
+    slotArr -- The parameter slots (see audioSlotPS.h), numSlots long.
+
+Other Settings:
+    noiseFloor (default 1024) -- The log2 level mapped to 0 (see "Levels" in Inputs Guide above).
+    dynRange (default 2304) -- The log2 range mapped from 0 to 255 (see "Levels" in Inputs Guide above).
+    attack (default 128) -- How quickly the smoothed levels rise (out of 255, 255 is instant).
+    release (default 24) -- How quickly the smoothed levels fall (out of 255, 255 is instant).
+    beatBands (default 1/4 of numBands, min 1) -- How many of the lowest bands are used for beat detection.
+                                                  Is set by setNumBands().
+    beatThresh (default 32) -- How many times (out of 16) the average level rise counts as a beat, so 32 is double.
+    beatMinRise (default 16) -- The minimum level rise for a beat, to stop beats from being detected in silence.
+    beatMinTime (default 200ms) -- The minimum time between beats.
+    beatDecay (default 24) -- How much the beatPulse fades each update.
+    active (default true) -- If false, the utility will be disabled (updates() will be ignored).
+
+Functions:
+    setAudioSource(newSource) -- Sets the audio source.
+    setFFTLength(newLength) -- Sets the FFT length (rounded down to a power of 2), and re-sets up the bands.
+    setNumBands(newNumBands) -- Sets the number of bands, and resets their levels and the beatBands.
+    setNumSlots(newNumSlots) -- Sets the number of parameter slots. New slots follow the overall level, from 0 to 255.
+                                !!Any settings bound to the slots should be re-bound, since the slots may be re-allocated.
+    setSlot(slotNum, sourceType, sourceIndex, outMin, outMax) -- Sets up a parameter slot (see audioSlotPS.h).
+    update() -- Updates the utility.
+
+Reference Vars:
+    numBands -- The number of frequency bands, set using setNumBands().
+    numSlots -- The number of parameter slots, set using setNumSlots().
+    audioFFT -- The FFT buffers, including the latest samples and FFT output (see audioFFTPS.h).
+*/
+class AudioAnalyzerPS : public EffectBasePS {
+    public:
+        AudioAnalyzerPS(audioSourcePS &AudioSource, uint16_t FFTLength, uint8_t NumBands, uint8_t NumSlots, uint16_t Rate);
+
+        ~AudioAnalyzerPS();
+
+        audioSourcePS
+            *audioSource = nullptr;
+
+        audioFFTPS
+            audioFFT = {nullptr};  //Must init structs w/ pointers set to null for safety
+
+        audioSlotPS
+            *slotArr = nullptr;
+
+        uint8_t
+            *bandLevelArr = nullptr,
+            numBands = 0,  //for reference, set using setNumBands()
+            numSlots = 0,  //for reference, set using setNumSlots()
+            level = 0,
+            beatPulse = 0,
+            attack = 128,
+            release = 24,
+            beatBands = 1,
+            beatThresh = 32,
+            beatMinRise = 16,
+            beatDecay = 24;
+
+        uint16_t
+            noiseFloor = 1024,
+            dynRange = 2304,
+            beatMinTime = 200,
+            beatCount = 0;
+
+        bool
+            beat = false;
+
+        void
+            setAudioSource(audioSourcePS &newSource),
+            setFFTLength(uint16_t newLength),
+            setNumBands(uint8_t newNumBands),
+            setNumSlots(uint8_t newNumSlots),
+            setSlot(uint8_t slotNum, uint8_t sourceType, uint8_t sourceIndex, uint16_t outMin, uint16_t outMax),
+            update(void);
+
+    private:
+        unsigned long
+            currentTime,
+            prevTime = 0,
+            prevBeatTime = 0;
+
+        uint8_t
+            beatLevel = 0,  //the unsmoothed level of the beat bands from the last update
+            maxNumBands = 0,
+            maxNumSlots = 0,
+            rawLevel,
+            sourceVal;
+
+        uint16_t
+            *bandEdgeArr = nullptr,
+            *bandEnvArr = nullptr,
+            levelEnv = 0,
+            beatRise,
+            avgRise = 0;  //the average rise, with 8 bits of fraction
+
+        uint32_t
+            bandMag,
+            totalMag;
+
+        void
+            detectBeat(),
+            updateSlots();
+};
+
+#endif
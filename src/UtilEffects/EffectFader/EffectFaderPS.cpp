@@ -7,7 +7,7 @@ EffectFaderPS::EffectFaderPS(EffectSetPS &EffectSet, bool Direct, uint16_t RunTi
 }
 
 EffectFaderPS::~EffectFaderPS() {
-    free(origBrightness_arr);
+    memUtilsPS::freePS(origBrightness_arr);
 }
 
 // sets a new set of effects for fading, as well as a new direction
@@ -58,8 +58,8 @@ void EffectFaderPS::resetSegVars() {
     maxBrightness = 0;
     // clear the current brightness array for memory
     // and make a new one
-    free(origBrightness_arr);
-    origBrightness_arr = (uint8_t *)malloc(*numEffects * sizeof(uint8_t));
+    memUtilsPS::freePS(origBrightness_arr);
+    origBrightness_arr = (uint8_t *)memUtilsPS::allocPS(*numEffects * sizeof(uint8_t));
     // for each effect, get it's segment pointer
     // and save it's current brightness setting
     // then find the maximum brightness across all segmentSets
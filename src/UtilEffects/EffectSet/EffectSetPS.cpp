@@ -35,16 +35,24 @@ void EffectSetPS::reset(void) {
 
 //Sets the effect set to use a new array of effects
 //(basically like calling the constructor again, but keeping the same runTime, etc)
+//If the frame governor has lowered the quality, the new effects are given the current quality
 void EffectSetPS::setNewSet(EffectBasePS **newEffectArr, uint8_t newNumEffects) {
     effectArr = newEffectArr;
     numEffects = newNumEffects;
+    if( quality < 255 ) {
+        setQuality(quality);
+    }
     reset();
 };
 
 //Sets the effect at the effectNum in the effect array to the passed in effect
 //Ie changes one effect to another
+//If the frame governor has lowered the quality, the new effect is given the current quality
 void EffectSetPS::setEffect(EffectBasePS *newEffect, uint8_t effectNum) {
     effectArr[effectNum] = newEffect;
+    if( newEffect && quality < 255 ) {
+        newEffect->setQuality(quality);
+    }
 };
 
 //Calls the update() function of the specified effect in the effect array
@@ -107,10 +115,66 @@ void EffectSetPS::destructEffect(uint8_t effectNum) {
     }
 };
 
+//Records the current fill of the library arena (arena_PS) and sets the arena active
+//so that any effects created using new (and their memory) are placed in the arena
+//Does nothing if the library arena hasn't been setup
+void EffectSetPS::openArenaScope(void) {
+    if( arena_PS ) {
+        arenaMark = memUtilsPS::getArenaMark(*arena_PS);
+        arena_PS->active = true;
+    }
+}
+
+//Sets the library arena inactive, so that any new memory is taken from the heap
+void EffectSetPS::closeArenaScope(void) {
+    if( arena_PS ) {
+        arena_PS->active = false;
+    }
+}
+
+//Destructs all the effects at and after the effectDestLimit,
+//and then releases the library arena back to where it was when openArenaScope() was called,
+//freeing all the effects' arena memory at once
+void EffectSetPS::releaseArenaScope(void) {
+    destructEffsAftLim();
+    if( arena_PS ) {
+        arena_PS->active = false;
+        memUtilsPS::releaseArena(*arena_PS, arenaMark);
+    }
+}
+
+//Sets the library arena (arena_PS) inactive, returning if it was active before
+//Used while updating effects, so that any memory the effects allocate goes on the heap rather than in an open arena scope.
+//Effects before the destruct limit are not destructed when the scope is released,
+//so if they re-sized their buffers into the scope, their buffers would be freed out from under them
+//(and effects after the limit are freed either way, so it's safe for their buffers to go on the heap)
+bool EffectSetPS::suspendArena(void) {
+    if( arena_PS && arena_PS->active ) {
+        arena_PS->active = false;
+        return true;
+    }
+    return false;
+}
+
+//Sets the library arena back to active if it was active before suspendArena() was called
+void EffectSetPS::resumeArena(bool wasActive) {
+    if( wasActive ) {
+        arena_PS->active = true;
+    }
+}
+
 //Updates all the effects in the effect array while also tracking the overall run time
 //If the effects have been run for runTime (ms), then the effects are "done" and will no longer be updated
 //If the "infinite" flag is set, the the runTime will be infinite.
+//If the set has a mailbox, any posted parameter changes are applied first, so they happen between effect updates
+//The library arena is suspended during the update (see suspendArena())
 void EffectSetPS::update(void) {
+    bool arenaWasActive = suspendArena();
+
+    if( mailbox ) {
+        mailboxUtilsPS::applyParams(*mailbox);
+    }
+
     if( !done ) {
         currentTime = millis();
         //if this is the first time we've updated, set the started flag, and record the start time
@@ -124,13 +188,102 @@ void EffectSetPS::update(void) {
         timeElapsed = currentTime - startTime;
 
         //If we've not reached the time limit (or we're running indefinitely), call all the effects' update functions
+        //If the quality has been lowered by the frame governor, we throttle slow utilities (see throttleUtil())
         if( infinite || timeElapsed <= runTime ) {
+            if( frameBudget > 0 ) {
+                renderStart = micros();
+            }
+
             for( uint8_t i = 0; i < numEffects; i++ ) {
+                if( quality < 255 && throttleUtil(i) ) {
+                    continue;
+                }
                 updateEffect(i);
             }
+
+            if( frameBudget > 0 ) {
+                governFrame();
+            }
         } else {
             //Reached the run time, time to stop updating
             done = true;
         }
     }
+
+    resumeArena(arenaWasActive);
+}
+
+
+//Sets the quality, passing it to all the effects in the effect array (see the frame governor notes in the .h file)
+//Also calls the qualityFn if it's been set
+//Effects may re-size their buffers for the new quality, so the library arena is suspended (see suspendArena())
+void EffectSetPS::setQuality(uint8_t newQuality) {
+    bool arenaWasActive = suspendArena();
+
+    quality = newQuality;
+    for( uint8_t i = 0; i < numEffects; i++ ) {
+        if( effectArr[i] ) {
+            effectArr[i]->setQuality(quality);
+        }
+    }
+    resumeArena(arenaWasActive);
+
+    if( qualityFn ) {
+        qualityFn(quality);
+    }
+}
+
+/* The frame governor, adjusts the quality to keep the update time under the frameBudget
+Called at the end of each update (if the frameBudget is more than 0)
+If the update took longer than the budget, we lower the quality by the qualityStep (down to the qualityMin).
+Otherwise, once recoverTime has passed, we check the longest update time in that time (renderPeak),
+and if it was comfortably under budget (less than 3/4 of it), we raise the quality by the qualityStep.
+Any update over budget restarts the recoverTime, so we don't raise the quality straight after lowering it. */
+void EffectSetPS::governFrame() {
+    renderTime = micros() - renderStart;
+    if( renderTime > renderPeak ) {
+        renderPeak = renderTime;
+    }
+
+    if( renderTime > frameBudget ) {
+        if( quality > qualityMin ) {
+            if( quality - qualityMin > qualityStep ) {
+                setQuality(quality - qualityStep);
+            } else {
+                setQuality(qualityMin);
+            }
+        }
+        recoverStartTime = currentTime;
+        renderPeak = 0;
+    } else if( currentTime - recoverStartTime >= recoverTime ) {
+        if( quality < 255 && renderPeak < frameBudget - frameBudget / 4 ) {
+            setQuality(qadd8(quality, qualityStep));
+        }
+        recoverStartTime = currentTime;
+        renderPeak = 0;
+    }
 }
+
+//Returns true if the effect at the index is a "slow" utility
+//ie it has no segment set, and its update rate is at least the utilSkipRate
+bool EffectSetPS::isSlowUtil(uint8_t effectNum) {
+    EffectBasePS *effect = effectArr[effectNum];
+    return effect && !effect->segSet && effect->rate && *effect->rate >= utilSkipRate;
+}
+
+//Returns true if the effect at the index is a slow utility that should be skipped this update (only used below full quality)
+//Slow utilities are only let through once their rate plus the utilSkipRate has passed since they were last let through,
+//so their rate is effectively raised by the utilSkipRate, and they do less work while the quality is lowered
+//(the utilities still check their own rate when they're let through, so this can only slow them down)
+bool EffectSetPS::throttleUtil(uint8_t effectNum) {
+    if( !isSlowUtil(effectNum) ) {
+        return false;
+    }
+
+    EffectBasePS *effect = effectArr[effectNum];
+    if( currentTime - effect->throttleTime < (unsigned long)*effect->rate + utilSkipRate ) {
+        return true;
+    }
+    effect->throttleTime = currentTime;
+    return false;
+}
\ No newline at end of file
@@ -11,6 +11,7 @@
 #endif
 
 #include "Effects/EffectBasePS.h"
+#include "Include_Lists/MailboxFiles.h"
 
 //TODO:
 //-- Add ability to store a callback function ptr, would be called when EffectSet finishes
@@ -116,6 +117,87 @@ for a working implementation of an effect set.
             If the `effectDestLimit` is 2 and the number of effects in the array is 5, ie {0, 1, 2, 3, 4}, 
             then effects at indexes 2, 3, and 4 will be destructed, while those at 0 and 1 will not.
 
+    Using A Memory Arena For Dynamic Effects:
+        If you are cycling through dynamically allocated effects over a long period of time, 
+        repeatedly creating and destructing them can fragment your heap, eventually causing a crash.
+        To avoid this, you can create your effects (and their memory) in a memory arena (see memArenaPS.h in Memory_Stuff). 
+        Once you've setup the library arena using `memUtilsPS::setupArena()`, effect sets can manage it for you:
+
+            //<When creating your dynamic effects>
+            effectSet.openArenaScope(); //Any effects created using new (and their memory) will now be put in the arena
+            effArray[1] = new StreamerSL(...);
+            effectSet.closeArenaScope(); //Stop using the arena, so any other memory goes back on the heap
+
+            //<When you're done with the effects>
+            effectSet.releaseArenaScope(); //Destructs all effects after the destruct limit, and frees their arena memory
+
+        Releasing the scope frees all the arena memory allocated since the scope was opened in one go, 
+        leaving no gaps. Like with `destructEffsAftLim()`, make sure that only your dynamic effects are after the 
+        destruct limit, and that no other objects using arena memory were created while the scope was open.
+
+        Only the effects created while the scope is open should be placed in the arena, 
+        but while it's open, any memory allocated by the library goes into it. 
+        So the effect set suspends the arena while updating its effects (and while setting their quality), 
+        making sure that any buffers your other effects re-size go on the heap, 
+        rather than into the scope where they'd be freed when it's released.
+        Likewise, avoid changing the settings of your other effects while the scope is open, 
+        and close it as soon as you've created your effects.
+
+        Note that effects are created using `memUtilsPS::allocPS()` (see EffectBasePS.h), 
+        so if there isn't enough memory for an effect, `new` returns nullptr rather than throwing an exception.
+
+    Changing Settings From Another Thread or Core:
+        If you're changing effect settings from another thread, core, or interrupt (like when receiving settings over WiFi),
+        writing them directly into the effects may cause glitches, since the effects may be part way through drawing.
+        Instead, you can send the changes through a parameter mailbox (see paramMailboxPS.h in Mailbox_Stuff),
+        and point the effect set's `mailbox` to it. The set will apply any posted changes at the start of each `update()`, 
+        before any effects are updated, so the effects always see a complete set of changes:
+
+            //<Before Arduino setup()>
+            paramMsgPS msgArr[16];
+            paramMailboxPS mailbox = {msgArr, SIZE(msgArr)};
+
+            //<In Arduino setup()>
+            effectSet.mailbox = &mailbox;
+
+            //<On the other thread/core>
+            writeParamPS(mailbox, *strem->rate, 40);
+            mailboxUtilsPS::postParams(mailbox); //returns false if the changes didn't fit, so nothing was posted
+
+        Applying the changes doesn't wait on the other thread/core, so it never holds up the effects.
+        Changes are applied even if the set is `done`.
+
+    Keeping A Steady Frame Rate (The Frame Governor):
+        If your effects take too long to draw (ie a large NoiseSL or a TwinkleSL with lots of twinkles), 
+        the output will stutter. To help with this, the effect set has a frame "governor" that times each update 
+        against a frame budget, `frameBudget` (in microseconds, 0 turns the governor off, the default). 
+        If an update takes longer than the budget, the set lowers its `quality` (255 is full quality) by `qualityStep`, 
+        down to `qualityMin`. Once the updates have been comfortably under budget (less than 3/4 of it) for `recoverTime` ms, 
+        the quality is raised again by `qualityStep`. 
+
+        When the quality changes, the set passes it to each effect's setQuality() function. 
+        Effects that can trade quality for speed use this to do less work 
+        (ie TwinkleSL spawns fewer twinkles, and NoiseSL uses noise keyframes). Most effects ignore it.
+        While below full quality, the set also throttles slow utilities (ones without a segment set 
+        and with a rate of at least `utilSkipRate`), only letting them update once their rate plus `utilSkipRate` has passed.
+        So a PaletteBlenderPS with a rate of 100ms would update every 200ms (with the default utilSkipRate),
+        halving its work until the quality is raised again.
+
+        You can also have the set call a function of yours whenever the quality changes using `qualityFn`,
+        which you can use to switch to a faster version of an effect (ie from TwinkleSL to TwinkleFastSL):
+
+            //<Before Arduino setup()>
+            void qualityChanged(uint8_t quality){
+                //<swap to/from your fast effect based on the quality>
+            }
+
+            //<In Arduino setup()>
+            effectSet.frameBudget = 16000; //16ms, for ~60fps
+            effectSet.qualityFn = &qualityChanged;
+
+        Note that the update time includes any FastLED.show() calls from the effects.
+        Effects added using setEffect() or setNewSet() are given the current quality.
+
     Extra Notes:
         * To allow multiple effects to be held in the array, they all inherit from (and have the type of) `EffectBasePS`. So if you access any effects via the effect array, you'll only be able to access the variables listed in [Effect Base](https://github.com/AlbertGBarber/PixelSpork/wiki/The-Effect-Base-Class).
 
@@ -156,6 +238,15 @@ Constructor Inputs:
                 
 Other Settings:
     infinite (default false) -- If true, the effect set will update forever, regardless of the runTime setting
+    mailbox (default nullptr) -- A parameter mailbox that will be applied at the start of each update()
+                                 (see "Changing Settings From Another Thread or Core" above).
+    frameBudget (default 0) -- The target update time (us) for the frame governor, 0 turns the governor off
+                               (see "Keeping A Steady Frame Rate" above).
+    qualityMin (default 64) -- The lowest quality the frame governor will go to.
+    qualityStep (default 32) -- How much the frame governor lowers/raises the quality each time.
+    recoverTime (default 1000ms) -- How long the updates need to be under budget before the quality is raised.
+    utilSkipRate (default 100ms) -- Below full quality, utilities with rates at or above this have their rate raised by this much.
+    qualityFn (default nullptr) -- A function called when the quality changes, with the new quality as its input.
 
 Functions:
     reset() -- Resets the time settings of the effect set (started and done), restarting it.
@@ -169,6 +260,14 @@ Functions:
     destructEffect(effectNum) -- Calls the destructor for the effect in the effect array at the passed in index 
     getEffectPtr(num) -- Returns the pointer to the effect in the effect array at the passed in index.
                          Note that the return type will be EffectBasePS (see Notes above)
+    openArenaScope() -- Records the current fill of the library memory arena and sets it active, 
+                        so that new effects are created in the arena (see "Using A Memory Arena" above).
+                        Does nothing if the library arena hasn't been setup.
+    closeArenaScope() -- Sets the library memory arena inactive, so that new memory is taken from the heap.
+    releaseArenaScope() -- Destructs all effects after the destruct limit (using destructEffsAftLim()), 
+                           and then releases the library arena memory back to where it was when openArenaScope() was called.
+    setQuality(newQuality) -- Sets the quality, passing it to all the effects, and calling the qualityFn (if set). 
+                              The frame governor calls this for you, but you can use it to set the quality yourself.
     updateEffect(effectNum) -- Updates the effect in the effect array at the passed in index
     update() -- Updates all the effects in the set, while also tracking the set's run time
                 Will set the "done" flag once the run time has elapsed
@@ -176,6 +275,8 @@ Functions:
 Reference Vars:
     startTime -- The time (ms) the first update() was called.
     timeElapsed -- The time elapsed (ms), since the first update() was called.
+    quality -- The current quality set by the frame governor (255 is full quality), set using setQuality().
+    renderTime -- The time (us) the last update took, only recorded if the frame governor is on.
 
 Flags:
     started (default false) -- Set true if first the update() for the set has been called (the startTime will be set).
@@ -193,6 +294,9 @@ class EffectSetPS {
             **effectArr = nullptr,
             *getEffectPtr(uint8_t num);
 
+        paramMailboxPS
+            *mailbox = nullptr;
+
         uint8_t
             numEffects,           //length of the effectSet array, this is public so you can do shenanigans,
                                   //like only having a single array for all effects, but manipulating the "length"
@@ -204,6 +308,22 @@ class EffectSetPS {
             startTime = 0,    //The time (ms) the first update() was called, for reference
             timeElapsed = 0;  //the elapsed time (ms), for reference
 
+        uint8_t
+            quality = 255,     //For reference, set using setQuality()
+            qualityMin = 64,
+            qualityStep = 32;
+
+        uint16_t
+            recoverTime = 1000,
+            utilSkipRate = 100;
+
+        uint32_t
+            frameBudget = 0,  //The target update time (us) for the frame governor, 0 is off
+            renderTime = 0;   //The time (us) of the last update, for reference
+
+        void
+            (*qualityFn)(uint8_t quality) = nullptr;  //Called when the quality changes
+
         bool
             infinite = false,  //if set, the effect effectArr will run indefinitely
             started = false,   //has the effect effectArr started (only relevant if not infinite)
@@ -217,15 +337,36 @@ class EffectSetPS {
             destructEffsAftLim(void),
             destructEffsAftLim(uint8_t limit),
             destructEffect(uint8_t effectNum),
+            openArenaScope(void),
+            closeArenaScope(void),
+            releaseArenaScope(void),
             updateEffect(uint8_t effectNum),
+            setQuality(uint8_t newQuality),
             update(void);
 
     private:
         unsigned long
-            currentTime;
+            currentTime,
+            recoverStartTime = 0;
+
+        uint32_t
+            renderStart,
+            renderPeak = 0;
+
+        uint32_t
+            arenaMark = 0;
+
+        void
+            init(),
+            governFrame();
 
         void
-            init();
+            resumeArena(bool wasActive);
+
+        bool
+            suspendArena(void),
+            isSlowUtil(uint8_t effectNum),
+            throttleUtil(uint8_t effectNum);
 };
 
 #endif
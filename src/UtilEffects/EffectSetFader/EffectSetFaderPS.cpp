@@ -16,7 +16,10 @@ EffectSetFaderPS::EffectSetFaderPS(EffectSetPS &EffectSet, uint16_t FadeRunTime,
 }
 
 EffectSetFaderPS::~EffectSetFaderPS() {
+    endTrans();
     effectFader->~EffectFaderPS();
+    memUtilsPS::freePS(transBuffer);
+    memUtilsPS::freePS(transEffArr);
 }
 
 //Resets the fader to use a new effect set and fade time
@@ -46,7 +49,12 @@ void EffectSetFaderPS::setupFader(uint16_t newFadeRunTime) {
 //Resets the EffectSetFader, starting a new fade in/out sequence.
 //You should do this wherever you reset your EffectSet.
 //(but do so before destructing any effects, since the fader needs access to their segment sets)
+//If a transition was running, it is finished, and the next effect will not be faded in
 void EffectSetFaderPS::reset() {
+    skipFadeIn = transStarted;
+    endTrans();
+    nextEffect = nullptr;
+
     firstUpdate = true;
     resetNextUpdate = false;
     fadeOutStarted = false;
@@ -93,7 +101,10 @@ void EffectSetFaderPS::update(void) {
         //If we've not started a fade in, do so by resetting the effectFader, and setting it to fade in
         if( !fadeInStarted ) {
             fadeInStarted = true;
-            if( !fadeIn ) {  //If we don't want to fade in, just the end the fader before it can start
+            //If we don't want to fade in, just the end the fader before it can start
+            //(we also don't fade in if the effect was transitioned in)
+            if( !fadeIn || skipFadeIn ) {
+                skipFadeIn = false;
                 effectFader->done = true;
             } else {
                 effectFader->direct = true;  
@@ -107,12 +118,22 @@ void EffectSetFaderPS::update(void) {
             fadeOutStarted = true;
             if( !fadeOut ) {  //If we don't want to fade out, just the end the fader before it can start
                 effectFader->done = true;
+            } else if( transMode > 0 && nextEffect && nextEffect->segSet ) {
+                //Transition to the next effect instead of fading out
+                //(resetting the effectFader restores the brightness if a fade in hadn't finished)
+                effectFader->reset();
+                effectFader->done = true;
+                startTrans();
             } else {  //reset the effectFader, and setting it to fade out
                 effectFader->direct = false;
                 effectFader->reset();
             }
         }
 
+        if( transStarted ) {
+            updateTrans();
+        }
+
         //Update the effect fader
         //Once a fade is finished, the fader will be "done" and must be reset to fade again.
         effectFader->update();
@@ -131,4 +152,172 @@ void EffectSetFaderPS::update(void) {
         //  resetNextUpdate = true;
         //}
     }
+}
+
+/* Starts a transition from the current effect(s) to the nextEffect
+The outgoing effects are all the effects in the effect set that draw to the same leds array as the nextEffect.
+We point their segment sets to the outBuffer, so that they draw there when the effect set updates them,
+while the fader updates the nextEffect, drawing it into the inBuffer (see updateTrans()).
+The outBuffer starts with the current leds, so the outgoing effects continue on as normal,
+while the inBuffer starts blank, as if the nextEffect was starting on a cleared strip.
+For each effect, we store its rate and showNow settings, so they can be restored when the transition ends. */
+void EffectSetFaderPS::startTrans() {
+    ledsMain = nextEffect->segSet->leds;
+    transLength = nextEffect->segSet->ledArrSize;
+
+    //Only make new buffers if we need to (one block, split into the out and in buffers)
+    if( alwaysResizeObj_PS || (transLength > maxTransLength) ) {
+        maxTransLength = transLength;
+        memUtilsPS::freePS(transBuffer);
+        transBuffer = (CRGB *)memUtilsPS::allocPS(2 * transLength * sizeof(CRGB));
+    }
+    outBuffer = transBuffer;
+    inBuffer = transBuffer + transLength;
+
+    memcpy(outBuffer, ledsMain, transLength * sizeof(CRGB));
+    fill_solid(inBuffer, transLength, CRGB::Black);
+
+    //Make space to track the outgoing effects, plus the incoming one
+    if( alwaysResizeObj_PS || (effectSet->numEffects + 1 > maxNumTransEffs) ) {
+        maxNumTransEffs = effectSet->numEffects + 1;
+        memUtilsPS::freePS(transEffArr);
+        transEffArr = (transEffectPS *)memUtilsPS::allocPS(maxNumTransEffs * sizeof(transEffectPS));
+    }
+
+    //Find the outgoing effects, and switch them to draw to the outBuffer
+    //(several effects may share a segment set, so their leds may already be pointed at the outBuffer)
+    numTransEffs = 0;
+    for( uint8_t i = 0; i < effectSet->numEffects; i++ ) {
+        EffectBasePS *effect = effectSet->getEffectPtr(i);
+        if( effect && effect != this && effect != nextEffect && effect->segSet &&
+            (effect->segSet->leds == ledsMain || effect->segSet->leds == outBuffer) ) {
+
+            effect->segSet->leds = outBuffer;
+            transEffArr[numTransEffs] = {effect, effect->rate, 0, effect->showNow};
+            numTransEffs++;
+        }
+    }
+    //The incoming effect goes last
+    transEffArr[numTransEffs] = {nextEffect, nextEffect->rate, 0, nextEffect->showNow};
+    numTransEffs++;
+
+    //Only the fader writes out the leds during the transition
+    for( uint8_t i = 0; i < numTransEffs; i++ ) {
+        transEffArr[i].effect->showNow = false;
+        if( transEffArr[i].rateOrig ) {
+            transEffArr[i].effect->rate = &transEffArr[i].rateTrans;
+        }
+    }
+    setTransRates();
+
+    //For the dissolve, each pixel switches over at a random point in the transition
+    if( transMode == 3 ) {
+        randUtilsPS::setupPerm(randStream, transPerm, transLength);
+    }
+
+    //The transition runs for the rest of the effect set's run time,
+    //but we aim to finish one fader update early, so the incoming effect is fully shown before the set ends
+    transStartTime = currentTime;
+    transTime = *runTime - *setTimeElap;
+    if( transTime > fadeRunTime ) {
+        transTime = fadeRunTime;
+    }
+    if( transTime > *rate ) {
+        transTime -= *rate;
+    }
+
+    transStarted = true;
+}
+
+//Sets the effects' transition update rates to their original rates times the transRateMult
+//We do this every update, so that any changes to the original rates carry through
+void EffectSetFaderPS::setTransRates() {
+    for( uint8_t i = 0; i < numTransEffs; i++ ) {
+        if( transEffArr[i].rateOrig ) {
+            uint32_t rateTemp = (uint32_t)(*transEffArr[i].rateOrig) * transRateMult;
+            transEffArr[i].rateTrans = rateTemp > 65535 ? 65535 : rateTemp;
+        }
+    }
+}
+
+/* Updates the transition
+The outgoing effects have already drawn into the outBuffer as part of the effect set's update,
+so we update the incoming effect, pointing its segment set to the inBuffer for the update.
+Then we mix the buffers into the leds array according to the transMode:
+    The crossfade blends every pixel by the same amount.
+    The wipe and dissolve give each pixel a threshold (by position for the wipe, and randomly for the dissolve),
+    and only blend a pixel once the transition passes its threshold, taking maskSoftness to fully switch over.
+Once the transition time has passed, the incoming effect will be fully shown, 
+but we keep going until the fader is reset, so that the outgoing effects keep drawing into the outBuffer. */
+void EffectSetFaderPS::updateTrans() {
+    setTransRates();
+
+    CRGB *setLeds = nextEffect->segSet->leds;
+    nextEffect->segSet->leds = inBuffer;
+    nextEffect->update();
+    nextEffect->segSet->leds = setLeds;
+
+    //Get how far we are through the transition (out of 255)
+    uint8_t transAmount = 255;
+    if( currentTime - transStartTime < transTime ) {
+        transAmount = ((currentTime - transStartTime) * 255) / transTime;
+    }
+
+    if( transMode == 2 || transMode == 3 ) {
+        uint16_t softness = maskSoftness > 0 ? maskSoftness : 1;
+        //The mask position runs past 255 by the softness, so that the last pixels have time to blend in
+        uint16_t maskPos = ((uint32_t)transAmount * (255 + softness)) / 255;
+        uint16_t thresh;
+        uint8_t pixelAmount;
+        for( uint16_t i = 0; i < transLength; i++ ) {
+            if( transMode == 2 ) {
+                thresh = ((uint32_t)i * 255) / transLength;
+            } else {
+                thresh = ((uint32_t)randUtilsPS::getPermVal(transPerm, i) * 255) / transLength;
+            }
+
+            if( maskPos <= thresh ) {
+                pixelAmount = 0;
+            } else if( maskPos - thresh >= softness ) {
+                pixelAmount = 255;
+            } else {
+                pixelAmount = ((maskPos - thresh) * 255) / softness;
+            }
+            ledsMain[i] = blend(outBuffer[i], inBuffer[i], pixelAmount);
+        }
+    } else {
+        blend(outBuffer, inBuffer, ledsMain, transLength, transAmount);
+    }
+
+    if( showNow ) {
+        FastLED.show();
+    }
+}
+
+/* Ends a transition (if one is running)
+The outgoing effects' segment sets are pointed back to the leds array, and the incoming effect's buffer
+is copied into the leds array, so that the incoming effect can carry on drawing from where it left off.
+The effects' rates and showNow settings are also restored.
+This is called when the fader is reset, so you shouldn't need to call it yourself.
+Note that the outgoing effects must still exist! */
+void EffectSetFaderPS::endTrans() {
+    if( !transStarted ) {
+        return;
+    }
+
+    for( uint8_t i = 0; i < numTransEffs; i++ ) {
+        EffectBasePS *effect = transEffArr[i].effect;
+        if( effect->segSet->leds == outBuffer ) {
+            effect->segSet->leds = ledsMain;
+        }
+        effect->showNow = transEffArr[i].showNow;
+        if( transEffArr[i].rateOrig ) {
+            effect->rate = transEffArr[i].rateOrig;
+        }
+    }
+
+    memcpy(ledsMain, inBuffer, transLength * sizeof(CRGB));
+
+    numTransEffs = 0;
+    transStarted = false;
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "Effects/EffectBasePS.h"
 #include "UtilEffects/EffectFader/EffectFaderPS.h"
 #include "UtilEffects/EffectSet/EffectSetPS.h"
+#include "Utils/transEffectPS.h"
+#include "./Include_Lists/GlobalVars/GlobalVars.h"  //need alwaysResizeObj_PS
 //#include "MathUtils/mathUtilsPS.h"
 
 /*
@@ -70,11 +72,53 @@ not fading will be 6sec: the 10sec run time minus the 4sec spent fading in and o
         and must be manually reset, with it's own `reset()` function. 
         In practice, this is pretty simple, just reset the fader whenever you reset you effect set.
 
+    Transitions:
+        By default, the fader fades the current effect out to black, and the next effect in from black.
+        Instead, you can have the fader transition directly from the current effect to the next one, 
+        by setting `transMode`, and telling the fader what the next effect is using `nextEffect`. 
+        The transition runs for the last `fadeRunTime` of the effect set, with the outgoing and incoming effects 
+        both running, each drawing into their own buffer. The fader then mixes the buffers into the FastLED `leds` array.
+        The `transMode`s are:
+            0 -- No transition, the effects are faded out and in using their brightness (default)
+            1 -- Crossfade, the outgoing effect is blended into the incoming one
+            2 -- Wipe, the incoming effect is wiped in along the `leds` array, with a soft edge of `maskSoftness`
+            3 -- Dissolve, the incoming effect replaces the outgoing one pixel by pixel in a random order, 
+                 with each pixel fading over `maskSoftness`
+
+        For Example:
+            setFader.transMode = 1;
+            setFader.nextEffect = &yourNextEffect;
+
+        Once the effect set is done, you need to reset the fader (finishing the transition), 
+        and then swap the incoming effect into the effect set (destructing the outgoing effect if needed):
+            setFader.reset();
+            effectSet.setEffect(&yourNextEffect, 1);
+            effectSet.reset();
+        The next effect does not fade in, since it has already been transitioned in.
+        Note that PlaylistPS does all this for you if you set its `setFader` (see PlaylistPS.h).
+
+        The outgoing effect(s) are any effects in the effect set that draw to the same `leds` array as the incoming effect.
+        During the transition, their segment sets' `leds` pointer is swapped to the fader's buffer,
+        so you shouldn't draw to their segment sets yourself until the fader is reset.
+        The incoming effect should _NOT_ be part of the effect set during the transition, it is updated by the fader.
+
+        Running two effects at once is more costly, so during the transition each effect's update rate
+        is multiplied by `transRateMult` (2 by default, so each effect runs at half its normal rate).
+        Note that this slows the effects during the transition. 
+        You may also want to lower the fader's `rate`, so that the transition looks smooth.
+        The buffers take 6 bytes per LED (two CRGB colors), and are only allocated when a transition starts.
+
+        If `nextEffect` is not set by the time the fade out starts, the effect will be faded out using its brightness.
+
 Example Calls:
     (see setup guide above, but for reference)
     EffectSetFaderPS effectSetFader(effectSet, 2000, true, true);
     Will create a fader with a fade time of 2000ms.
     It is configured to both fade in and out.
+
+    effectSetFader.transMode = 3;
+    effectSetFader.nextEffect = &nextEffect;
+    Will dissolve from the current effect to nextEffect over the last 2000ms of the effect set.
     
 Constructor Inputs:
     effectSet -- The effect set that the fader will operate on (see EffectSetPS.h)
@@ -87,6 +131,12 @@ Other Settings:
     *rate (default bound to rateOrig) -- The update rate for the fader. You only need to change this if the brightness changes look "choppy".
                                          It is a pointer, so it can be tied to and external var if needed.
     active (default true) -- If false, the utility will be disabled (updates() will be ignored).
+    transMode (default 0) -- Sets how the fader transitions between effects (see "Transitions" above).
+    nextEffect (default nullptr) -- The incoming effect for a transition (see "Transitions" above).
+                                    It is set back to nullptr when the fader is reset.
+    transRateMult (default 2) -- The multiplier for the effects' update rates during a transition (1 for no change).
+    maskSoftness (default 32, min 1) -- The width of the soft edge for the wipe and dissolve transitions (out of 255).
+                                        Lower is sharper.
     EffectFaderPS effectFader -- The EffectFaderPS instance. 
                                  You shouldn't need to touch this, but it's public just in case.
     
@@ -97,6 +147,8 @@ Functions:
     resetFader() -- Resets the EffectFader, restarting it (see EffectFadePS reset()). You shouldn't need to call this.
     resetBrightness() -- Resets the segment set(s) to their original brightness setting(s) (as recorded during the first update()) 
                          (see EffectFadePS resetBrightness()). You shouldn't need to call this.
+    endTrans() -- Finishes a transition, copying the incoming effect's buffer into the `leds` array,
+                  and restoring the effects' settings. This is called by reset(), so you shouldn't need to call it.
     update() -- Updates the fader. If the fader is part of a EffectSet, this will be called whenever the set is updated
 
 Reference Vars:
@@ -105,6 +157,7 @@ Reference Vars:
 Flags:
     fadeInStarted (default false) -- Set true if a fade in has started
     fadeOutStarted (default false) -- Set true if a fade out has started
+    transStarted (default false) -- Set true if a transition has started (and not been ended by a reset())
 */
 class EffectSetFaderPS : public EffectBasePS {
     public:
@@ -116,6 +169,11 @@ class EffectSetFaderPS : public EffectBasePS {
 
         ~EffectSetFaderPS();
 
+        uint8_t
+            transMode = 0,
+            transRateMult = 2,
+            maskSoftness = 32;
+
         uint16_t
             fadeRunTime,        //For reference, set with setupFader()
             rateOrig = 60,      //The default update rate (ms)
@@ -126,11 +184,15 @@ class EffectSetFaderPS : public EffectBasePS {
             fadeIn = true,
             fadeOut = true,
             fadeInStarted = false,
-            fadeOutStarted = false;
+            fadeOutStarted = false,
+            transStarted = false;
 
         EffectSetPS
             *effectSet = nullptr;
 
+        EffectBasePS
+            *nextEffect = nullptr;
+
         EffectFaderPS
             *effectFader = nullptr;
 
@@ -140,19 +202,48 @@ class EffectSetFaderPS : public EffectBasePS {
             reset(),
             resetFader(),
             resetBrightness(),
+            endTrans(),
             update();
 
     private:
         unsigned long
             currentTime,
             prevTime = 0,
+            transStartTime,
+            transTime,
             *runTime = nullptr,
             *setTimeElap;
 
+        uint8_t
+            numTransEffs = 0,
+            maxNumTransEffs = 0;
+
+        uint16_t
+            transLength = 0,
+            maxTransLength = 0;
+
+        CRGB
+            *ledsMain = nullptr,
+            *transBuffer = nullptr,  //holds the outgoing effect's pixels followed by the incoming effect's
+            *outBuffer = nullptr,
+            *inBuffer = nullptr;
+
+        transEffectPS
+            *transEffArr = nullptr;
+
+        randPermPS
+            transPerm = {};
+
         bool
             *infinite = nullptr,
             firstUpdate = true,
+            skipFadeIn = false,
             resetNextUpdate = false;
+
+        void
+            startTrans(),
+            updateTrans(),
+            setTransRates();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,28 @@
+#ifndef transEffectPS_h
+#define transEffectPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "Effects/EffectBasePS.h"
+
+/*
+A struct for tracking an effect that is part of an EffectSetFaderPS transition (see EffectSetFaderPS.h).
+During a transition, the effect's update rate and showNow setting are changed by the fader,
+so we store the originals here, and restore them once the transition is finished.
+The effect's rate pointer is bound to rateTrans for the transition,
+which is the effect's original rate multiplied by the fader's transRateMult.
+*/
+struct transEffectPS {
+    EffectBasePS *effect;  //the effect
+    uint16_t *rateOrig;    //the effect's original rate pointer
+    uint16_t rateTrans;    //the effect's update rate during the transition
+    bool showNow;          //the effect's original showNow setting
+};
+
+#endif
@@ -22,7 +22,7 @@ PaletteBlenderPS::PaletteBlenderPS(palettePS &StartPalette, palettePS &EndPalett
 }
 
 PaletteBlenderPS::~PaletteBlenderPS() {
-    free(blendPalette_arr);
+    memUtilsPS::freePS(blendPalette_arr);
 }
 
 //resets the core class variables, allowing you to reuse class instances
@@ -77,8 +77,8 @@ void PaletteBlenderPS::setupBlendPalette(uint8_t newBlendPaletteLength) {
         blendPaletteMaxLen = newBlendPaletteLength;
         //delete the current blendPalette array of colors to free up memory
         //then create a new one, and pass that to a palette
-        free(blendPalette_arr);
-        blendPalette_arr = (CRGB *)malloc(blendPaletteMaxLen * sizeof(CRGB));
+        memUtilsPS::freePS(blendPalette_arr);
+        blendPalette_arr = (CRGB *)memUtilsPS::allocPS(blendPaletteMaxLen * sizeof(CRGB));
         blendPalette = {blendPalette_arr, blendPaletteMaxLen};
     } else {
         //if the new blend palette length is less than the current length,
@@ -17,7 +17,7 @@ PaletteNoisePS::PaletteNoisePS(uint8_t numColors, uint8_t HueBase, uint8_t HueMa
 }
 
 PaletteNoisePS::~PaletteNoisePS() {
-    free(noisePalette.paletteArr);
+    memUtilsPS::freePS(noisePalette.paletteArr);
 }
 
 //initialize various core variables
@@ -43,7 +43,7 @@ void PaletteNoisePS::setupPalette(uint8_t numColors) {
         paletteLenMax = numColors;
         //delete the current palette to free up memory
         //then create a new one
-        free(noisePalette.paletteArr);
+        memUtilsPS::freePS(noisePalette.paletteArr);
         noisePalette = paletteUtilsPS::makeRandomPalette(numColors);
     } else {
         //if the new number of palette colors is less than the current length,
@@ -83,6 +83,10 @@ void PaletteNoisePS::getNoisePalColors() {
     //255 is the circumference of our color wheel
     compStep = 255 / noisePalette.length;
 
+    //Start the color and brightness noise rows, we walk along them as we move across the palette
+    noiseUtilsPS::startNoiseRow8(colorNoiseRow, 0, currentTime / blendSpeed, colorScale, 0);
+    noiseUtilsPS::startNoiseRow8(briNoiseRow, 0, currentTime / briSpeed, briScale, 0);
+
     //For each color in the palette, get a noise value and map it to a color around the hue range.
     for( uint8_t i = 0; i < noisePalette.length; i++ ) {
 
@@ -90,10 +94,10 @@ void PaletteNoisePS::getNoisePalColors() {
         //varying the noise using the currentTime seems to work well,
         //although if your updates were slow, you could use a fixed counter system (see the NoiseSL effect)
         //We use a separate noise value for the saturation and value to add more variation
-        noiseData = inoise8(i * colorScale, currentTime / blendSpeed);
-        noiseData2 = inoise8(i * briScale, currentTime / briSpeed);
+        noiseData = noiseUtilsPS::nextNoise8(colorNoiseRow);
+        noiseData2 = noiseUtilsPS::nextNoise8(briNoiseRow);
 
-        //The range of the inoise8 function is roughly 16-238.
+        //The range of the noise is roughly 16-238.
         //These two operations expand those values out to roughly 0..255
         //You can comment them out if you want the raw noise data.
         noiseData = qsub8(noiseData, 16);
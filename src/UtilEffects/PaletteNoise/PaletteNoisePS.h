@@ -3,6 +3,7 @@
 
 #include "Effects/EffectBasePS.h"
 #include "GeneralUtils/generalUtilsPS.h"
+#include "Noise_Stuff/noiseUtilsPS.h"
 //#include "MathUtils/mathUtilsPS.h"
 
 /*
@@ -219,6 +220,10 @@ class PaletteNoisePS : public EffectBasePS {
             sat,
             val;
 
+        noiseRowPS
+            colorNoiseRow,
+            briNoiseRow;
+
         void
             init(uint16_t numColors, uint16_t HueRate, uint16_t Rate),
             getNoisePalColors();
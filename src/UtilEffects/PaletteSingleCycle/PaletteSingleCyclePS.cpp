@@ -19,9 +19,9 @@ PaletteSingleCyclePS::PaletteSingleCyclePS(palettePS &InputPalette, uint8_t Blen
 }
 
 PaletteSingleCyclePS::~PaletteSingleCyclePS() {
-    free(paletteColorArr1);
-    free(paletteColorArr2);
-    free(indexOrder);
+    memUtilsPS::freePS(paletteColorArr1);
+    memUtilsPS::freePS(paletteColorArr2);
+    memUtilsPS::freePS(indexOrder);
     PB->~PaletteBlenderPS();
 }
 
@@ -79,15 +79,15 @@ void PaletteSingleCyclePS::switchPalette() {
         paletteLenMax = paletteLength;
 
         //Create two new palettes the same length as inputPalette
-        free(paletteColorArr2);
-        paletteColorArr1 = (CRGB *)malloc(paletteLength * sizeof(CRGB));
-        paletteColorArr2 = (CRGB *)malloc(paletteLength * sizeof(CRGB));
+        memUtilsPS::freePS(paletteColorArr2);
+        paletteColorArr1 = (CRGB *)memUtilsPS::allocPS(paletteLength * sizeof(CRGB));
+        paletteColorArr2 = (CRGB *)memUtilsPS::allocPS(paletteLength * sizeof(CRGB));
         currentPalette = {paletteColorArr1, paletteLength};
         nextPalette = {paletteColorArr2, paletteLength};
 
         //Create any array to track the palette index order when shuffling (see blend modes)
-        free(indexOrder);
-        indexOrder = (uint8_t *)malloc(paletteLength * sizeof(uint8_t));
+        memUtilsPS::freePS(indexOrder);
+        indexOrder = (uint8_t *)memUtilsPS::allocPS(paletteLength * sizeof(uint8_t));
         
         initPaletteColors();
     }
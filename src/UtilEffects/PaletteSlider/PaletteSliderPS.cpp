@@ -18,8 +18,8 @@ PaletteSliderPS::PaletteSliderPS(palettePS &InputPalette, uint16_t SliderPalLen,
 }
 
 PaletteSliderPS::~PaletteSliderPS() {
-    free(patternTemp.patternArr);
-    free(sliderPalColArr);
+    memUtilsPS::freePS(patternTemp.patternArr);
+    memUtilsPS::freePS(sliderPalColArr);
 }
 
 //setup core vars
@@ -60,8 +60,8 @@ void PaletteSliderPS::makeSliderPalette(uint16_t paletteLength) {
     //but this may use up more memory overall.
     if( alwaysResizeObj_PS || (paletteLength > sliderPalLenMax) ) {
         sliderPalLenMax = paletteLength;
-        free(sliderPalColArr);
-        sliderPalColArr = (CRGB *)malloc(sliderPalLenMax * sizeof(CRGB));
+        memUtilsPS::freePS(sliderPalColArr);
+        sliderPalColArr = (CRGB *)memUtilsPS::allocPS(sliderPalLenMax * sizeof(CRGB));
         sliderPalette = {sliderPalColArr, sliderPalLenMax};
     } else {
         //if the new slider palette length is less than the current length,
@@ -0,0 +1,136 @@
+#include "PlaylistPS.h"
+
+PlaylistPS::PlaylistPS(EffectSetPS &EffectSet, uint8_t EffectNum, playlistLibPS &PlaylistLib, const char *PlaylistText)
+    : effectSet(&EffectSet), playlistLib(&PlaylistLib), effectNum(EffectNum)
+{
+    setPlaylist(PlaylistText);
+}
+
+//Destructor, only frees the preloaded effect (if any)
+//The current effect is part of the effect set, so it's left to you to destruct
+PlaylistPS::~PlaylistPS() {
+    if( nextState == 2 ) {
+        delete nextEffect;
+    }
+}
+
+//Sets a new playlist, and starts playing it from its first entry
+//The first entry's effect is built right away, replacing the current effect (which is destructed)
+//If the playlist doesn't have any valid entries, hasEntries will be false, and the effect set will be left as is
+void PlaylistPS::setPlaylist(const char *newPlaylistText) {
+    playlistText = newPlaylistText;
+    textPos = 0;
+
+    //Throw out any preloaded effect from the old playlist
+    //(the fader may be using it for a transition, so we need to reset the fader first)
+    if( setFader ) {
+        setFader->reset();
+    }
+    if( nextState == 2 ) {
+        delete nextEffect;
+        nextEffect = nullptr;
+    }
+
+    nextState = 0;
+    hasEntries = playlistUtilsPS::readEntry(playlistText, textPos, *playlistLib, nextEntry);
+    if( !hasEntries ) {
+        return;
+    }
+    nextState = 1;
+
+    preloadNext();
+    startNext();
+}
+
+//Builds the next effect if it hasn't been built already (see "Preloading Effects" in the .h file)
+//!!Must be called from the same thread/core as update()
+void PlaylistPS::preloadNext() {
+    if( nextState != 1 ) {
+        return;
+    }
+
+    nextEffect = playlistLib->effectArr[nextEntry.effectType].buildFn(nextEntry);
+    nextState = 2;
+}
+
+//Switches to the next entry right away
+void PlaylistPS::skipEntry() {
+    startNext();
+}
+
+//Updates the effect set, and switches to the next effect once the set is done
+//The next effect is preloaded once we're within the preloadTime of the end of the current effect
+//(or right away for effects that run forever)
+//If we have a set fader, we preload ahead of the fader's fade time, and pass it the next effect once it's ready
+void PlaylistPS::update() {
+    effectSet->update();
+
+    if( !hasEntries ) {
+        return;
+    }
+
+    unsigned long preloadWindow = preloadTime;
+    if( setFader ) {
+        preloadWindow += setFader->fadeRunTime;
+    }
+
+    if( (effectSet->infinite || effectSet->timeElapsed + preloadWindow >= effectSet->runTime) ) {
+        preloadNext();
+    }
+
+    if( setFader && nextState == 2 ) {
+        setFader->nextEffect = nextEffect;
+    }
+
+    if( effectSet->done ) {
+        startNext();
+    }
+}
+
+//Swaps the next effect into the effect set, replacing the current effect
+//If the next effect hasn't been built yet, we build it now
+//Once the effect is swapped in, the effect set's run time is set for the entry, and the set is restarted
+//Then we read the next entry from the playlist, looping back to the start once we reach the end
+void PlaylistPS::startNext() {
+    if( nextState != 2 ) {
+        preloadNext();
+    }
+
+    //Reset the fader before we destruct the current effect, finishing any transition
+    bool transitioned = false;
+    if( setFader ) {
+        transitioned = setFader->transStarted;
+        setFader->reset();
+    }
+
+    if( started && clearSegSet && !transitioned ) {
+        segDrawUtils::turnSegSetOff(*curEntry.segSet);
+    }
+
+    effectSet->destructEffect(effectNum);
+    effectSet->setEffect(nextEffect, effectNum);
+    curEntry = nextEntry;
+
+    //Run time of 0 runs the effect forever
+    effectSet->runTime = curEntry.runTime;
+    effectSet->infinite = (curEntry.runTime == 0);
+    effectSet->reset();
+
+    started = true;
+    entryCount++;
+
+    readNextEntry();
+}
+
+//Reads the next entry from the playlist, looping back to the start of the playlist once we reach the end
+//The entry is flagged as ready for building once it's been read
+void PlaylistPS::readNextEntry() {
+    nextState = 0;
+    nextEffect = nullptr;
+
+    if( !playlistUtilsPS::readEntry(playlistText, textPos, *playlistLib, nextEntry) ) {
+        textPos = 0;
+        playlistUtilsPS::readEntry(playlistText, textPos, *playlistLib, nextEntry);
+    }
+    nextState = 1;
+}
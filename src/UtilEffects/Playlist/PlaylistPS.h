@@ -0,0 +1,166 @@
+#ifndef PlaylistPS_h
+#define PlaylistPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "UtilEffects/EffectSet/EffectSetPS.h"
+#include "UtilEffects/EffectSetFader/EffectSetFaderPS.h"
+#include "Utils/playlistUtilsPS.h"
+
+/*
+A utility for running a "playlist" of effects, where the effects, their settings, and their run times
+are described in a text playlist, rather than in code. This lets you change a show by changing the playlist,
+(ie by reading it from an SD card) without rewriting your program's effect switching code.
+
+The utility works with an EffectSetPS. The current playlist effect is placed at "effectNum" in the effect set's array,
+so you can still have other effects and utilities in the set (like an EffectSetFaderPS, or a PaletteBlenderPS).
+When the effect set finishes (reaches its run time), the current effect is destructed and the next one is swapped in.
+The utility updates the effect set for you, so call the playlist's update() instead of the effect set's.
+
+Playlist Format:
+    Each line of the playlist is one effect entry, with values separated by spaces (or tabs or commas):
+        <effect name> <segment set #> <palette #> <run time (ms)> <constructor parameters...>
+    ie:
+        # effect   segSet  palette  runTime  params
+        twinkle    0       0        10000    0 1 6 6 70
+        streamer   0       1        10000    0 4 3 8 60
+        rainbow    1       -1       5000     20 40
+    * The effect name must match one of the effect names in the playlist library (see playlistLibPS.h).
+    * The segment set and palette numbers are the indexes of the segment set and palette in the library's lists.
+      Use a palette number of -1 for effects that don't use a palette.
+    * A run time of 0 runs the effect forever (you can skip to the next entry using skipEntry()).
+    * The constructor parameters are whole numbers, and can be negative or written in hex, ie 0xFF0000 (red),
+      up to PLAYLIST_MAX_PARAMS_PS (default 12) parameters per entry.
+      They are passed to the effect's build function, which uses them to construct the effect (see playlistLibPS.h).
+    * Lines starting with # are comments. Blank lines, and lines with unknown effects or missing values are skipped.
+    * Once the end of the playlist is reached, it loops back to the start.
+    The playlist text is read using pgm_read_byte(), so you can store it in PROGMEM (!!on AVR chips it must be in PROGMEM):
+        const char playlist[] PROGMEM = "twinkle 0 0 10000 0 1 6 6 70\n"
+                                        "streamer 0 1 10000 0 4 3 8 60\n";
+
+Preloading Effects:
+    Constructing an effect can take a while, especially for large effects that allocate and fill arrays.
+    Doing this right when one effect ends and the next starts can cause a noticeable "hitch" in the transition.
+    To avoid this, the utility constructs ("preloads") the next effect before the current one ends.
+    By default, this is done during the update() "preloadTime" ms before the current effect ends,
+    so any hitch happens while the effect is running (or while it's faded out if you're using an EffectSetFaderPS
+    with a fade time longer than the preloadTime).
+    You can also preload the next effect earlier, during idle time in your sketch, by calling preloadNext().
+    preloadNext() only builds an effect when one is needed, so it's safe to call it as often as you like.
+    !!Only call preloadNext() from the same thread/core that calls update(). Building an effect uses shared scratch memory
+    and (if you're using it) the memory arena, neither of which are safe to use while the effects are updating.
+    !!Make sure your effects' build functions don't draw anything, since they run while another effect is running.
+
+    Note that the next effect exists alongside the current one for a bit, so you need enough memory for both.
+    Also, because the effects' lifetimes overlap, you shouldn't use the EffectSetPS's arena scope functions with the playlist.
+
+Transitions:
+    If you're using an EffectSetFaderPS in the effect set, you can point the playlist's `setFader` to it:
+        playlist.setFader = &setFader;
+    The playlist will then reset the fader whenever it switches effects, 
+    and hand the preloaded effect to the fader as its `nextEffect`, so the fader can transition between effects
+    (if its `transMode` is set, see EffectSetFaderPS.h).
+    With a fader set, the next effect is preloaded "preloadTime" before the fader's fade time starts,
+    so that it's ready for the transition. 
+    The current effect's segment set isn't cleared after a transition, since the next effect has already drawn on it.
+
+Example calls: 
+    EffectBasePS *effArray[2] = {&paletteBlender, nullptr};
+    EffectSetPS effectSet(effArray, SIZE(effArray), 1, 10000);
+    //(see playlistLibPS.h for making the playlist library)
+    PlaylistPS playlist(effectSet, 1, playlistLib, playlistText);
+    Runs the effects in "playlistText" using the effect set, putting the effects at index 1 of the effect array.
+
+Constructor Inputs:
+    effectSet -- The effect set the playlist effects will be run in.
+    effectNum -- The index in the effect set's effect array that the playlist's effects will use.
+                 !!The effect at the index will be destructed (if it's not nullptr), so leave the index empty (nullptr)
+    playlistLib -- The library of effect types, segment sets, and palettes used by the playlist (see playlistLibPS.h).
+    playlistText -- The playlist (see Playlist Format above). Can be changed later using setPlaylist().
+
+Other Settings:
+    preloadTime (default 500ms) -- How long before the current effect ends that the next effect will be preloaded 
+                                   (see Preloading Effects above).
+    clearSegSet (default true) -- If true, the current effect's segment set will be turned off (set to black)
+                                  before switching effects.
+    setFader (default nullptr) -- An EffectSetFaderPS in the effect set, used for transitions (see Transitions above).
+
+Functions:
+    setPlaylist(newPlaylistText) -- Sets a new playlist, and starts playing it from the first entry.
+    preloadNext() -- Constructs the next effect if it hasn't been already (see Preloading Effects above).
+    skipEntry() -- Switches to the next entry right away.
+    update() -- Updates the effect set, and switches to the next effect when the set is done.
+
+Reference Vars:
+    curEntry -- The playlist entry currently running (see playlistEntryPS.h).
+    nextEntry -- The next playlist entry.
+    entryCount -- The number of entries that have been started (does not reset automatically).
+
+Flags:
+    hasEntries -- Will be false if the playlist doesn't have any valid entries.
+*/
+class PlaylistPS {
+    public:
+        PlaylistPS(EffectSetPS &EffectSet, uint8_t EffectNum, playlistLibPS &PlaylistLib, const char *PlaylistText);
+
+        ~PlaylistPS();
+
+        EffectSetPS
+            *effectSet = nullptr;
+
+        playlistLibPS
+            *playlistLib = nullptr;
+
+        EffectSetFaderPS
+            *setFader = nullptr;
+
+        const char
+            *playlistText = nullptr;
+
+        uint8_t
+            effectNum;
+
+        uint16_t
+            preloadTime = 500,
+            entryCount = 0;
+
+        bool
+            clearSegSet = true,
+            hasEntries = false;
+
+        playlistEntryPS
+            curEntry,
+            nextEntry;
+
+        void
+            setPlaylist(const char *newPlaylistText),
+            preloadNext(),
+            skipEntry(),
+            update(void);
+
+    private:
+        uint16_t
+            textPos = 0;
+
+        //Tracks the next entry, 0: being read, 1: read (needs building), 2: built
+        uint8_t
+            nextState = 0;
+
+        EffectBasePS
+            *nextEffect = nullptr;
+
+        bool
+            started = false;
+
+        void
+            readNextEntry(),
+            startNext();
+};
+
+#endif
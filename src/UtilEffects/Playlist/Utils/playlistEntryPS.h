@@ -0,0 +1,36 @@
+#ifndef playlistEntryPS_h
+#define playlistEntryPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "Include_Lists/SegmentFiles.h"
+#include "Include_Lists/PaletteFiles.h"
+
+//The maximum number of constructor parameters for a playlist entry
+#ifndef PLAYLIST_MAX_PARAMS_PS
+    #define PLAYLIST_MAX_PARAMS_PS 12
+#endif
+
+/*
+A struct for a single entry (line) of a playlist, as read by playlistUtilsPS::readEntry() (see PlaylistPS.h).
+The entry is passed to an effect's build function, which uses it to construct the effect, ie:
+    return new TwinkleSL(*entry.segSet, *entry.palette, entry.paramArr[0], ...);
+Use playlistUtilsPS::getParam() to read parameters that may be missing from the entry.
+
+You shouldn't need to set any of the struct's variables yourself, they are filled in from the playlist. */
+struct playlistEntryPS {
+    uint8_t effectType;        //the index of the effect in the playlist library's effect list
+    SegmentSetPS *segSet;      //the entry's segment set
+    palettePS *palette;        //the entry's palette, nullptr if the entry doesn't have one
+    uint16_t runTime;          //how long the entry runs for (ms), 0 runs forever
+    uint8_t numParams;         //the number of constructor parameters in the paramArr
+    int32_t paramArr[PLAYLIST_MAX_PARAMS_PS];  //the constructor parameters
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef playlistLibPS_h
+#define playlistLibPS_h
+
+#if ARDUINO >= 100
+    #include "Arduino.h"
+#else
+    #include "WConstants.h"
+    #include "WProgram.h"
+    #include "pins_arduino.h"
+#endif
+
+#include "Effects/EffectBasePS.h"
+#include "playlistEntryPS.h"
+
+/*
+Structs for the "library" of effects, segment sets, and palettes a playlist can use (see PlaylistPS.h).
+Because the effects are only named in the playlist, you need to tell the playlist how to build each effect type.
+This is done with a list of playlistEffectPS's, each having the effect's name (as used in the playlist),
+and a function that constructs the effect from a playlist entry, returning a pointer to it:
+    EffectBasePS *buildTwinkle(playlistEntryPS &entry){
+        return new TwinkleSL(*entry.segSet, *entry.palette, entry.paramArr[0], entry.paramArr[1], 
+                             entry.paramArr[2], entry.paramArr[3], entry.paramArr[4]);
+    }
+    playlistEffectPS effectList[] = { {"twinkle", buildTwinkle}, {"streamer", buildStreamer} };
+Only the effects in the list are compiled into your program, so you only pay for the effects you use.
+
+The build functions should only construct the effect, not draw it, since they may be called 
+while another effect is running, possibly from another core (see PlaylistPS.h).
+
+The segment sets and palettes are referenced by their index in arrays of pointers:
+    SegmentSetPS *segSetList[] = { &mainSegments, &ringSegments };
+    palettePS *paletteList[] = { &cybPnkPal_PS, &palette1 };
+    playlistLibPS playlistLib = { effectList, SIZE(effectList), segSetList, SIZE(segSetList), paletteList, SIZE(paletteList) };
+*/
+struct playlistEffectPS {
+    const char *name;                                  //the effect's name in the playlist
+    EffectBasePS *(*buildFn)(playlistEntryPS &entry);  //function for constructing the effect
+};
+
+struct playlistLibPS {
+    playlistEffectPS *effectArr;  //the list of effect types
+    uint8_t numEffects;           //the number of effect types
+    SegmentSetPS **segSetArr;     //the segment sets, referenced by index
+    uint8_t numSegSets;           //the number of segment sets
+    palettePS **paletteArr;       //the palettes, referenced by index
+    uint8_t numPalettes;          //the number of palettes
+};
+
+#endif
@@ -0,0 +1,157 @@
+#include "playlistUtilsPS.h"
+
+using namespace playlistUtilsPS;
+
+//Reads the next entry from the playlist text, starting at "pos", filling in the passed in entry
+//Returns true if an entry was read, or false if the end of the text was reached
+//pos is left at the start of the line after the entry, so you can call the function again to read the next entry.
+//Blank lines, comments (lines starting with #) and invalid entries are skipped. 
+//An entry is invalid if its effect name isn't in the playlist library, 
+//or if it's missing its segment set index, palette index, or run time, or if its segment set index is out of range.
+//If the palette index is out of range (ie -1), the entry's palette is set to nullptr.
+bool playlistUtilsPS::readEntry(const char *text, uint16_t &pos, playlistLibPS &playlistLib, playlistEntryPS &entry) {
+    uint16_t nameStart;
+    uint8_t nameLen;
+    int32_t segSetNum, paletteNum, runTime, param;
+    char c;
+    bool valid;
+
+    while( pgm_read_byte(&text[pos]) != '\0' ) {
+        skipSpaces(text, pos);
+
+        //Skip blank lines and comments
+        c = pgm_read_byte(&text[pos]);
+        if( c == '#' || c == '\n' || c == '\0' ) {
+            skipLine(text, pos);
+            continue;
+        }
+
+        //Look up the effect's name in the library's effect list
+        nameStart = pos;
+        nameLen = readWord(text, pos);
+        entry.effectType = 255;
+        for( uint8_t i = 0; i < playlistLib.numEffects; i++ ) {
+            if( matchName(text, nameStart, nameLen, playlistLib.effectArr[i].name) ) {
+                entry.effectType = i;
+                break;
+            }
+        }
+
+        //Read the segment set, palette, and run time
+        valid = (entry.effectType != 255) && 
+                readNum(text, pos, segSetNum) && readNum(text, pos, paletteNum) && readNum(text, pos, runTime) &&
+                (segSetNum >= 0) && (segSetNum < playlistLib.numSegSets);
+
+        if( valid ) {
+            entry.segSet = playlistLib.segSetArr[segSetNum];
+            entry.palette = (paletteNum >= 0 && paletteNum < playlistLib.numPalettes) ? playlistLib.paletteArr[paletteNum] : nullptr;
+            entry.runTime = runTime;
+
+            //Read the rest of the line as constructor parameters
+            entry.numParams = 0;
+            while( entry.numParams < PLAYLIST_MAX_PARAMS_PS && readNum(text, pos, param) ) {
+                entry.paramArr[entry.numParams] = param;
+                entry.numParams++;
+            }
+        }
+
+        skipLine(text, pos);
+        if( valid ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//Reads a number from the text at pos, skipping any spaces before it, returning false if there's no number
+//Numbers can be negative, and can be written in hex using "0x" (ie 0xFF0000 for red)
+//Stops at the end of the line, so numbers are never read from the next line
+bool playlistUtilsPS::readNum(const char *text, uint16_t &pos, int32_t &num) {
+    skipSpaces(text, pos);
+
+    bool negative = false;
+    uint8_t base = 10, digit, numDigits = 0;
+    char c = pgm_read_byte(&text[pos]);
+
+    if( c == '-' ) {
+        negative = true;
+        pos++;
+    }
+
+    if( pgm_read_byte(&text[pos]) == '0' && (pgm_read_byte(&text[pos + 1]) | 0x20) == 'x' ) {
+        base = 16;
+        pos += 2;
+    }
+
+    num = 0;
+    while( true ) {
+        c = pgm_read_byte(&text[pos]);
+        if( c >= '0' && c <= '9' ) {
+            digit = c - '0';
+        } else if( base == 16 && (c | 0x20) >= 'a' && (c | 0x20) <= 'f' ) {
+            digit = (c | 0x20) - 'a' + 10;
+        } else {
+            break;
+        }
+        num = num * base + digit;
+        numDigits++;
+        pos++;
+    }
+
+    if( negative ) {
+        num = -num;
+    }
+    return numDigits > 0;
+}
+
+//Returns true if the word in the text at pos (nameLen characters long) matches the name
+bool playlistUtilsPS::matchName(const char *text, uint16_t pos, uint8_t nameLen, const char *name) {
+    for( uint8_t i = 0; i < nameLen; i++ ) {
+        if( pgm_read_byte(&text[pos + i]) != name[i] ) {
+            return false;
+        }
+    }
+    return name[nameLen] == '\0';
+}
+
+//Moves pos past the word at pos (up to the next space or the end of the line), returning the word's length
+uint8_t playlistUtilsPS::readWord(const char *text, uint16_t &pos) {
+    uint8_t wordLen = 0;
+    char c = pgm_read_byte(&text[pos]);
+    while( c != '\0' && c != '\n' && c != ' ' && c != '\t' && c != ',' && c != '\r' ) {
+        wordLen++;
+        pos++;
+        c = pgm_read_byte(&text[pos]);
+    }
+    return wordLen;
+}
+
+//Moves pos past any spaces (or tabs, commas, and carriage returns), stopping at the end of the line
+void playlistUtilsPS::skipSpaces(const char *text, uint16_t &pos) {
+    char c = pgm_read_byte(&text[pos]);
+    while( c == ' ' || c == '\t' || c == ',' || c == '\r' ) {
+        pos++;
+        c = pgm_read_byte(&text[pos]);
+    }
+}
+
+//Moves pos to the start of the next line (or the end of the text)
+void playlistUtilsPS::skipLine(const char *text, uint16_t &pos) {
+    char c = pgm_read_byte(&text[pos]);
+    while( c != '\0' ) {
+        pos++;
+        if( c == '\n' ) {
+            break;
+        }
+        c = pgm_read_byte(&text[pos]);
+    }
+}
+
+//Returns a constructor parameter from a playlist entry, or the default value if the entry doesn't have the parameter
+//Useful for optional parameters, ie: getParam(entry, 4, 70) returns the 5th parameter, or 70 if there are only 4
+int32_t playlistUtilsPS::getParam(playlistEntryPS &entry, uint8_t paramNum, int32_t defaultVal) {
+    if( paramNum < entry.numParams ) {
+        return entry.paramArr[paramNum];
+    }
+    return defaultVal;
+}
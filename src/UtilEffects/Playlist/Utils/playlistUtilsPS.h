@@ -0,0 +1,29 @@
+#ifndef playlistUtilsPS_h
+#define playlistUtilsPS_h
+
+#include "playlistEntryPS.h"
+#include "playlistLibPS.h"
+
+/*
+Functions for reading playlists, used by the PlaylistPS utility (see PlaylistPS.h for the playlist format).
+The playlist text is read using pgm_read_byte(), so it can be stored in PROGMEM. 
+Entries are read one at a time using readEntry(), which skips any blank lines, comments, or invalid entries. */
+namespace playlistUtilsPS {
+
+    bool
+        readEntry(const char *text, uint16_t &pos, playlistLibPS &playlistLib, playlistEntryPS &entry),
+        readNum(const char *text, uint16_t &pos, int32_t &num),
+        matchName(const char *text, uint16_t pos, uint8_t nameLen, const char *name);
+
+    uint8_t
+        readWord(const char *text, uint16_t &pos);
+
+    void
+        skipSpaces(const char *text, uint16_t &pos),
+        skipLine(const char *text, uint16_t &pos);
+
+    int32_t
+        getParam(playlistEntryPS &entry, uint8_t paramNum, int32_t defaultVal);
+};
+
+#endif
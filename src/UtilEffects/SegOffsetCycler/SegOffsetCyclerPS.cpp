@@ -16,7 +16,7 @@ SegOffsetCyclerPS::SegOffsetCyclerPS(SegmentSetPS &SegSet, uint8_t ColorMode, bo
 }
 
 SegOffsetCyclerPS::~SegOffsetCyclerPS() {
-    free(segGroupTemp);
+    memUtilsPS::freePS(segGroupTemp);
 }
 
 //initialization
@@ -42,8 +42,8 @@ then assigns the array to group
 lets you delete the groupTemp when a new Segment Set is assigned
 without worrying about deleting parts of any external arrays that may have been assigned to the group before */
 void SegOffsetCyclerPS::setSingleSet(SegmentSetPS &SegSet) {
-    free(segGroupTemp);
-    segGroupTemp = (SegmentSetPS **)malloc(1 * sizeof(SegmentSetPS *));
+    memUtilsPS::freePS(segGroupTemp);
+    segGroupTemp = (SegmentSetPS **)memUtilsPS::allocPS(1 * sizeof(SegmentSetPS *));
     segGroupTemp[0] = &SegSet;
     segGroup = segGroupTemp;
     numSegSets = 1;